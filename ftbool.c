@@ -1,7 +1,7 @@
 #include "ftbool.h"
 
-SEQFLOW ctxscan(CHARSET_INFO *cs, char *src, char *src_end, my_wc_t *dst, int *readsize, int context){
-    *readsize = cs->cset->mb_wc(cs, dst, (uchar*)src, (uchar*)src_end);
+SEQFLOW ctxscan(const FTCORE_CODEC *codec, char *src, char *src_end, ftcore_wc *dst, int *readsize, int context, int emit){
+    *readsize = codec->decode(codec, dst, (unsigned char*)src, (unsigned char*)src_end);
     if(*readsize <= 0){
       return SF_BROKEN; // break;
     }
@@ -15,14 +15,18 @@ SEQFLOW ctxscan(CHARSET_INFO *cs, char *src, char *src_end, my_wc_t *dst, int *r
         if(*dst=='"') return SF_QUOTE_START;
         if(*dst=='(') return SF_LEFT_PAREN;
         if(*dst==')') return SF_RIGHT_PAREN;
-        if(my_isspace(cs, *src)) return SF_WHITE;
+        int length;
+        if(codec->ctype(codec, (unsigned char*)src, (unsigned char*)src_end, &length) & FTCORE_CT_SPACE) return SF_WHITE;
         
         if(context & CTX_CONTROL){
             if(*dst=='+') return SF_PLUS;
             if(*dst=='-') return SF_MINUS;
-            if(*dst=='>') return SF_WEAK;
-            if(*dst=='<') return SF_STRONG;
+            if(*dst=='>') return SF_STRONG;
+            if(*dst=='<') return SF_WEAK;
             if(*dst=='~') return SF_WASIGN;
+            if(*dst=='=' && (emit & FTCORE_EMIT_SURFACE)) return SF_EXACT;
+            if(*dst=='^' && (emit & FTCORE_EMIT_EDGE)) return SF_EDGE;
+            if(*dst=='%' && (emit & FTCORE_EMIT_TRIGRAM)) return SF_TRIGRAM;
         }else{
             if(*dst=='*') return SF_TRUNC;
         }
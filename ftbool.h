@@ -1,5 +1,7 @@
-#include <my_global.h>
-#include <m_ctype.h>
+#ifndef FTBOOL_H
+#define FTBOOL_H
+
+#include "ftcore.h"
 
 // char sequence flow control definitions
 typedef enum seqflow {
@@ -15,6 +17,9 @@ typedef enum seqflow {
     SF_WEAK,
     SF_STRONG,
     SF_WASIGN,
+    SF_EXACT,
+    SF_EDGE,
+    SF_TRIGRAM,
     SF_TRUNC,
     SF_BROKEN
 } SEQFLOW;
@@ -24,4 +29,11 @@ static int CTX_ESCAPE  = 1;
 static int CTX_QUOTE   = 2;
 static int CTX_CONTROL = 4;
 
-SEQFLOW ctxscan(CHARSET_INFO *cs, char *src, char *src_end, my_wc_t *dst, int *readsize, int context);
+/** @return whether sf is an operator in front of a word */
+#define ftbool_prefix(sf) ((sf)==SF_PLUS || (sf)==SF_MINUS || (sf)==SF_WEAK || (sf)==SF_STRONG || (sf)==SF_WASIGN || (sf)==SF_EXACT || \
+                          (sf)==SF_EDGE || (sf)==SF_TRIGRAM)
+
+/** emit: the FTCORE_EMIT_* flags of the parse; '=', '^' and '%' are operators only with theirs */
+SEQFLOW ctxscan(const FTCORE_CODEC *codec, char *src, char *src_end, ftcore_wc *dst, int *readsize, int context, int emit);
+
+#endif
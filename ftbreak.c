@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#if HAVE_ICU
+#include <unicode/ubrk.h>
+#include <unicode/utext.h>
+#include <unicode/uversion.h>
+#endif
+
+#include "ftcore.h"
+#include "ftbreak.h"
+
+#if HAVE_ICU
+struct _ftbreak {
+  UBreakIterator *bi; // the clone of the thread
+  UText ut;           // reopened on every text
+  const char *text;
+  int32_t pos;
+  FTBREAK *next;      // in ftbreak_all
+};
+
+static pthread_key_t ftbreak_key;
+static pthread_mutex_t ftbreak_lock = PTHREAD_MUTEX_INITIALIZER;
+static UBreakIterator *ftbreak_original = NULL;
+/** the iterators of all threads, as pthread_key_delete() runs no destructors */
+static FTBREAK *ftbreak_all = NULL;
+
+static void ftbreak_close_iterator(FTBREAK *br){
+  utext_close(&br->ut);
+  ubrk_close(br->bi);
+  ftcore_free(br);
+}
+
+/** thread exit. the iterator may be gone already, with ftbreak_deinit(). */
+static void ftbreak_free(void *ptr){
+  FTBREAK **p;
+  pthread_mutex_lock(&ftbreak_lock);
+  for(p = &ftbreak_all; *p && *p != (FTBREAK*)ptr; p = &(*p)->next);
+  if(*p){
+    *p = (*p)->next;
+  }else{
+    ptr = NULL;
+  }
+  pthread_mutex_unlock(&ftbreak_lock);
+  if(ptr){
+    ftbreak_close_iterator((FTBREAK*)ptr);
+  }
+}
+
+int ftbreak_init(void){
+  return pthread_key_create(&ftbreak_key, ftbreak_free) ? -1 : 0;
+}
+
+void ftbreak_deinit(void){
+  FTBREAK *br;
+  pthread_key_delete(ftbreak_key);
+  pthread_mutex_lock(&ftbreak_lock);
+  br = ftbreak_all;
+  ftbreak_all = NULL;
+  if(ftbreak_original){
+    ubrk_close(ftbreak_original);
+    ftbreak_original = NULL;
+  }
+  pthread_mutex_unlock(&ftbreak_lock);
+  while(br){
+    FTBREAK *next = br->next;
+    ftbreak_close_iterator(br);
+    br = next;
+  }
+}
+
+/** @return a new iterator for the calling thread, opening the original first if need be */
+static UBreakIterator* ftbreak_clone(void){
+  UErrorCode ustatus = U_ZERO_ERROR;
+  UBreakIterator *bi = NULL;
+  pthread_mutex_lock(&ftbreak_lock);
+  if(!ftbreak_original){
+    ftbreak_original = ubrk_open(UBRK_WORD, "", NULL, 0, &ustatus);
+    if(U_FAILURE(ustatus)){
+      char errstr[128];
+      sprintf(errstr, "ubrk_open failed. ICU status code %d\n", ustatus);
+      fputs(errstr, stderr);
+      fflush(stderr);
+      ftbreak_original = NULL;
+    }
+  }
+  if(ftbreak_original){
+#if U_ICU_VERSION_MAJOR_NUM >= 69
+    bi = ubrk_clone(ftbreak_original, &ustatus);
+#else
+    bi = ubrk_safeClone(ftbreak_original, NULL, NULL, &ustatus);
+#endif
+    if(U_FAILURE(ustatus)){
+      bi = NULL;
+    }
+  }
+  pthread_mutex_unlock(&ftbreak_lock);
+  return bi;
+}
+
+FTBREAK* ftbreak_open(const char *utf8, size_t length){
+  FTBREAK *br = (FTBREAK*)pthread_getspecific(ftbreak_key);
+  UErrorCode ustatus = U_ZERO_ERROR;
+  if(length > INT32_MAX){
+    return NULL;
+  }
+  if(!br){
+    static const UText ut_init = UTEXT_INITIALIZER;
+    br = (FTBREAK*)ftcore_malloc(sizeof(FTBREAK));
+    if(!br){
+      return NULL;
+    }
+    br->ut = ut_init;
+    br->bi = ftbreak_clone();
+    if(!br->bi){
+      ftcore_free(br);
+      return NULL;
+    }
+    if(pthread_setspecific(ftbreak_key, br)){
+      ubrk_close(br->bi);
+      ftcore_free(br);
+      return NULL;
+    }
+    pthread_mutex_lock(&ftbreak_lock);
+    br->next = ftbreak_all;
+    ftbreak_all = br;
+    pthread_mutex_unlock(&ftbreak_lock);
+  }
+  utext_openUTF8(&br->ut, utf8, (int64_t)length, &ustatus);
+  if(U_SUCCESS(ustatus)){
+    ubrk_setUText(br->bi, &br->ut, &ustatus);
+  }
+  if(U_FAILURE(ustatus)){
+    return NULL;
+  }
+  br->text = utf8;
+  br->pos = ubrk_first(br->bi);
+  return br;
+}
+
+int ftbreak_next(FTBREAK *br, const char **word, size_t *length){
+  int32_t end;
+  while((end = ubrk_next(br->bi)) != UBRK_DONE){
+    int32_t start = br->pos;
+    br->pos = end;
+    // UBRK_WORD_NONE for spaces and punctuation, numbers, letters, kana and ideographs above.
+    if(ubrk_getRuleStatus(br->bi) >= UBRK_WORD_NONE_LIMIT){
+      *word = br->text + start;
+      *length = (size_t)(end - start);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void ftbreak_close(FTBREAK *br){
+  UErrorCode ustatus = U_ZERO_ERROR;
+  // leave no pointer into the text behind.
+  utext_openUTF8(&br->ut, "", 0, &ustatus);
+  ubrk_setUText(br->bi, &br->ut, &ustatus);
+  br->text = NULL;
+}
+#else
+int  ftbreak_init(void){ return 0; }
+void ftbreak_deinit(void){}
+FTBREAK* ftbreak_open(const char *utf8, size_t length){ return NULL; }
+int  ftbreak_next(FTBREAK *br, const char **word, size_t *length){ return 0; }
+void ftbreak_close(FTBREAK *br){}
+#endif
@@ -0,0 +1,32 @@
+#ifndef FTBREAK_H
+#define FTBREAK_H
+
+#include <stddef.h>
+
+/**
+ * Word segmentation by ICU word break iteration: UAX #29, and the
+ * dictionaries of Thai and the other scripts written without spaces. The
+ * text is read as UTF-8 through UText, without a UTF-16 copy.
+ *
+ * ubrk_open() is slow, so the iterator is opened once and cloned once per
+ * thread; a document only binds the clone of its thread to its text. A
+ * thread segments one text at a time.
+ */
+
+typedef struct _ftbreak FTBREAK;
+
+int  ftbreak_init(void);
+/** frees the iterators of all threads and the original. no segmentation may run. */
+void ftbreak_deinit(void);
+
+/**
+ * Binds the iterator of the calling thread to a text, which must stay
+ * until ftbreak_close().
+ * @return NULL if ICU failed or memory ran out
+ */
+FTBREAK* ftbreak_open(const char *utf8, size_t length);
+/** @return 1 with the next word, skipping spaces and punctuation, or 0 at the end */
+int  ftbreak_next(FTBREAK *br, const char **word, size_t *length);
+void ftbreak_close(FTBREAK *br);
+
+#endif
@@ -0,0 +1,227 @@
+#include <my_global.h>
+#include <my_sys.h>
+#include <m_string.h>
+#include "ftcache.h"
+
+/**
+ * The cache is split into stripes by the key, each with its own lock, hash
+ * table, LRU list and share of the capacity, so that parses of different
+ * documents seldom wait for each other.
+ */
+#define FTCACHE_STRIPES 16
+
+struct _ftcache_entry {
+  FTHASH128 key;
+  struct _ftcache_entry *hnext;  // hash chain
+  struct _ftcache_entry *prev;   // LRU list, more recently used
+  struct _ftcache_entry *next;   // LRU list, less recently used
+  int    refs;                   // 1 while in the cache, +1 per pin
+  size_t length;
+  char   tokens[1];
+};
+
+struct ftcache_stripe {
+  pthread_mutex_t lock;
+  FTCACHE_ENTRY **buckets;
+  size_t bucket_count;
+  FTCACHE_ENTRY *lru_head;
+  FTCACHE_ENTRY *lru_tail;
+  size_t used;
+  size_t count;
+};
+
+ulong ftcache_hits = 0;
+ulong ftcache_misses = 0;
+
+static struct ftcache_stripe stripes[FTCACHE_STRIPES];
+static size_t cache_capacity = 0;
+
+#define ENTRY_SIZE(length) (sizeof(FTCACHE_ENTRY) + (length))
+
+/** h1 picks the bucket, h2 the stripe. */
+static struct ftcache_stripe* stripe_of(const FTHASH128 *key){
+  return &stripes[key->h2 % FTCACHE_STRIPES];
+}
+
+static size_t bucket_of(const FTHASH128 *key, size_t count){
+  return (size_t)(key->h1 & (count-1));
+}
+
+static size_t stripe_capacity(){
+  return __atomic_load_n(&cache_capacity, __ATOMIC_RELAXED) / FTCACHE_STRIPES;
+}
+
+static void lru_unlink(struct ftcache_stripe *s, FTCACHE_ENTRY *e){
+  if(e->prev){ e->prev->next = e->next; }else{ s->lru_head = e->next; }
+  if(e->next){ e->next->prev = e->prev; }else{ s->lru_tail = e->prev; }
+  e->prev = e->next = NULL;
+}
+
+static void lru_push(struct ftcache_stripe *s, FTCACHE_ENTRY *e){
+  e->prev = NULL;
+  e->next = s->lru_head;
+  if(s->lru_head){ s->lru_head->prev = e; }
+  s->lru_head = e;
+  if(!s->lru_tail){ s->lru_tail = e; }
+}
+
+static void unref(FTCACHE_ENTRY *e){
+  if(--e->refs == 0){
+    my_free(e);
+  }
+}
+
+/** removes the least recently used entries until the stripe fits. lock held. */
+static void evict(struct ftcache_stripe *s, size_t limit){
+  while(s->lru_tail && s->used > limit){
+    FTCACHE_ENTRY *e = s->lru_tail;
+    FTCACHE_ENTRY **link = &s->buckets[bucket_of(&e->key, s->bucket_count)];
+    while(*link != e){
+      link = &(*link)->hnext;
+    }
+    *link = e->hnext;
+    lru_unlink(s, e);
+    s->used -= ENTRY_SIZE(e->length);
+    s->count--;
+    unref(e);
+  }
+}
+
+/** doubles the bucket array once chains get long. lock held. */
+static void rehash(struct ftcache_stripe *s){
+  size_t count = s->bucket_count ? s->bucket_count<<1 : 64;
+  FTCACHE_ENTRY **tmp = (FTCACHE_ENTRY**)my_malloc(count*sizeof(FTCACHE_ENTRY*), MYF(MY_WME|MY_ZEROFILL));
+  size_t i;
+  if(!tmp){ return; }
+  for(i=0; i<s->bucket_count; i++){
+    FTCACHE_ENTRY *e = s->buckets[i];
+    while(e){
+      FTCACHE_ENTRY *n = e->hnext;
+      size_t b = bucket_of(&e->key, count);
+      e->hnext = tmp[b];
+      tmp[b] = e;
+      e = n;
+    }
+  }
+  if(s->buckets){ my_free(s->buckets); }
+  s->buckets = tmp;
+  s->bucket_count = count;
+}
+
+void ftcache_init(size_t capacity){
+  size_t i;
+  for(i=0; i<FTCACHE_STRIPES; i++){
+    memset(&stripes[i], 0, sizeof(stripes[i]));
+    pthread_mutex_init(&stripes[i].lock, NULL);
+  }
+  cache_capacity = capacity;
+}
+
+void ftcache_deinit(){
+  size_t i;
+  for(i=0; i<FTCACHE_STRIPES; i++){
+    struct ftcache_stripe *s = &stripes[i];
+    pthread_mutex_lock(&s->lock);
+    evict(s, 0);
+    if(s->buckets){ my_free(s->buckets); }
+    s->buckets = NULL;
+    s->bucket_count = 0;
+    pthread_mutex_unlock(&s->lock);
+    pthread_mutex_destroy(&s->lock);
+  }
+}
+
+void ftcache_set_capacity(size_t capacity){
+  size_t i;
+  __atomic_store_n(&cache_capacity, capacity, __ATOMIC_RELAXED); // read without the locks
+  for(i=0; i<FTCACHE_STRIPES; i++){
+    pthread_mutex_lock(&stripes[i].lock);
+    evict(&stripes[i], stripe_capacity());
+    pthread_mutex_unlock(&stripes[i].lock);
+  }
+}
+
+size_t ftcache_capacity(){
+  return __atomic_load_n(&cache_capacity, __ATOMIC_RELAXED);
+}
+
+size_t ftcache_max_entry(){
+  // a single document may take at most 1/8 of its stripe.
+  size_t limit = stripe_capacity() >> 3;
+  return limit > sizeof(FTCACHE_ENTRY) ? limit - sizeof(FTCACHE_ENTRY) : 0;
+}
+
+FTCACHE_ENTRY* ftcache_lookup(const FTHASH128 *key){
+  struct ftcache_stripe *s = stripe_of(key);
+  FTCACHE_ENTRY *e = NULL;
+  pthread_mutex_lock(&s->lock);
+  if(s->buckets){
+    e = s->buckets[bucket_of(key, s->bucket_count)];
+    while(e && (e->key.h1 != key->h1 || e->key.h2 != key->h2)){
+      e = e->hnext;
+    }
+  }
+  if(e){
+    lru_unlink(s, e);
+    lru_push(s, e);
+    e->refs++;
+  }
+  pthread_mutex_unlock(&s->lock);
+  __atomic_fetch_add(e ? &ftcache_hits : &ftcache_misses, 1, __ATOMIC_RELAXED);
+  return e;
+}
+
+void ftcache_release(FTCACHE_ENTRY *entry){
+  struct ftcache_stripe *s = stripe_of(&entry->key);
+  pthread_mutex_lock(&s->lock);
+  unref(entry);
+  pthread_mutex_unlock(&s->lock);
+}
+
+const char* ftcache_tokens(FTCACHE_ENTRY *entry, size_t *length){
+  *length = entry->length;
+  return entry->tokens;
+}
+
+void ftcache_insert(const FTHASH128 *key, const char *tokens, size_t length){
+  struct ftcache_stripe *s = stripe_of(key);
+  if(length > ftcache_max_entry()){
+    return;
+  }
+  FTCACHE_ENTRY *e = (FTCACHE_ENTRY*)my_malloc(ENTRY_SIZE(length), MYF(MY_WME));
+  if(!e){
+    return;
+  }
+  e->key = *key;
+  e->hnext = e->prev = e->next = NULL;
+  e->refs = 1;
+  e->length = length;
+  memcpy(e->tokens, tokens, length);
+
+  pthread_mutex_lock(&s->lock);
+  if(s->count >= s->bucket_count<<1){
+    rehash(s);
+  }
+  if(!s->buckets){
+    pthread_mutex_unlock(&s->lock);
+    my_free(e);
+    return;
+  }
+  FTCACHE_ENTRY **link = &s->buckets[bucket_of(key, s->bucket_count)];
+  FTCACHE_ENTRY *cur = *link;
+  while(cur && (cur->key.h1 != key->h1 || cur->key.h2 != key->h2)){
+    cur = cur->hnext;
+  }
+  if(cur){ // another thread parsed the same document meanwhile.
+    pthread_mutex_unlock(&s->lock);
+    my_free(e);
+    return;
+  }
+  e->hnext = *link;
+  *link = e;
+  lru_push(s, e);
+  s->used += ENTRY_SIZE(length);
+  s->count++;
+  evict(s, stripe_capacity());
+  pthread_mutex_unlock(&s->lock);
+}
@@ -0,0 +1,31 @@
+#ifndef FTCACHE_H
+#define FTCACHE_H
+
+#include <my_global.h>
+#include "fthash.h"
+
+/**
+ * Bounded LRU of parse results, shared by all threads and striped by key.
+ * An entry holds the token stream emitted for one document, keyed by a hash
+ * of the document and everything that affects how it is parsed.
+ * Entries returned by ftcache_lookup() are pinned until ftcache_release(),
+ * so they may be replayed without holding a lock.
+ */
+typedef struct _ftcache_entry FTCACHE_ENTRY;
+
+extern ulong ftcache_hits;
+extern ulong ftcache_misses;
+
+void   ftcache_init(size_t capacity);
+void   ftcache_deinit();
+void   ftcache_set_capacity(size_t capacity);
+size_t ftcache_capacity();
+/** @return the largest token stream that will be cached. 0 when disabled. */
+size_t ftcache_max_entry();
+
+FTCACHE_ENTRY* ftcache_lookup(const FTHASH128 *key);
+void   ftcache_release(FTCACHE_ENTRY *entry);
+const char* ftcache_tokens(FTCACHE_ENTRY *entry, size_t *length);
+void   ftcache_insert(const FTHASH128 *key, const char *tokens, size_t length);
+
+#endif
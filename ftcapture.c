@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ftcore.h"
+#include "ftcapture.h"
+
+#define FTCAPTURE_MAGIC "FTSBCAP3"
+#define FTCAPTURE_BYTEORDER 0x01020304U
+
+struct _ftcapture_reader {
+  const char *map;
+  size_t length;
+  size_t pos;
+  FTCAPTURE_RECORD current; // records in the file are not aligned
+};
+
+static void ftcapture_copy_name(char *to, size_t size, const char *name){
+  size_t len = name ? strlen(name) : 0;
+  if(len >= size){
+    len = size - 1;
+  }
+  if(len){
+    memcpy(to, name, len);
+  }
+}
+
+void ftcapture_record_init(FTCAPTURE_RECORD *rec, const FTCORE_CONFIG *config, int mode,
+                           unsigned int charset, const char *charset_name, size_t length){
+  memset(rec, 0, sizeof(FTCAPTURE_RECORD));
+  memcpy(rec->magic, FTCAPTURE_MAGIC, 8);
+  rec->byteorder = FTCAPTURE_BYTEORDER;
+  rec->mode = (uint32_t)mode;
+  rec->charset = charset;
+  ftcapture_copy_name(rec->charset_name, sizeof(rec->charset_name), charset_name);
+  ftcapture_copy_name(rec->algorithm, sizeof(rec->algorithm), config->algorithm);
+  rec->normalization = (uint32_t)config->normalization;
+  rec->unicode_3_2 = (uint32_t)config->unicode_3_2;
+  rec->drop = (uint32_t)config->drop;
+  rec->emit = (uint32_t)config->emit;
+  rec->edge_min = (uint32_t)config->edge_min;
+  rec->edge_max = (uint32_t)config->edge_max;
+  rec->budget_skip = (uint32_t)config->budget_skip;
+  rec->unaccent = (uint32_t)config->unaccent;
+  rec->tokenizer = (uint32_t)config->tokenizer;
+  rec->max_token_bytes = config->max_token_bytes;
+  rec->parallel_threshold = config->parallel_threshold;
+  rec->time_budget_us = config->time_budget_us;
+  rec->length = length;
+}
+
+void ftcapture_record_config(const FTCAPTURE_RECORD *rec, FTCORE_CONFIG *config){
+  config->algorithm = rec->algorithm[0] ? rec->algorithm : NULL;
+  config->normalization = (enum ftcore_normalization)rec->normalization;
+  config->unicode_3_2 = (int)rec->unicode_3_2;
+  config->drop = (int)rec->drop;
+  config->emit = (int)rec->emit;
+  config->edge_min = (unsigned int)rec->edge_min;
+  config->edge_max = (unsigned int)rec->edge_max;
+  config->budget_skip = (int)rec->budget_skip;
+  config->unaccent = (int)rec->unaccent;
+  config->tokenizer = (enum ftcore_tokenizer)rec->tokenizer;
+  config->max_token_bytes = (size_t)rec->max_token_bytes;
+  config->parallel_threshold = (size_t)rec->parallel_threshold;
+  config->time_budget_us = (unsigned long)rec->time_budget_us;
+  config->generation = 0;
+}
+
+FTCAPTURE_READER* ftcapture_open(const char *path){
+  struct stat st;
+  int fd = open(path, O_RDONLY);
+  FTCAPTURE_READER *reader;
+  void *map = NULL;
+  if(fd < 0){
+    return NULL;
+  }
+  if(fstat(fd, &st)){
+    close(fd);
+    return NULL;
+  }
+  if(st.st_size > 0){
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(map == MAP_FAILED){
+      close(fd);
+      return NULL;
+    }
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+  }
+  close(fd);
+  reader = (FTCAPTURE_READER*)ftcore_malloc(sizeof(FTCAPTURE_READER));
+  if(!reader){
+    if(map){ munmap(map, (size_t)st.st_size); }
+    return NULL;
+  }
+  memset(reader, 0, sizeof(FTCAPTURE_READER));
+  reader->map = (const char*)map;
+  reader->length = (size_t)st.st_size;
+  return reader;
+}
+
+int ftcapture_next(FTCAPTURE_READER *reader, const FTCAPTURE_RECORD **rec, const char **doc){
+  FTCAPTURE_RECORD *cur = &reader->current;
+  size_t left = reader->length - reader->pos;
+  if(left == 0){
+    return 0;
+  }
+  if(left < sizeof(FTCAPTURE_RECORD)){
+    return -1;
+  }
+  memcpy(cur, reader->map + reader->pos, sizeof(FTCAPTURE_RECORD));
+  left -= sizeof(FTCAPTURE_RECORD);
+  if(memcmp(cur->magic, FTCAPTURE_MAGIC, 8) != 0 || cur->byteorder != FTCAPTURE_BYTEORDER
+      || cur->length > left){
+    return -1;
+  }
+  cur->charset_name[sizeof(cur->charset_name) - 1] = '\0';
+  cur->algorithm[sizeof(cur->algorithm) - 1] = '\0';
+  *rec = cur;
+  *doc = reader->map + reader->pos + sizeof(FTCAPTURE_RECORD);
+  reader->pos += sizeof(FTCAPTURE_RECORD) + (size_t)cur->length;
+  return 1;
+}
+
+void ftcapture_close(FTCAPTURE_READER *reader){
+  if(!reader){
+    return;
+  }
+  if(reader->map){
+    munmap((void*)reader->map, reader->length);
+  }
+  ftcore_free(reader);
+}
@@ -0,0 +1,62 @@
+#ifndef FTCAPTURE_H
+#define FTCAPTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ftcore.h"
+
+/**
+ * Workload capture: a file of records, each a fixed size header with the
+ * settings a document was parsed with, followed by the document bytes.
+ * Records are in host byte order. The plugin samples documents into one,
+ * ftsnowball_bulk -r replays it.
+ */
+
+/** the values of the mysql full-text parser modes */
+#define FTCAPTURE_MODE_NATURAL   0
+#define FTCAPTURE_MODE_STOPWORDS 1
+#define FTCAPTURE_MODE_BOOLEAN   2
+
+typedef struct _ftcapture_record {
+  char     magic[8];
+  uint32_t byteorder;
+  uint32_t mode;
+  uint32_t charset;          /* mysql charset number */
+  char     charset_name[32];
+  char     algorithm[32];
+  uint32_t normalization;
+  uint32_t unicode_3_2;
+  uint32_t drop;
+  uint32_t budget_skip;
+  uint32_t unaccent;
+  uint32_t tokenizer;
+  uint32_t emit;
+  uint32_t edge_min;
+  uint32_t edge_max;
+  uint64_t max_token_bytes;
+  uint64_t parallel_threshold;
+  uint64_t time_budget_us;
+  uint64_t length;           /* bytes of the document that follows */
+} FTCAPTURE_RECORD;
+
+void ftcapture_record_init(FTCAPTURE_RECORD *rec, const FTCORE_CONFIG *config, int mode,
+                           unsigned int charset, const char *charset_name, size_t length);
+/**
+ * Fills config with the settings of rec. config->algorithm points into rec;
+ * the settings not captured are left alone.
+ */
+void ftcapture_record_config(const FTCAPTURE_RECORD *rec, FTCORE_CONFIG *config);
+
+typedef struct _ftcapture_reader FTCAPTURE_READER;
+
+/** @return NULL if the file can not be mapped */
+FTCAPTURE_READER* ftcapture_open(const char *path);
+/**
+ * @param rec the record, valid until the next call
+ * @param doc the document, valid until the reader is closed
+ * @return 1 for a record, 0 at the end of the file, -1 for a damaged or truncated record
+ */
+int  ftcapture_next(FTCAPTURE_READER *reader, const FTCAPTURE_RECORD **rec, const char **doc);
+void ftcapture_close(FTCAPTURE_READER *reader);
+
+#endif
@@ -0,0 +1,531 @@
+#include <string.h>
+#include <pthread.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "ftcore.h"
+#include "ftconv.h"
+
+#define FTCONV_SBCS_MAX 64
+
+/** a to_uni table and its reverse, in pages of 256 code points */
+struct ftconv_sbcs {
+  const unsigned short *to_uni;
+  int ascii;                 // the bytes below 0x80 are ASCII
+  unsigned char *pages[256]; // NULL for a page no byte maps into
+};
+
+/** a codec, as ftconv reads or writes it */
+struct ftconv_side {
+  const FTCORE_CODEC *codec;
+  int encoding;
+  int unit;  // bytes of an ASCII character, 0 if ASCII is not moved in runs
+  int max4;  // UTF-8 with 4 byte sequences
+  const struct ftconv_sbcs *sbcs;
+};
+
+static struct ftconv_sbcs *ftconv_sbcs_tables[FTCONV_SBCS_MAX];
+static unsigned int ftconv_sbcs_count = 0;
+static pthread_mutex_t ftconv_sbcs_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void ftconv_sbcs_free(struct ftconv_sbcs *t){
+  int i;
+  for(i=0; i<256; i++){
+    if(t->pages[i]){ ftcore_free(t->pages[i]); }
+  }
+  ftcore_free(t);
+}
+
+static struct ftconv_sbcs* ftconv_sbcs_build(const unsigned short *to_uni){
+  struct ftconv_sbcs *t = (struct ftconv_sbcs*)ftcore_malloc(sizeof(struct ftconv_sbcs));
+  int b;
+  if(!t){
+    return NULL;
+  }
+  memset(t, 0, sizeof(struct ftconv_sbcs));
+  t->to_uni = to_uni;
+  t->ascii = 1;
+  for(b=0; b<256; b++){
+    unsigned int wc = to_uni[b];
+    unsigned char *page;
+    if(b < 0x80 && wc != (unsigned int)b){
+      t->ascii = 0;
+    }
+    if(!wc && b){
+      continue;
+    }
+    page = t->pages[wc >> 8];
+    if(!page){
+      page = (unsigned char*)ftcore_malloc(256);
+      if(!page){
+        ftconv_sbcs_free(t);
+        return NULL;
+      }
+      memset(page, 0, 256);
+      t->pages[wc >> 8] = page;
+    }
+    if(!page[wc & 0xFF]){ // the first byte of a code point is written
+      page[wc & 0xFF] = (unsigned char)b;
+    }
+  }
+  return t;
+}
+
+/** @return the tables of to_uni, built on first use, or NULL */
+static const struct ftconv_sbcs* ftconv_sbcs_get(const unsigned short *to_uni){
+  struct ftconv_sbcs *t = NULL;
+  unsigned int n = __atomic_load_n(&ftconv_sbcs_count, __ATOMIC_ACQUIRE);
+  unsigned int i;
+  for(i=0; i<n; i++){
+    if(ftconv_sbcs_tables[i]->to_uni == to_uni){
+      return ftconv_sbcs_tables[i];
+    }
+  }
+  pthread_mutex_lock(&ftconv_sbcs_lock);
+  n = ftconv_sbcs_count;
+  for(i=0; i<n; i++){
+    if(ftconv_sbcs_tables[i]->to_uni == to_uni){
+      t = ftconv_sbcs_tables[i];
+      break;
+    }
+  }
+  if(!t && n < FTCONV_SBCS_MAX && (t = ftconv_sbcs_build(to_uni))){
+    ftconv_sbcs_tables[n] = t;
+    __atomic_store_n(&ftconv_sbcs_count, n + 1, __ATOMIC_RELEASE);
+  }
+  pthread_mutex_unlock(&ftconv_sbcs_lock);
+  return t;
+}
+
+void ftconv_deinit(void){
+  unsigned int i;
+  pthread_mutex_lock(&ftconv_sbcs_lock);
+  for(i=0; i<ftconv_sbcs_count; i++){
+    ftconv_sbcs_free(ftconv_sbcs_tables[i]);
+    ftconv_sbcs_tables[i] = NULL;
+  }
+  __atomic_store_n(&ftconv_sbcs_count, 0, __ATOMIC_RELEASE);
+  pthread_mutex_unlock(&ftconv_sbcs_lock);
+}
+
+/** @return bytes of the shortest character */
+static size_t ftconv_unit(int encoding){
+  switch(encoding){
+    case FTCORE_ENC_UCS2:
+    case FTCORE_ENC_UTF16:
+    case FTCORE_ENC_UTF16LE: return 2;
+    case FTCORE_ENC_UTF32:   return 4;
+    default:                 return 1;
+  }
+}
+
+static void ftconv_side_init(struct ftconv_side *side, const FTCORE_CODEC *codec){
+  side->codec = codec;
+  side->encoding = codec->encoding;
+  side->max4 = codec->mbmaxlen >= 4;
+  side->sbcs = NULL;
+  side->unit = (int)ftconv_unit(codec->encoding);
+  if(side->encoding == FTCORE_ENC_SBCS){
+    side->sbcs = codec->to_uni ? ftconv_sbcs_get(codec->to_uni) : NULL;
+    if(!side->sbcs){
+      side->encoding = FTCORE_ENC_OTHER;
+    }else if(!side->sbcs->ascii){
+      side->unit = 0;
+    }
+  }
+  if(side->encoding == FTCORE_ENC_OTHER){
+    side->unit = 0;
+  }
+}
+
+size_t ftconv_max_length(const FTCORE_CODEC *from, size_t length, const FTCORE_CODEC *to){
+  size_t chars = length / ftconv_unit(from->encoding);
+  int bmp = from->encoding == FTCORE_ENC_SBCS || from->encoding == FTCORE_ENC_UCS2;
+  int wide = ftconv_unit(from->encoding) == 2; // a pair of units for the supplementary planes
+  switch(to->encoding){
+    case FTCORE_ENC_UTF8:
+      if(from->encoding == FTCORE_ENC_UTF8){
+        return length; // a sequence is copied, or a byte becomes '?'
+      }
+      return chars * (bmp || wide || to->mbmaxlen < 4 ? 3 : 4);
+    case FTCORE_ENC_SBCS:
+      return chars;
+    case FTCORE_ENC_UCS2:
+      return chars * 2;
+    case FTCORE_ENC_UTF16:
+    case FTCORE_ENC_UTF16LE:
+      if(from->encoding == FTCORE_ENC_UTF8){
+        return length * 2;
+      }
+      return chars * (bmp || wide ? 2 : 4);
+    case FTCORE_ENC_UTF32:
+      return chars * 4;
+    default:
+      return chars * (size_t)(to->mbmaxlen > 0 ? to->mbmaxlen : 1);
+  }
+}
+
+/** @return bytes below 0x80 at the start of s, at most n */
+static size_t ftconv_ascii_bytes(const unsigned char *s, size_t n){
+  size_t i = 0;
+#if defined(__SSE2__)
+  for(; i + 16 <= n; i += 16){
+    int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(s + i)));
+    if(mask){
+      return i + (size_t)__builtin_ctz((unsigned int)mask);
+    }
+  }
+#endif
+  while(i < n && s[i] < 0x80){
+    i++;
+  }
+  return i;
+}
+
+/** writes the n ASCII bytes of s in a wide encoding */
+static void ftconv_widen(const unsigned char *s, size_t n, unsigned char *d, int encoding){
+  size_t i = 0;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  for(; i + 16 <= n; i += 16){
+    __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+    if(encoding == FTCORE_ENC_UTF16LE){
+      _mm_storeu_si128((__m128i*)(d + 2 * i),      _mm_unpacklo_epi8(v, zero));
+      _mm_storeu_si128((__m128i*)(d + 2 * i + 16), _mm_unpackhi_epi8(v, zero));
+    }else if(encoding == FTCORE_ENC_UTF32){
+      __m128i lo = _mm_unpacklo_epi8(zero, v);
+      __m128i hi = _mm_unpackhi_epi8(zero, v);
+      _mm_storeu_si128((__m128i*)(d + 4 * i),      _mm_unpacklo_epi16(zero, lo));
+      _mm_storeu_si128((__m128i*)(d + 4 * i + 16), _mm_unpackhi_epi16(zero, lo));
+      _mm_storeu_si128((__m128i*)(d + 4 * i + 32), _mm_unpacklo_epi16(zero, hi));
+      _mm_storeu_si128((__m128i*)(d + 4 * i + 48), _mm_unpackhi_epi16(zero, hi));
+    }else{
+      _mm_storeu_si128((__m128i*)(d + 2 * i),      _mm_unpacklo_epi8(zero, v));
+      _mm_storeu_si128((__m128i*)(d + 2 * i + 16), _mm_unpackhi_epi8(zero, v));
+    }
+  }
+#endif
+  for(; i < n; i++){
+    if(encoding == FTCORE_ENC_UTF16LE){
+      d[2 * i] = s[i];
+      d[2 * i + 1] = 0;
+    }else if(encoding == FTCORE_ENC_UTF32){
+      d[4 * i] = d[4 * i + 1] = d[4 * i + 2] = 0;
+      d[4 * i + 3] = s[i];
+    }else{
+      d[2 * i] = 0;
+      d[2 * i + 1] = s[i];
+    }
+  }
+}
+
+/** writes the ASCII characters at the start of units of a wide encoding. @return characters written */
+static size_t ftconv_narrow(const unsigned char *s, size_t units, unsigned char *d, int encoding){
+  size_t i = 0;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  if(encoding == FTCORE_ENC_UTF32){
+    // big endian: the character is in the high byte of a lane
+    const __m128i mask = _mm_set1_epi32((int)0x80FFFFFF);
+    for(; i + 4 <= units; i += 4){
+      __m128i v = _mm_loadu_si128((const __m128i*)(s + 4 * i));
+      int x;
+      if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, mask), zero)) != 0xFFFF){
+        break;
+      }
+      v = _mm_srli_epi32(v, 24);
+      v = _mm_packs_epi32(v, v);
+      v = _mm_packus_epi16(v, v);
+      x = _mm_cvtsi128_si32(v);
+      memcpy(d + i, &x, 4);
+    }
+  }else{
+    const __m128i mask = _mm_set1_epi16((short)(encoding == FTCORE_ENC_UTF16LE ? 0xFF80 : 0x80FF));
+    for(; i + 8 <= units; i += 8){
+      __m128i v = _mm_loadu_si128((const __m128i*)(s + 2 * i));
+      if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, mask), zero)) != 0xFFFF){
+        break;
+      }
+      if(encoding != FTCORE_ENC_UTF16LE){
+        v = _mm_srli_epi16(v, 8);
+      }
+      _mm_storel_epi64((__m128i*)(d + i), _mm_packus_epi16(v, v));
+    }
+  }
+#endif
+  for(; i < units; i++){
+    unsigned int u;
+    if(encoding == FTCORE_ENC_UTF32){
+      u = (unsigned int)s[4 * i] << 24 | (unsigned int)s[4 * i + 1] << 16 | (unsigned int)s[4 * i + 2] << 8 | s[4 * i + 3];
+    }else if(encoding == FTCORE_ENC_UTF16LE){
+      u = (unsigned int)s[2 * i + 1] << 8 | s[2 * i];
+    }else{
+      u = (unsigned int)s[2 * i] << 8 | s[2 * i + 1];
+    }
+    if(u >= 0x80){
+      break;
+    }
+    d[i] = (unsigned char)u;
+  }
+  return i;
+}
+
+/** @return bytes of the valid sequence at s, 0 for an invalid one, -1 for one cut off at e */
+static inline int ftconv_utf8_seq(const unsigned char *s, const unsigned char *e, ftcore_wc *wc){
+  int n, i;
+  ftcore_wc w;
+  if(s[0] < 0x80){
+    *wc = s[0];
+    return 1;
+  }
+  if(s[0] < 0xC2){ return 0; }
+  n = s[0] < 0xE0 ? 2 : s[0] < 0xF0 ? 3 : s[0] < 0xF5 ? 4 : 0;
+  if(!n){ return 0; }
+  if(e - s < n){ return -1; }
+  w = s[0] & (0x7F >> n);
+  for(i=1; i<n; i++){
+    if((s[i] & 0xC0) != 0x80){ return 0; }
+    w = (w << 6) | (s[i] & 0x3F);
+  }
+  if((n==3 && (w < 0x800 || (w >= 0xD800 && w <= 0xDFFF))) || (n==4 && (w < 0x10000 || w > 0x10FFFF))){
+    return 0;
+  }
+  *wc = w;
+  return n;
+}
+
+size_t ftconv_utf8_valid(const char *src, size_t length){
+  const unsigned char *s = (const unsigned char*)src;
+  size_t i = 0;
+  ftcore_wc wc;
+  while(i < length){
+    int n;
+    i += ftconv_ascii_bytes(s + i, length - i);
+    if(i >= length){
+      break;
+    }
+    n = ftconv_utf8_seq(s + i, s + length, &wc);
+    if(n <= 0){
+      break;
+    }
+    i += (size_t)n;
+  }
+  return i;
+}
+
+/** reads the character at s, '?' for an invalid one. @return bytes read, 0 for one cut off at e */
+static inline size_t ftconv_get(const struct ftconv_side *in, const unsigned char *s, const unsigned char *e, ftcore_wc *wc){
+  unsigned int u, v;
+  int n;
+  switch(in->encoding){
+    case FTCORE_ENC_UTF8:
+      n = ftconv_utf8_seq(s, e, wc);
+      if(n == 0){
+        *wc = '?';
+        return 1;
+      }
+      return n > 0 ? (size_t)n : 0;
+    case FTCORE_ENC_SBCS:
+      *wc = in->sbcs->to_uni[*s];
+      if(!*wc && *s){
+        *wc = '?';
+      }
+      return 1;
+    case FTCORE_ENC_UCS2:
+      if(e - s < 2){ return 0; }
+      u = (unsigned int)s[0] << 8 | s[1];
+      *wc = (u >= 0xD800 && u <= 0xDFFF) ? '?' : u;
+      return 2;
+    case FTCORE_ENC_UTF16:
+    case FTCORE_ENC_UTF16LE:
+      if(e - s < 2){ return 0; }
+      u = in->encoding == FTCORE_ENC_UTF16 ? (unsigned int)s[0] << 8 | s[1] : (unsigned int)s[1] << 8 | s[0];
+      if(u < 0xD800 || u > 0xDFFF){
+        *wc = u;
+        return 2;
+      }
+      if(u >= 0xDC00){
+        *wc = '?';
+        return 2;
+      }
+      if(e - s < 4){ return 0; }
+      v = in->encoding == FTCORE_ENC_UTF16 ? (unsigned int)s[2] << 8 | s[3] : (unsigned int)s[3] << 8 | s[2];
+      if(v < 0xDC00 || v > 0xDFFF){
+        *wc = '?';
+        return 2;
+      }
+      *wc = 0x10000 + ((u - 0xD800) << 10) + (v - 0xDC00);
+      return 4;
+    case FTCORE_ENC_UTF32:
+      if(e - s < 4){ return 0; }
+      u = (unsigned int)s[0] << 24 | (unsigned int)s[1] << 16 | (unsigned int)s[2] << 8 | s[3];
+      *wc = (u > 0x10FFFF || (u >= 0xD800 && u <= 0xDFFF)) ? '?' : u;
+      return 4;
+    default:
+      n = in->codec->decode(in->codec, wc, s, e);
+      if(n > 0){
+        return (size_t)n;
+      }
+      if(n == FTCORE_ILSEQ){
+        *wc = '?';
+        return 1;
+      }
+      return 0;
+  }
+}
+
+/** writes wc, or '?' if the codec has not got it. @return bytes written, 0 if it does not fit */
+static inline size_t ftconv_put(const struct ftconv_side *out, ftcore_wc wc, unsigned char *d, unsigned char *e){
+  const unsigned char *page;
+  int n;
+  if((wc >= 0xD800 && wc <= 0xDFFF) || wc > 0x10FFFF){
+    wc = '?';
+  }
+  switch(out->encoding){
+    case FTCORE_ENC_UTF8:
+      if(wc > 0xFFFF && !out->max4){
+        wc = '?';
+      }
+      if(wc < 0x80){
+        if(e - d < 1){ return 0; }
+        d[0] = (unsigned char)wc;
+        return 1;
+      }
+      if(wc < 0x800){
+        if(e - d < 2){ return 0; }
+        d[0] = (unsigned char)(0xC0 | (wc >> 6));
+        d[1] = (unsigned char)(0x80 | (wc & 0x3F));
+        return 2;
+      }
+      if(wc < 0x10000){
+        if(e - d < 3){ return 0; }
+        d[0] = (unsigned char)(0xE0 | (wc >> 12));
+        d[1] = (unsigned char)(0x80 | ((wc >> 6) & 0x3F));
+        d[2] = (unsigned char)(0x80 | (wc & 0x3F));
+        return 3;
+      }
+      if(e - d < 4){ return 0; }
+      d[0] = (unsigned char)(0xF0 | (wc >> 18));
+      d[1] = (unsigned char)(0x80 | ((wc >> 12) & 0x3F));
+      d[2] = (unsigned char)(0x80 | ((wc >> 6) & 0x3F));
+      d[3] = (unsigned char)(0x80 | (wc & 0x3F));
+      return 4;
+    case FTCORE_ENC_SBCS:
+      if(e - d < 1){ return 0; }
+      page = wc <= 0xFFFF ? out->sbcs->pages[wc >> 8] : NULL;
+      d[0] = page ? page[wc & 0xFF] : 0;
+      if(!d[0] && wc){
+        d[0] = '?';
+      }
+      return 1;
+    case FTCORE_ENC_UCS2:
+      if(e - d < 2){ return 0; }
+      if(wc > 0xFFFF){
+        wc = '?';
+      }
+      d[0] = (unsigned char)(wc >> 8);
+      d[1] = (unsigned char)wc;
+      return 2;
+    case FTCORE_ENC_UTF16:
+    case FTCORE_ENC_UTF16LE:
+      n = wc > 0xFFFF ? 4 : 2;
+      if(e - d < n){ return 0; }
+      if(n == 4){
+        unsigned int hi = 0xD800 + ((wc - 0x10000) >> 10);
+        unsigned int lo = 0xDC00 + ((wc - 0x10000) & 0x3FF);
+        if(out->encoding == FTCORE_ENC_UTF16){
+          d[0] = (unsigned char)(hi >> 8); d[1] = (unsigned char)hi;
+          d[2] = (unsigned char)(lo >> 8); d[3] = (unsigned char)lo;
+        }else{
+          d[0] = (unsigned char)hi; d[1] = (unsigned char)(hi >> 8);
+          d[2] = (unsigned char)lo; d[3] = (unsigned char)(lo >> 8);
+        }
+      }else if(out->encoding == FTCORE_ENC_UTF16){
+        d[0] = (unsigned char)(wc >> 8); d[1] = (unsigned char)wc;
+      }else{
+        d[0] = (unsigned char)wc; d[1] = (unsigned char)(wc >> 8);
+      }
+      return (size_t)n;
+    case FTCORE_ENC_UTF32:
+      if(e - d < 4){ return 0; }
+      d[0] = 0;
+      d[1] = (unsigned char)(wc >> 16);
+      d[2] = (unsigned char)(wc >> 8);
+      d[3] = (unsigned char)wc;
+      return 4;
+    default:
+      n = out->codec->encode(out->codec, wc, d, e);
+      if(n == FTCORE_ILSEQ){
+        n = out->codec->encode(out->codec, '?', d, e);
+      }
+      return n > 0 ? (size_t)n : 0;
+  }
+}
+
+/** moves the ASCII at the start of s. @return characters moved */
+static size_t ftconv_ascii(const struct ftconv_side *in, const unsigned char *s, const unsigned char *se,
+                           const struct ftconv_side *out, unsigned char *d, unsigned char *de){
+  size_t n, room;
+  if(in->unit == 1){
+    n = (size_t)(se - s);
+    room = (size_t)(de - d) / (size_t)out->unit;
+    n = ftconv_ascii_bytes(s, n < room ? n : room);
+    if(out->unit == 1){
+      memcpy(d, s, n);
+    }else{
+      ftconv_widen(s, n, d, out->encoding);
+    }
+    return n;
+  }
+  if(out->unit == 1){
+    n = (size_t)(se - s) / (size_t)in->unit;
+    room = (size_t)(de - d);
+    return ftconv_narrow(s, n < room ? n : room, d, in->encoding);
+  }
+  return 0;
+}
+
+size_t ftconv_convert(const FTCORE_CODEC *from, const char *src, size_t length,
+                      const FTCORE_CODEC *to, char *dst, size_t capacity){
+  const unsigned char *rpos = (const unsigned char*)src;
+  const unsigned char *rend = rpos + length;
+  unsigned char *wpos = (unsigned char*)dst;
+  unsigned char *wend = wpos + capacity;
+  struct ftconv_side in, out;
+  int copy, runs;
+  ftcore_wc wc;
+  ftconv_side_init(&in, from);
+  ftconv_side_init(&out, to);
+  // valid UTF-8 is copied as is, unless 4 byte sequences have to go
+  copy = in.encoding == FTCORE_ENC_UTF8 && out.encoding == FTCORE_ENC_UTF8 && out.max4;
+  runs = in.unit && out.unit && (in.unit == 1 || out.unit == 1);
+  while(rpos < rend){
+    size_t r, w;
+    if(copy){
+      r = (size_t)(rend - rpos);
+      w = (size_t)(wend - wpos);
+      r = ftconv_utf8_valid((const char*)rpos, r < w ? r : w);
+      memcpy(wpos, rpos, r);
+      rpos += r;
+      wpos += r;
+    }else if(runs){
+      r = ftconv_ascii(&in, rpos, rend, &out, wpos, wend);
+      rpos += r * (size_t)in.unit;
+      wpos += r * (size_t)out.unit;
+    }
+    if(rpos >= rend){
+      break;
+    }
+    r = ftconv_get(&in, rpos, rend, &wc);
+    if(!r){
+      break;
+    }
+    w = ftconv_put(&out, wc, wpos, wend);
+    if(!w){
+      break;
+    }
+    rpos += r;
+    wpos += w;
+  }
+  return (size_t)(wpos - (unsigned char*)dst);
+}
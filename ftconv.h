@@ -0,0 +1,34 @@
+#ifndef FTCONV_H
+#define FTCONV_H
+
+#include <stddef.h>
+#include "ftcore.h"
+
+/**
+ * Transcoding between codecs. UTF-8, UTF-16, UCS-2, UTF-32 and the single
+ * byte charsets with a to_uni table are read and written here, with runs of
+ * ASCII moved 16 bytes at a time; other codecs go through decode() and
+ * encode() one character at a time.
+ *
+ * A character that can not be read or written becomes '?'. A character cut
+ * off at the end of the input is dropped.
+ */
+
+/** @return bytes the conversion of length bytes can take at most */
+size_t ftconv_max_length(const FTCORE_CODEC *from, size_t length, const FTCORE_CODEC *to);
+
+/**
+ * Converts in one pass. Stops at the last character that fits capacity,
+ * which ftconv_max_length() always does.
+ * @return bytes written
+ */
+size_t ftconv_convert(const FTCORE_CODEC *from, const char *src, size_t length,
+                      const FTCORE_CODEC *to, char *dst, size_t capacity);
+
+/** @return bytes of the longest valid UTF-8 at the start of s */
+size_t ftconv_utf8_valid(const char *s, size_t length);
+
+/** frees the tables of the single byte charsets. no conversion may run. */
+void ftconv_deinit(void);
+
+#endif
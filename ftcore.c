@@ -0,0 +1,1496 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "ftcore.h"
+#include "ftbool.h"
+#include "ftstring.h"
+#include "ftpool.h"
+#include "ftslab.h"
+#include "ftconv.h"
+#include "ftbreak.h"
+#if HAVE_ICU
+#include <unicode/uclean.h>
+#include <unicode/uchar.h>
+#endif
+#include "ftnorm.h"
+#include "libstemmer_c/include/libstemmer.h"
+
+/** hooks */
+static FTCORE_HOOKS ftcore_hooks = { malloc, realloc, free, NULL, NULL };
+
+void* ftcore_malloc(size_t size){ return ftcore_hooks.malloc(size); }
+void* ftcore_realloc(void *ptr, size_t size){ return ftcore_hooks.realloc(ptr, size); }
+void  ftcore_free(void *ptr){ ftcore_hooks.free(ptr); }
+void  ftcore_thread_start(void){ if(ftcore_hooks.thread_start){ ftcore_hooks.thread_start(); } }
+void  ftcore_thread_end(void){ if(ftcore_hooks.thread_end){ ftcore_hooks.thread_end(); } }
+
+#if HAVE_ICU
+// ICU makes many small allocations, so they come from the slabs.
+static void  ftcore_icu_free(const void* context, void *ptr){ ftslab_free(ptr); }
+static void* ftcore_icu_malloc(const void* context, size_t size){ return ftslab_malloc(size); }
+static void* ftcore_icu_realloc(const void* context, void* ptr, size_t size){ return ftslab_realloc(ptr, size); }
+#endif
+/** /hooks */
+
+/** codecs */
+/**
+ * Word characters of the built-in codecs. ICU decides when it is there,
+ * otherwise everything but the punctuation and symbol blocks below is a
+ * letter.
+ */
+#if !HAVE_ICU
+static const ftcore_wc ftcore_nonword[][2] = {
+  {0x0080,0x00A9}, {0x00AB,0x00B4}, {0x00B6,0x00B9}, {0x00BB,0x00BF},
+  {0x00D7,0x00D7}, {0x00F7,0x00F7}, {0x2000,0x2BFF}, {0x3000,0x303F},
+  {0xFE30,0xFE4F}, {0xFF00,0xFF0F}, {0xFF1A,0xFF20}, {0xFF3B,0xFF40},
+  {0xFF5B,0xFF65}, {0xFFF0,0xFFFF}
+};
+#endif
+
+static int ftcore_uni_ctype(ftcore_wc wc){
+  if(wc < 0x80){
+    if((wc>='a' && wc<='z') || (wc>='A' && wc<='Z') || (wc>='0' && wc<='9') || wc=='_'){
+      return FTCORE_CT_WORD;
+    }
+    if(wc==' ' || (wc>='\t' && wc<='\r')){
+      return FTCORE_CT_SPACE;
+    }
+    return 0;
+  }
+  if(wc==0xA0 || wc==0x3000 || (wc>=0x2000 && wc<=0x200B) || wc==0x2028 || wc==0x2029 || wc==0x205F){
+    return FTCORE_CT_SPACE;
+  }
+#if HAVE_ICU
+  if(u_isalnum((UChar32)wc) || (U_GET_GC_MASK((UChar32)wc) & U_GC_M_MASK)){
+    return FTCORE_CT_WORD;
+  }
+  return 0;
+#else
+  size_t i;
+  for(i=0; i<sizeof(ftcore_nonword)/sizeof(ftcore_nonword[0]); i++){
+    if(wc >= ftcore_nonword[i][0] && wc <= ftcore_nonword[i][1]){
+      return 0;
+    }
+  }
+  return FTCORE_CT_WORD;
+#endif
+}
+
+static int utf8_decode(const FTCORE_CODEC *codec, ftcore_wc *wc, const unsigned char *s, const unsigned char *e){
+  int n, i;
+  ftcore_wc w;
+  if(s >= e){ return FTCORE_TOOSMALL; }
+  if(s[0] < 0x80){
+    *wc = s[0];
+    return 1;
+  }
+  if(s[0] < 0xC2){ return FTCORE_ILSEQ; }
+  n = s[0] < 0xE0 ? 2 : s[0] < 0xF0 ? 3 : s[0] < 0xF5 ? 4 : 0;
+  if(!n){ return FTCORE_ILSEQ; }
+  if(s + n > e){ return FTCORE_TOOSMALL; }
+  w = s[0] & (0x7F >> n);
+  for(i=1; i<n; i++){
+    if((s[i] & 0xC0) != 0x80){ return FTCORE_ILSEQ; }
+    w = (w << 6) | (s[i] & 0x3F);
+  }
+  if((n==3 && (w < 0x800 || (w >= 0xD800 && w <= 0xDFFF))) || (n==4 && (w < 0x10000 || w > 0x10FFFF))){
+    return FTCORE_ILSEQ;
+  }
+  *wc = w;
+  return n;
+}
+
+static int utf8_encode(const FTCORE_CODEC *codec, ftcore_wc wc, unsigned char *s, unsigned char *e){
+  int n, i;
+  if(wc < 0x80){
+    if(s >= e){ return FTCORE_TOOSMALL; }
+    *s = (unsigned char)wc;
+    return 1;
+  }
+  n = wc < 0x800 ? 2 : wc < 0x10000 ? 3 : wc <= 0x10FFFF ? 4 : 0;
+  if(!n){ return FTCORE_ILSEQ; }
+  if(s + n > e){ return FTCORE_TOOSMALL; }
+  for(i=n-1; i>0; i--){
+    s[i] = 0x80 | (wc & 0x3F);
+    wc >>= 6;
+  }
+  s[0] = (unsigned char)((0xF00 >> n) | wc);
+  return n;
+}
+
+static int utf8_ctype(const FTCORE_CODEC *codec, const unsigned char *s, const unsigned char *e, int *length){
+  ftcore_wc wc;
+  *length = utf8_decode(codec, &wc, s, e);
+  return *length > 0 ? ftcore_uni_ctype(wc) : 0;
+}
+
+/** latin1 as cp1252. the holes of 0x80-0x9F map to themselves, as in mysql. */
+static const unsigned short latin1_to_uni[256] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+  0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+  0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+  0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+  0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+  0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+  0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+  0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+  0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+  0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+  0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+  0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+  0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+  0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+  0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+  0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+  0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+  0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+  0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+  0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+  0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
+};
+
+static int latin1_decode(const FTCORE_CODEC *codec, ftcore_wc *wc, const unsigned char *s, const unsigned char *e){
+  if(s >= e){ return FTCORE_TOOSMALL; }
+  *wc = latin1_to_uni[s[0]];
+  return 1;
+}
+
+static int latin1_encode(const FTCORE_CODEC *codec, ftcore_wc wc, unsigned char *s, unsigned char *e){
+  int i;
+  if(s >= e){ return FTCORE_TOOSMALL; }
+  if(wc < 0x80 || (wc >= 0xA0 && wc <= 0xFF)){
+    *s = (unsigned char)wc;
+    return 1;
+  }
+  for(i=0x80; i<0xA0; i++){
+    if(latin1_to_uni[i] == wc){
+      *s = (unsigned char)i;
+      return 1;
+    }
+  }
+  return FTCORE_ILSEQ;
+}
+
+static int latin1_ctype(const FTCORE_CODEC *codec, const unsigned char *s, const unsigned char *e, int *length){
+  ftcore_wc wc;
+  *length = latin1_decode(codec, &wc, s, e);
+  return *length > 0 ? ftcore_uni_ctype(wc) : 0;
+}
+
+const FTCORE_CODEC ftcore_codec_utf8 = {
+  "utf8", "UTF_8", FTCORE_CODEC_UTF8, 4, utf8_decode, utf8_encode, utf8_ctype, NULL, FTCORE_ENC_UTF8, NULL
+};
+const FTCORE_CODEC ftcore_codec_latin1 = {
+  "latin1", "ISO_8859_1", 0, 1, latin1_decode, latin1_encode, latin1_ctype, NULL, FTCORE_ENC_SBCS, latin1_to_uni
+};
+
+const FTCORE_CODEC* ftcore_codec_get(const char *name){
+  if(strcmp(name, "utf8")==0 || strcmp(name, "utf8mb3")==0 || strcmp(name, "utf8mb4")==0){
+    return &ftcore_codec_utf8;
+  }
+  if(strcmp(name, "latin1")==0){
+    return &ftcore_codec_latin1;
+  }
+  return NULL;
+}
+
+/** /codecs */
+
+/** token streams */
+char* ftcore_tokens_push(FTCORE_TOKENS *tokens, size_t length, size_t limit){
+  size_t required = tokens->length + sizeof(unsigned int) + length;
+  if(limit && required > limit){
+    return NULL;
+  }
+  if(required > tokens->capacity){
+    size_t sz = tokens->capacity ? tokens->capacity : 256;
+    while(sz < required){
+      sz = sz<<1;
+    }
+    char *tmp = tokens->data ? ftcore_realloc(tokens->data, sz) : ftcore_malloc(sz);
+    if(!tmp){
+      return NULL;
+    }
+    tokens->data = tmp;
+    tokens->capacity = sz;
+  }
+  unsigned int len = (unsigned int)length;
+  char *pos = tokens->data + tokens->length;
+  memcpy(pos, &len, sizeof(unsigned int));
+  tokens->length = required;
+  return pos + sizeof(unsigned int);
+}
+
+int ftcore_tokens_emit(const char *pos, size_t length, ftcore_sink sink, void *ctx){
+  const char *end = pos + length;
+  while(pos < end){
+    unsigned int tlen;
+    memcpy(&tlen, pos, sizeof(unsigned int));
+    pos += sizeof(unsigned int);
+    int ret = sink(ctx, pos, tlen, NULL);
+    if(ret){
+      return ret;
+    }
+    pos += tlen;
+  }
+  return 0;
+}
+
+void ftcore_tokens_free(FTCORE_TOKENS *tokens){
+  if(tokens->data){ ftcore_free(tokens->data); }
+  tokens->data = NULL;
+  tokens->length = tokens->capacity = 0;
+}
+
+/** ftcore_sink appending to an FTCORE_TOKENS */
+static int ftcore_tokens_sink(void *ctx, const char *word, size_t length, const FTCORE_BOOLEAN_INFO *info){
+  char *pos = ftcore_tokens_push((FTCORE_TOKENS*)ctx, length, 0);
+  if(!pos){
+    return FTCORE_MEMORY_ERROR;
+  }
+  memcpy(pos, word, length);
+  return 0;
+}
+/** /token streams */
+
+/** stemmer scratch */
+struct ftcore_scratch_node {
+  struct sb_stemmer_scratch scratch; // first, the thread key points at it
+  struct ftcore_scratch_node *next;  // in ftcore_scratches
+};
+
+static pthread_key_t ftcore_scratch_key;
+static pthread_mutex_t ftcore_scratch_lock = PTHREAD_MUTEX_INITIALIZER;
+/** the scratches of all threads, as pthread_key_delete() runs no destructors */
+static struct ftcore_scratch_node *ftcore_scratches = NULL;
+
+static void ftcore_scratch_release(struct ftcore_scratch_node *node){
+  sb_stemmer_scratch_release(&node->scratch);
+  ftcore_free(node);
+}
+
+/** thread exit. the scratch may be gone already, with ftcore_deinit(). */
+static void ftcore_scratch_free(void *ptr){
+  struct ftcore_scratch_node **p;
+  pthread_mutex_lock(&ftcore_scratch_lock);
+  for(p = &ftcore_scratches; *p && *p != (struct ftcore_scratch_node*)ptr; p = &(*p)->next);
+  if(*p){
+    *p = (*p)->next;
+  }else{
+    ptr = NULL;
+  }
+  pthread_mutex_unlock(&ftcore_scratch_lock);
+  if(ptr){
+    ftcore_scratch_release((struct ftcore_scratch_node*)ptr);
+  }
+}
+
+/**
+ * Stemmer work areas are kept per thread rather than per parser, so every
+ * parser can share one module handle.
+ */
+static struct sb_stemmer_scratch* ftcore_scratch(){
+  struct ftcore_scratch_node *node = (struct ftcore_scratch_node*)pthread_getspecific(ftcore_scratch_key);
+  if(!node){
+    struct sb_stemmer_scratch tmp = SB_STEMMER_SCRATCH_INIT;
+    node = (struct ftcore_scratch_node*)ftcore_malloc(sizeof(struct ftcore_scratch_node));
+    if(!node){ return NULL; }
+    node->scratch = tmp;
+    if(pthread_setspecific(ftcore_scratch_key, node)){
+      ftcore_free(node);
+      return NULL;
+    }
+    pthread_mutex_lock(&ftcore_scratch_lock);
+    node->next = ftcore_scratches;
+    ftcore_scratches = node;
+    pthread_mutex_unlock(&ftcore_scratch_lock);
+  }
+  return &node->scratch;
+}
+/** /stemmer scratch */
+
+int ftcore_init(const FTCORE_HOOKS *hooks, unsigned int threads){
+  if(hooks){
+    ftcore_hooks = *hooks;
+#if HAVE_ICU
+    UErrorCode ustatus = U_ZERO_ERROR;
+    u_setMemoryFunctions(NULL, ftcore_icu_malloc, ftcore_icu_realloc, ftcore_icu_free, &ustatus);
+    if(U_FAILURE(ustatus)){
+      char errstr[128];
+      sprintf(errstr, "u_setMemoryFunctions failed. ICU status code %d\n", ustatus);
+      fputs(errstr, stderr);
+      fflush(stderr);
+    }
+#endif
+  }
+  if(ftslab_init()){
+    return -1;
+  }
+  // the stemming environments are small and live as long as a scratch.
+  sb_stemmer_set_allocator(ftslab_malloc, ftslab_realloc, ftslab_free);
+  if(pthread_key_create(&ftcore_scratch_key, ftcore_scratch_free)){
+    ftslab_deinit();
+    return -1;
+  }
+  if(ftbreak_init()){
+    pthread_key_delete(ftcore_scratch_key);
+    ftslab_deinit();
+    return -1;
+  }
+  ftpool_init(threads);
+  return 0;
+}
+
+void ftcore_deinit(void){
+  struct ftcore_scratch_node *node;
+  ftpool_deinit(); // workers release their scratches on exit.
+  // deleting the key keeps the destructors from running after the code is
+  // unloaded; the scratches of the other threads are released here.
+  pthread_key_delete(ftcore_scratch_key);
+  pthread_mutex_lock(&ftcore_scratch_lock);
+  node = ftcore_scratches;
+  ftcore_scratches = NULL;
+  pthread_mutex_unlock(&ftcore_scratch_lock);
+  while(node){
+    struct ftcore_scratch_node *next = node->next;
+    ftcore_scratch_release(node);
+    node = next;
+  }
+  ftbreak_deinit();
+  ftconv_deinit();
+  ftslab_deinit();
+}
+
+/** parser */
+struct ftcore_buf {
+  char*  data;
+  size_t capacity;
+};
+
+static int ftcore_buf_reserve(struct ftcore_buf *buf, size_t length){
+  if(length > buf->capacity){
+    size_t sz = buf->capacity ? buf->capacity : 64;
+    while(sz < length){
+      sz = sz<<1;
+    }
+    char *tmp = buf->data ? ftcore_realloc(buf->data, sz) : ftcore_malloc(sz);
+    if(!tmp){
+      return -1;
+    }
+    buf->data = tmp;
+    buf->capacity = sz;
+  }
+  return 0;
+}
+
+/** what a thread needs to stem, shared read-only by the segments of a document */
+typedef struct _ftcore_engine {
+  const struct sb_stemmer_module *module;
+  const char *encoding;      // libstemmer name of the charset the module stems
+  const FTCORE_CODEC *codec; // the charset the module stems
+  const FTCORE_CODEC *out;   // the charset of the tokens
+  const FTDICT_SECTION *dict; // stems of the module, or NULL
+  int convert;
+  int surface;
+  int unaccent;
+  enum ftcore_tokenizer tokenizer;
+  size_t max_token_bytes;
+  int drop;
+  int emit;
+  unsigned int edge_min;
+  unsigned int edge_max;
+  int budget_skip;
+} FTCORE_ENGINE;
+
+/** clock checks of a document, kept by each thread that stems it */
+struct ftcore_budget {
+  unsigned long long deadline; // 0 for no budget
+  unsigned int countdown;      // words until the next look at the clock
+  int exceeded;
+};
+
+/** words stemmed between looks at the clock */
+#define FTCORE_BUDGET_INTERVAL 64
+
+unsigned long long ftcore_now_us(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000ULL + (unsigned long long)ts.tv_nsec / 1000;
+}
+
+static void ftcore_budget_start(struct ftcore_budget *budget, unsigned long time_budget_us){
+  budget->deadline = time_budget_us ? ftcore_now_us() + time_budget_us : 0;
+  budget->countdown = FTCORE_BUDGET_INTERVAL;
+  budget->exceeded = 0;
+}
+
+/** @return whether the document is over its budget. Costs a clock read every FTCORE_BUDGET_INTERVAL calls. */
+static int ftcore_budget_check(struct ftcore_budget *budget){
+  if(budget->deadline && !budget->exceeded && --budget->countdown == 0){
+    budget->countdown = FTCORE_BUDGET_INTERVAL;
+    budget->exceeded = ftcore_now_us() >= budget->deadline;
+  }
+  return budget->exceeded;
+}
+
+struct _ftcore_parser {
+  FTCORE_ENGINE engine;
+  /** what the engine was chosen for */
+  const FTCORE_CODEC *feed_codec;
+  const FTCORE_CODEC *utf8;
+  const FTDICT *dictionary;
+  unsigned long generation;
+  char* algorithm;
+  /** the last document ran out of its time budget */
+  int over_budget;
+  FTCORE_PHASES phases;
+  /** stems converted into the output charset */
+  struct ftcore_buf stem;
+};
+
+FTCORE_PARSER* ftcore_parser_new(void){
+  FTCORE_PARSER *parser = (FTCORE_PARSER*)ftcore_malloc(sizeof(FTCORE_PARSER));
+  if(parser){
+    memset(parser, 0, sizeof(FTCORE_PARSER));
+  }
+  return parser;
+}
+
+int ftcore_parser_over_budget(const FTCORE_PARSER *parser){
+  return parser->over_budget;
+}
+
+const FTCORE_PHASES* ftcore_parser_phases(const FTCORE_PARSER *parser){
+  return &parser->phases;
+}
+
+void ftcore_parser_free(FTCORE_PARSER *parser){
+  if(!parser){ return; }
+  if(parser->algorithm){ ftcore_free(parser->algorithm); }
+  if(parser->stem.data){ ftcore_free(parser->stem.data); }
+  ftcore_free(parser);
+}
+
+/** @return the dictionary section made for module, or NULL */
+static const FTDICT_SECTION* ftcore_dict_section(const FTDICT *dict, const struct sb_stemmer_module *module,
+                                                 const char *encoding){
+  unsigned int i;
+  for(i=0; dict && i<ftdict_sections(dict); i++){
+    const FTDICT_SECTION *section = ftdict_section(dict, i);
+    // sections are matched by module, so that aliases of the algorithm share one.
+    if(strcmp(ftdict_section_encoding(section), encoding) == 0
+        && sb_stemmer_module_get(ftdict_section_algorithm(section), encoding) == module){
+      return section;
+    }
+  }
+  return NULL;
+}
+
+/** picks the stemming module for text in cs, stemming it as is if possible. */
+static int ftcore_engine_select(FTCORE_PARSER *parser, const FTCORE_CONFIG *config, const char *algorithm,
+                                const FTCORE_CODEC *cs, const FTCORE_CODEC *utf8, const FTCORE_CODEC *out){
+  FTCORE_ENGINE *engine = &parser->engine;
+  const FTDICT *dictionary = config->dictionary;
+  if(!engine->module || parser->feed_codec != cs || parser->utf8 != utf8
+      || (config->generation ? parser->generation != config->generation
+          : (parser->dictionary != dictionary || strcmp(parser->algorithm, algorithm) != 0))){
+    const struct sb_stemmer_module *st = NULL;
+    size_t len = strlen(algorithm);
+    char *tmp = (char*)ftcore_malloc(len + 1);
+    if(!tmp){
+      return FTCORE_MEMORY_ERROR;
+    }
+    memcpy(tmp, algorithm, len + 1);
+    if(parser->algorithm){ ftcore_free(parser->algorithm); }
+    parser->algorithm = tmp;
+    parser->feed_codec = cs;
+    parser->utf8 = utf8;
+    parser->dictionary = dictionary;
+    parser->generation = config->generation;
+    engine->module = NULL;
+    if(cs->stemmer_encoding){
+      st = sb_stemmer_module_get(algorithm, cs->stemmer_encoding);
+      engine->codec = cs;
+      engine->encoding = cs->stemmer_encoding;
+    }
+    if(!st){ // if engine was not available, we'll transcode.
+      st = sb_stemmer_module_get(algorithm, "UTF_8");
+      engine->codec = utf8;
+      engine->encoding = "UTF_8";
+    }
+    if(!st){
+      return FTCORE_CONFIG_ERROR;
+    }
+    engine->module = st;
+    engine->dict = ftcore_dict_section(dictionary, st, engine->encoding);
+  }
+  engine->out = out;
+  engine->convert = strcmp(engine->codec->name, out->name) != 0;
+  return 0;
+}
+
+/**
+ * Tells the tokens the stemmer has nothing to do with. Stemmed charsets are
+ * ASCII compatible, so bytes can be tested. Stops at the first byte that is
+ * not a hex digit, so most words cost a byte or two.
+ * @return FTCORE_CLASS_* or 0 for a word to stem
+ */
+static int ftcore_classify(const char *word, size_t length, size_t max_bytes){
+  int digits = 0, letters = 0;
+  size_t i;
+  if(max_bytes && length > max_bytes){
+    return FTCORE_CLASS_OVERLONG;
+  }
+  for(i=0; i<length; i++){
+    unsigned char c = (unsigned char)word[i];
+    if(c>='0' && c<='9'){
+      digits = 1;
+    }else if((c>='a' && c<='f') || (c>='A' && c<='F')){
+      letters = 1;
+    }else{
+      return 0;
+    }
+  }
+  if(!letters){
+    return FTCORE_CLASS_NUMERIC;
+  }
+  if(digits && length >= 8){
+    return FTCORE_CLASS_HEX;
+  }
+  return 0;
+}
+
+/** @return bytes of the whole characters of word that fit in max_bytes */
+static size_t ftcore_truncate(const FTCORE_CODEC *cs, const char *word, size_t max_bytes){
+  const unsigned char *pos = (const unsigned char*)word;
+  const unsigned char *end = pos + max_bytes;
+  ftcore_wc wc;
+  if(cs->mbmaxlen == 1){
+    return max_bytes;
+  }
+  while(pos < end){
+    int readsize = cs->decode(cs, &wc, pos, end);
+    if(readsize < 0){
+      break; // the next character does not fit.
+    }
+    pos += readsize > 0 ? readsize : 1;
+  }
+  return (size_t)(pos - (const unsigned char*)word);
+}
+
+/**
+ * Hands a token in the charset of the stemmer to the sink, in the output
+ * charset and behind marks FTCORE_MARK characters. Accents are stripped
+ * last, from the converted token, behind it in buf. What the sink gets is
+ * cut to max_token_bytes, marks included.
+ */
+static int ftcore_emit_token(const FTCORE_ENGINE *engine, struct ftcore_buf *buf,
+                             const char *thead, size_t tlen, int marks,
+                             const FTCORE_BOOLEAN_INFO *info, ftcore_sink sink, void *ctx){
+  size_t cv_length = tlen;
+  size_t head = 0; // bytes of the markers
+  if(!marks && !engine->convert && !engine->unaccent){
+    if(engine->max_token_bytes && tlen > engine->max_token_bytes){
+      tlen = ftcore_truncate(engine->out, thead, engine->max_token_bytes);
+    }
+    return sink(ctx, thead, tlen, info);
+  }
+  if(engine->convert){
+    cv_length = ftconv_max_length(engine->codec, tlen, engine->out);
+  }
+  if(ftcore_buf_reserve(buf, 4 * (size_t)marks + (engine->unaccent ? cv_length * 2 : cv_length))){
+    return FTCORE_MEMORY_ERROR;
+  }
+  while(marks-- > 0){
+    int n = engine->out->encode(engine->out, FTCORE_MARK, (unsigned char*)buf->data + head, (unsigned char*)buf->data + head + 4);
+    head += n > 0 ? (size_t)n : 0;
+  }
+  if(engine->convert){
+    tlen = ftconv_convert(engine->codec, thead, tlen, engine->out, buf->data + head, cv_length);
+    thead = buf->data + head;
+  }
+  if(engine->unaccent){
+    char *unaccented = thead == buf->data + head ? buf->data + head + tlen : buf->data + head;
+    tlen = uni_unaccent(engine->out, thead, tlen, unaccented, tlen);
+    thead = unaccented;
+  }
+  if(head){
+    if(thead != buf->data + head){
+      memmove(buf->data + head, thead, tlen);
+    }
+    thead = buf->data;
+    tlen += head;
+  }
+  if(engine->max_token_bytes && tlen > engine->max_token_bytes){
+    tlen = ftcore_truncate(engine->out, thead, engine->max_token_bytes);
+  }
+  return sink(ctx, thead, tlen, info);
+}
+
+/** n-grams */
+/** @return bytes of the character at s, at least 1 */
+static size_t ftcore_char_length(const FTCORE_CODEC *cs, const char *s, const char *e){
+  ftcore_wc wc;
+  int n;
+  if(cs->mbmaxlen == 1){
+    return 1;
+  }
+  n = cs->decode(cs, &wc, (const unsigned char*)s, (const unsigned char*)e);
+  return n > 0 ? (size_t)n : 1;
+}
+
+/** @return whether word is long enough for the n-grams of kind, FTCORE_EMIT_EDGE or FTCORE_EMIT_TRIGRAM */
+static int ftcore_ngram_fits(const FTCORE_ENGINE *engine, int kind, const char *word, size_t length){
+  const char *e = word + length;
+  unsigned int n, min = kind == FTCORE_EMIT_EDGE ? engine->edge_min : 3;
+  for(n=0; n<min && word<e; n++){
+    word += ftcore_char_length(engine->codec, word, e);
+  }
+  return n >= min;
+}
+
+/**
+ * Emits the prefixes of a word from edge_min to edge_max characters. In
+ * boolean mode the word is a prefix to look up, the longest of them.
+ */
+static int ftcore_emit_edges(const FTCORE_ENGINE *engine, struct ftcore_buf *buf,
+                             const char *word, size_t length,
+                             const FTCORE_BOOLEAN_INFO *info, ftcore_sink sink, void *ctx){
+  const char *e = word + length;
+  const char *p = word;
+  unsigned int n = 0;
+  int ret = 0;
+  while(p < e && n < engine->edge_max && !ret){
+    p += ftcore_char_length(engine->codec, p, e);
+    if(++n >= engine->edge_min && !info){
+      ret = ftcore_emit_token(engine, buf, word, (size_t)(p - word), FTCORE_MARKS_EDGE, NULL, sink, ctx);
+    }
+  }
+  if(info && n >= engine->edge_min){
+    ret = ftcore_emit_token(engine, buf, word, (size_t)(p - word), FTCORE_MARKS_EDGE, info, sink, ctx);
+  }
+  return ret;
+}
+
+/**
+ * Emits every three characters of a word. In boolean mode the word is a
+ * part to look up: its trigrams are a group, each of them required.
+ */
+static int ftcore_emit_trigrams(const FTCORE_ENGINE *engine, struct ftcore_buf *buf,
+                                const char *word, size_t length,
+                                const FTCORE_BOOLEAN_INFO *info, ftcore_sink sink, void *ctx){
+  const FTCORE_CODEC *cs = engine->codec;
+  const char *e = word + length;
+  const char *a = word, *b, *c, *d;
+  FTCORE_BOOLEAN_INFO group, gram = { FTCORE_TOKEN_WORD, 1, 0, 0, 0, 0, 0, 0 };
+  const FTCORE_BOOLEAN_INFO *ginfo = info;
+  int ret = 0;
+  if((b = a + ftcore_char_length(cs, a, e)) >= e || (c = b + ftcore_char_length(cs, b, e)) >= e){
+    return 0; // shorter than a trigram.
+  }
+  d = c + ftcore_char_length(cs, c, e);
+  if(info && d < e){
+    group = *info;
+    group.type = FTCORE_TOKEN_LEFT_PAREN;
+    group.trunc = 0;
+    ret = sink(ctx, word, 0, &group);
+    ginfo = &gram;
+  }
+  while(!ret){
+    ret = ftcore_emit_token(engine, buf, a, (size_t)(d - a), FTCORE_MARKS_TRIGRAM, ginfo, sink, ctx);
+    if(d >= e){
+      break;
+    }
+    a = b;
+    b = c;
+    c = d;
+    d += ftcore_char_length(cs, d, e);
+  }
+  if(ginfo == &gram && !ret){
+    group.type = FTCORE_TOKEN_RIGHT_PAREN;
+    ret = sink(ctx, word, 0, &group);
+  }
+  return ret;
+}
+/** /n-grams */
+
+/**
+ * Stems a word and hands the stem, in the output charset, to the sink,
+ * with the tokens of engine->emit. Over the time budget, words are handed
+ * over unstemmed or not at all.
+ */
+static int ftcore_emit_stem(const FTCORE_ENGINE *engine, struct sb_stemmer_scratch *scratch,
+                            struct ftcore_buf *buf, struct ftcore_budget *budget,
+                            const char *word, size_t length,
+                            const FTCORE_BOOLEAN_INFO *info, ftcore_sink sink, void *ctx){
+  while(engine->emit && length && *word == FTCORE_MARK){
+    word++;
+    length--;
+  }
+  if(length == 0){
+    return 0;
+  }
+  int over_budget = ftcore_budget_check(budget);
+  if(over_budget && engine->budget_skip){
+    return 0;
+  }
+  size_t tlen = length;
+  const char *thead = word;
+  int token_class = ftcore_classify(word, length, engine->max_token_bytes);
+  if(token_class){
+    if(engine->drop & token_class){
+      return 0;
+    }
+    if(token_class == FTCORE_CLASS_OVERLONG){
+      tlen = ftcore_truncate(engine->codec, word, engine->max_token_bytes);
+    }
+  }else if(engine->surface || over_budget){
+    // as it is.
+  }else if(!engine->dict || !(thead = ftdict_lookup(engine->dict, word, length, &tlen))){
+    const sb_symbol * sym = sb_stemmer_module_stem(engine->module, scratch, (const sb_symbol*)word, (int)length);
+    if(!sym){
+      // stemming failed.
+      return 0;
+    }
+    tlen = (size_t)sb_stemmer_scratch_length(scratch);
+    thead = (const char*)sym;
+  }
+  // a word too short for its n-grams is looked up as a word.
+  if(info && (info->ngram & engine->emit) && ftcore_ngram_fits(engine, info->ngram, word, length)){
+    if(info->ngram == FTCORE_EMIT_EDGE){
+      return ftcore_emit_edges(engine, buf, word, length, info, sink, ctx);
+    }
+    return ftcore_emit_trigrams(engine, buf, word, length, info, sink, ctx);
+  }
+  int ret;
+  if(!token_class && (engine->emit & FTCORE_EMIT_SURFACE)
+      && (tlen != length || memcmp(thead, word, length) != 0)){
+    if(info && info->exact){
+      return ftcore_emit_token(engine, buf, word, length, FTCORE_MARKS_SURFACE, info, sink, ctx);
+    }
+    ret = ftcore_emit_token(engine, buf, thead, tlen, 0, info, sink, ctx);
+    if(!ret){
+      ret = ftcore_emit_token(engine, buf, word, length, FTCORE_MARKS_SURFACE, info, sink, ctx);
+    }
+  }else{
+    ret = ftcore_emit_token(engine, buf, thead, tlen, 0, info, sink, ctx);
+  }
+  if(info || over_budget || token_class == FTCORE_CLASS_OVERLONG){
+    return ret; // n-grams are indexed, and looked up by their operators.
+  }
+  if(!ret && (engine->emit & FTCORE_EMIT_EDGE)){
+    ret = ftcore_emit_edges(engine, buf, word, length, NULL, sink, ctx);
+  }
+  if(!ret && (engine->emit & FTCORE_EMIT_TRIGRAM)){
+    ret = ftcore_emit_trigrams(engine, buf, word, length, NULL, sink, ctx);
+  }
+  return ret;
+}
+
+/** CJK bigrams */
+/** scripts written without spaces between the words */
+static const ftcore_wc ftcore_cjk_ranges[][2] = {
+  {0x1100,0x11FF}, {0x3040,0x30FF}, {0x3130,0x318F}, {0x31F0,0x31FF},
+  {0x3400,0x4DBF}, {0x4E00,0x9FFF}, {0xAC00,0xD7AF}, {0xF900,0xFAFF},
+  {0xFF66,0xFF9F}, {0x20000,0x3FFFF}
+};
+
+/** @return bytes of the CJK character at s in UTF-8, 0 for any other */
+static int ftcore_cjk(const unsigned char *s, const unsigned char *e){
+  ftcore_wc wc;
+  size_t i;
+  if(s[0] < 0xE1){ // below U+1000
+    return 0;
+  }
+  int n = utf8_decode(NULL, &wc, s, e);
+  if(n <= 0){
+    return 0;
+  }
+  for(i=0; i<sizeof(ftcore_cjk_ranges)/sizeof(ftcore_cjk_ranges[0]); i++){
+    if(wc >= ftcore_cjk_ranges[i][0] && wc <= ftcore_cjk_ranges[i][1]){
+      return n;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Emits a run of CJK characters as overlapping bigrams, or a lone character
+ * as it is. In boolean mode bigrams more than one are a phrase.
+ */
+static int ftcore_emit_bigrams(const FTCORE_ENGINE *engine, struct ftcore_buf *buf, struct ftcore_budget *budget,
+                               const char *run, size_t length,
+                               const FTCORE_BOOLEAN_INFO *info, ftcore_sink sink, void *ctx){
+  const unsigned char *a = (const unsigned char*)run;
+  const unsigned char *e = a + length;
+  const unsigned char *b = a + ftcore_cjk(a, e);
+  FTCORE_BOOLEAN_INFO phrase, gram = { FTCORE_TOKEN_WORD, 0, 0, 0, 0, 1, 0, 0 };
+  int ret = 0;
+  if(budget->exceeded && engine->budget_skip){
+    return 0;
+  }
+  if(b == e || b + ftcore_cjk(b, e) == e){
+    return ftcore_emit_token(engine, buf, run, length, 0, info, sink, ctx);
+  }
+  if(info){
+    phrase = *info;
+    phrase.type = FTCORE_TOKEN_LEFT_PAREN;
+    phrase.trunc = 0;
+    phrase.quot = 1;
+    ret = sink(ctx, run, 0, &phrase);
+  }
+  while(b < e && !ret){
+    const unsigned char *c = b + ftcore_cjk(b, e);
+    ret = ftcore_emit_token(engine, buf, (const char*)a, (size_t)(c - a), 0, info ? &gram : NULL, sink, ctx);
+    a = b;
+    b = c;
+  }
+  if(info && !ret){
+    phrase.type = FTCORE_TOKEN_RIGHT_PAREN;
+    ret = sink(ctx, run, 0, &phrase);
+  }
+  return ret;
+}
+
+/** ICU words */
+/**
+ * Stems the words ICU finds in a boolean mode word, as a phrase if there
+ * are more than one.
+ */
+static int ftcore_emit_segments(const FTCORE_ENGINE *engine, struct sb_stemmer_scratch *scratch,
+                                struct ftcore_buf *buf, struct ftcore_budget *budget,
+                                const char *word, size_t length,
+                                const FTCORE_BOOLEAN_INFO *info, ftcore_sink sink, void *ctx){
+  FTBREAK *br = ftbreak_open(word, length);
+  FTCORE_BOOLEAN_INFO phrase, gram = { FTCORE_TOKEN_WORD, 0, 0, 0, 0, 1, 0, 0 };
+  const char *first, *w;
+  size_t first_length, wlen;
+  int ret;
+  if(!br){
+    return ftcore_emit_stem(engine, scratch, buf, budget, word, length, info, sink, ctx);
+  }
+  if(!ftbreak_next(br, &first, &first_length)){
+    ftbreak_close(br);
+    return 0;
+  }
+  if(!ftbreak_next(br, &w, &wlen)){
+    ftbreak_close(br);
+    return ftcore_emit_stem(engine, scratch, buf, budget, first, first_length, info, sink, ctx);
+  }
+  phrase = *info;
+  phrase.type = FTCORE_TOKEN_LEFT_PAREN;
+  phrase.trunc = 0;
+  phrase.quot = 1;
+  ret = sink(ctx, word, 0, &phrase);
+  if(!ret){
+    ret = ftcore_emit_stem(engine, scratch, buf, budget, first, first_length, &gram, sink, ctx);
+  }
+  do{
+    if(!ret){
+      ret = ftcore_emit_stem(engine, scratch, buf, budget, w, wlen, &gram, sink, ctx);
+    }
+  }while(!ret && ftbreak_next(br, &w, &wlen));
+  ftbreak_close(br);
+  if(!ret){
+    phrase.type = FTCORE_TOKEN_RIGHT_PAREN;
+    ret = sink(ctx, word, 0, &phrase);
+  }
+  return ret;
+}
+
+/** stems the words ICU finds in a natural mode document */
+static int ftcore_parse_icu(const FTCORE_ENGINE *engine, FTBREAK *br, struct sb_stemmer_scratch *scratch,
+                            struct ftcore_buf *buf, struct ftcore_budget *budget, ftcore_sink sink, void *ctx){
+  const char *word;
+  size_t length;
+  int ret = 0;
+  while(!ret && ftbreak_next(br, &word, &length)){
+    ret = ftcore_emit_stem(engine, scratch, buf, budget, word, length, NULL, sink, ctx);
+    if(budget->exceeded && engine->budget_skip){
+      break;
+    }
+  }
+  ftbreak_close(br);
+  return ret;
+}
+/** /ICU words */
+
+/**
+ * Emits a word. With the CJK bigram tokenizer, the CJK runs in it become
+ * bigrams and the rest is stemmed. With the ICU tokenizer, a boolean mode
+ * word is segmented by ICU.
+ */
+static int ftcore_emit_word(const FTCORE_ENGINE *engine, struct sb_stemmer_scratch *scratch,
+                            struct ftcore_buf *buf, struct ftcore_budget *budget,
+                            const char *word, size_t length,
+                            const FTCORE_BOOLEAN_INFO *info, ftcore_sink sink, void *ctx){
+  const unsigned char *s = (const unsigned char*)word;
+  const unsigned char *e = s + length;
+  const unsigned char *p = s;
+  FTCORE_BOOLEAN_INFO part;
+  int ret = 0;
+  if(engine->tokenizer == FTCORE_TOKENIZER_ICU && info && (engine->codec->flags & FTCORE_CODEC_UTF8)){
+    return ftcore_emit_segments(engine, scratch, buf, budget, word, length, info, sink, ctx);
+  }
+  if(engine->tokenizer == FTCORE_TOKENIZER_CJK_BIGRAM && (engine->codec->flags & FTCORE_CODEC_UTF8)){
+    while(p < e && *p < 0xE1){
+      p++;
+    }
+  }else{
+    p = e;
+  }
+  if(p == e){
+    return ftcore_emit_stem(engine, scratch, buf, budget, word, length, info, sink, ctx);
+  }
+  while(s < e && !ret){
+    int cjk = ftcore_cjk(s, e) > 0;
+    int n;
+    p = s;
+    while(p < e && ((n = ftcore_cjk(p, e)) > 0) == cjk){
+      p += n > 0 ? n : 1;
+    }
+    if(info){
+      part = *info;
+      part.trunc = p == e && info->trunc; // the operator is after the last run
+    }
+    if(cjk){
+      ret = ftcore_emit_bigrams(engine, buf, budget, (const char*)s, (size_t)(p - s), info ? &part : NULL, sink, ctx);
+    }else{
+      ret = ftcore_emit_stem(engine, scratch, buf, budget, (const char*)s, (size_t)(p - s), info ? &part : NULL, sink, ctx);
+    }
+    s = p;
+  }
+  return ret;
+}
+/** /CJK bigrams */
+
+static int ftcore_parse_natural(const FTCORE_ENGINE *engine, struct sb_stemmer_scratch *scratch,
+                                struct ftcore_buf *buf, struct ftcore_budget *budget,
+                                char *feed, size_t feed_length, ftcore_sink sink, void *ctx){
+  const FTCORE_CODEC *cs = engine->codec;
+  char *word = NULL;
+  char *s = feed;
+  char *e = feed + feed_length;
+  int ret = 0;
+  if(engine->tokenizer == FTCORE_TOKENIZER_ICU && (cs->flags & FTCORE_CODEC_UTF8)){
+    FTBREAK *br = ftbreak_open(feed, feed_length);
+    if(br){ // or the word characters, as without ICU
+      return ftcore_parse_icu(engine, br, scratch, buf, budget, sink, ctx);
+    }
+  }
+  while(s < e){
+    int readsize;
+    if(cs->ctype(cs, (unsigned char*)s, (unsigned char*)e, &readsize) & FTCORE_CT_WORD){
+      if(!word){ word = s; }
+    }else if(word){
+      ret = ftcore_emit_word(engine, scratch, buf, budget, word, (size_t)(s - word), NULL, sink, ctx);
+      if(ret){
+        return ret;
+      }
+      if(budget->exceeded && engine->budget_skip){
+        return 0;
+      }
+      word = NULL;
+    }
+    s += readsize > 0 ? readsize : 1;
+  }
+  if(word){
+    ret = ftcore_emit_word(engine, scratch, buf, budget, word, (size_t)(e - word), NULL, sink, ctx);
+  }
+  return ret;
+}
+
+static int ftcore_parse_boolean(const FTCORE_ENGINE *engine, struct sb_stemmer_scratch *scratch,
+                                struct ftcore_buf *buf, struct ftcore_budget *budget, char *feed, size_t feed_length, int feed_req_free,
+                                ftcore_sink sink, void *ctx){
+  const FTCORE_CODEC *cs = engine->codec;
+  const FTCORE_BOOLEAN_INFO neutral ={ FTCORE_TOKEN_WORD, 0, 0, 0, 0, 0, 0, 0 };
+  FTCORE_BOOLEAN_INFO instinfo = neutral;
+  // the LEFT_PAREN tokens of the enclosing groups, closed with their operators.
+  FTCORE_BOOLEAN_INFO *infos = (FTCORE_BOOLEAN_INFO*)ftcore_malloc(8*sizeof(FTCORE_BOOLEAN_INFO));
+  int depth = 0;
+  int capacity = 8;
+  int ret = 0;
+  if(!infos){
+    return FTCORE_MEMORY_ERROR;
+  }
+  infos[0] = instinfo;
+
+  FTSTRING buffer = { NULL, 0, NULL, 0, 0 };
+  FTSTRING *pbuffer = &buffer;
+  ftstring_bind(pbuffer, feed, feed_req_free);
+
+  int context=CTX_CONTROL;
+  SEQFLOW sf = SF_BROKEN, sf_prev = SF_BROKEN;
+  char* pos = feed;
+  char* docend = feed+feed_length;
+  while(pos < docend && !ret){
+    int readsize;
+    ftcore_wc dst;
+    sf = ctxscan(cs, pos, docend, &dst, &readsize, context, engine->emit);
+    if(sf==SF_ESCAPE){
+      context |= CTX_ESCAPE;
+      context |= CTX_CONTROL;
+    }else{
+      context &= ~CTX_ESCAPE;
+      if(sf == SF_CHAR){
+        context &= ~CTX_CONTROL;
+      }else{
+        context |= CTX_CONTROL;
+      }
+    }
+    if(context & CTX_QUOTE){
+      int spacesize;
+      if((cs->ctype(cs, (unsigned char*)pos, (unsigned char*)docend, &spacesize) & FTCORE_CT_SPACE) && sf_prev!=SF_ESCAPE){ // perform phrase query.
+        sf = SF_WHITE;
+      }
+    }
+    if(sf != SF_CHAR && sf != SF_ESCAPE && ftstring_length(pbuffer) > 0){
+      // the word ends before the operator, parenthesis or space that ends it.
+      if(sf == SF_TRUNC){
+        instinfo.trunc = 1;
+      }
+      ret = ftcore_emit_word(engine, scratch, buf, budget, ftstring_head(pbuffer), ftstring_length(pbuffer), &instinfo, sink, ctx);
+      ftstring_reset(pbuffer);
+      instinfo = neutral;
+      if(ret){
+        break;
+      }
+    }
+    if(sf == SF_PLUS){   instinfo.yesno = 1; }
+    if(sf == SF_MINUS){  instinfo.yesno = -1; }
+    if(sf == SF_STRONG){ instinfo.weight_adjust++; }
+    if(sf == SF_WEAK){   instinfo.weight_adjust--; }
+    if(sf == SF_WASIGN){ instinfo.wasign = !instinfo.wasign; }
+    if(sf == SF_EXACT){  instinfo.exact = 1; }
+    if(sf == SF_EDGE){   instinfo.ngram = FTCORE_EMIT_EDGE; }
+    if(sf == SF_TRIGRAM){ instinfo.ngram = FTCORE_EMIT_TRIGRAM; }
+    if(sf == SF_LEFT_PAREN){
+      if(depth+1 == capacity){
+        FTCORE_BOOLEAN_INFO *tmp = (FTCORE_BOOLEAN_INFO*)ftcore_realloc(infos, 2*capacity*sizeof(FTCORE_BOOLEAN_INFO));
+        if(!tmp){
+          ret = FTCORE_MEMORY_ERROR;
+          break;
+        }
+        infos = tmp;
+        capacity *= 2;
+      }
+      // the operators in front of the group are its own, the words in it start without any.
+      instinfo.type = FTCORE_TOKEN_LEFT_PAREN;
+      infos[++depth] = instinfo;
+      ret = sink(ctx, pos, 0, &instinfo); // push LEFT_PAREN token
+      instinfo = neutral;
+    }else if(sf == SF_RIGHT_PAREN){
+      if(depth == 0){
+        ret = FTCORE_SYNTAX_ERROR; // must not reach the top level.
+        break;
+      }
+      instinfo = infos[depth--];
+      instinfo.type = FTCORE_TOKEN_RIGHT_PAREN;
+      ret = sink(ctx, pos, 0, &instinfo); // push RIGHT_PAREN token
+      instinfo = neutral;
+    }else if(sf == SF_CHAR){
+      if(ftstring_length(pbuffer)==0){
+        ftstring_bind(pbuffer, pos, feed_req_free);
+      }
+      ftstring_append(pbuffer, pos, readsize);
+    }else if(sf != SF_ESCAPE && !ftbool_prefix(sf)){
+      instinfo = neutral; // operators followed by a space or a quote apply to nothing.
+    }
+    if(sf == SF_QUOTE_START){
+      context |= CTX_QUOTE;
+    }
+    if(sf == SF_QUOTE_END){
+      context &= ~CTX_QUOTE;
+    }
+
+    if(readsize > 0){
+      pos += readsize;
+    }else if(readsize == FTCORE_ILSEQ){
+      pos++;
+    }else{
+      break;
+    }
+    sf_prev = sf;
+  }
+  if(ftstring_length(pbuffer) > 0 && !ret){
+    // we must not exceed HA_FT_MAXBYTELEN-HA_FT_WLEN
+    ret = ftcore_emit_word(engine, scratch, buf, budget, ftstring_head(pbuffer), ftstring_length(pbuffer), &instinfo, sink, ctx);
+  }
+  ftstring_destroy(pbuffer);
+  ftcore_free(infos);
+  return ret;
+}
+
+/** parallel parsing */
+struct ftcore_segment {
+  const FTCORE_ENGINE *engine;
+  struct ftcore_budget budget;
+  char* start;
+  char* end;
+  FTCORE_TOKENS tokens;
+  int error;
+};
+
+/** FTPOOL_TASK function: stems the words of a segment into its token stream. */
+static void ftcore_segment_parse(void *arg){
+  struct ftcore_segment *seg = (struct ftcore_segment*)arg;
+  struct sb_stemmer_scratch *scratch = ftcore_scratch(); // of the worker
+  struct ftcore_buf buf = { NULL, 0 };
+  if(!scratch){
+    seg->error = FTCORE_MEMORY_ERROR;
+    return;
+  }
+  seg->error = ftcore_parse_natural(seg->engine, scratch, &buf, &seg->budget, seg->start, (size_t)(seg->end - seg->start),
+                                    ftcore_tokens_sink, &seg->tokens);
+  if(buf.data){ ftcore_free(buf.data); }
+}
+
+/**
+ * Moves a cut forward onto an ASCII space. Stemmed charsets are ASCII
+ * compatible, so a space is neither inside a multibyte character nor
+ * inside a word; punctuation can be, as ICU keeps "keyboard's" and "3.14"
+ * whole.
+ */
+static char* ftcore_segment_cut(char *pos, char *end){
+  while(pos < end && ((unsigned char)*pos >= 0x80 || ftcore_uni_ctype((unsigned char)*pos) != FTCORE_CT_SPACE)){
+    pos++;
+  }
+  return pos;
+}
+
+/**
+ * Splits a large document at spaces, stems the segments on the
+ * workers, then emits the stems in document order from this thread.
+ */
+static int ftcore_parse_parallel(const FTCORE_ENGINE *engine, struct ftcore_budget *budget,
+                                 char *feed, size_t feed_length, ftcore_sink sink, void *ctx){
+  unsigned int nseg = ftpool_size() * 4 + 1; // some slack for stealing
+  size_t seglen = feed_length / nseg + 1;
+  struct ftcore_segment *segs = (struct ftcore_segment*)ftcore_malloc(nseg * sizeof(struct ftcore_segment));
+  FTPOOL_TASK *tasks = (FTPOOL_TASK*)ftcore_malloc(nseg * sizeof(FTPOOL_TASK));
+  if(!segs || !tasks){
+    if(segs){ ftcore_free(segs); }
+    if(tasks){ ftcore_free(tasks); }
+    return FTCORE_MEMORY_ERROR;
+  }
+  memset(segs, 0, nseg * sizeof(struct ftcore_segment));
+  unsigned int count = 0, i;
+  char *pos = feed;
+  char *end = feed + feed_length;
+  while(pos < end){
+    char *cut = end;
+    if(count < nseg-1 && (size_t)(end - pos) > seglen){
+      cut = ftcore_segment_cut(pos + seglen, end);
+    }
+    segs[count].engine = engine;
+    segs[count].budget = *budget;
+    segs[count].start  = pos;
+    segs[count].end    = cut;
+    tasks[count].func  = ftcore_segment_parse;
+    tasks[count].arg   = &segs[count];
+    count++;
+    pos = cut;
+  }
+  ftpool_run(tasks, count);
+
+  int ret = 0;
+  for(i=0; i<count; i++){
+    budget->exceeded |= segs[i].budget.exceeded;
+    if(!ret){ ret = segs[i].error; }
+    if(!ret){ ret = ftcore_tokens_emit(segs[i].tokens.data, segs[i].tokens.length, sink, ctx); }
+    ftcore_tokens_free(&segs[i].tokens);
+  }
+  ftcore_free(tasks);
+  ftcore_free(segs);
+  return ret;
+}
+/** /parallel parsing */
+
+int ftcore_parse(FTCORE_PARSER *parser, const FTCORE_CONFIG *config,
+                 const FTCORE_CODEC *codec, const char *doc, size_t length,
+                 enum ftcore_mode mode, ftcore_sink sink, void *ctx){
+  char* feed = (char*)doc;
+  size_t feed_length = length;
+  int feed_req_free = 0; // feed is ours, and may be rewritten
+  const FTCORE_CODEC *cs = codec; // the charset of feed
+  const FTCORE_CODEC *utf8 = config->utf8 ? config->utf8 : &ftcore_codec_utf8;
+  const char *algorithm = "english";
+  struct ftcore_budget budget;
+  unsigned long long clock = 0;
+  int ret;
+
+  ftcore_budget_start(&budget, config->time_budget_us);
+  parser->over_budget = 0;
+  memset(&parser->phases, 0, sizeof(FTCORE_PHASES));
+  if(config->timing){
+    clock = ftcore_now_us();
+  }
+  if(config->algorithm && strlen(config->algorithm) > 0){
+    algorithm = config->algorithm;
+  }
+
+  // normalize.
+  if(config->normalization != FTCORE_NORM_NONE){
+    if(!(cs->flags & FTCORE_CODEC_UTF8)){
+      // convert into UTF-8
+      size_t cv_length = ftconv_max_length(cs, feed_length, utf8);
+      char* cv = ftcore_malloc(cv_length + 1);
+      if(!cv){
+        return FTCORE_MEMORY_ERROR;
+      }
+      feed_length = ftconv_convert(cs, feed, feed_length, utf8, cv, cv_length);
+      feed = cv;
+      feed_req_free = 1;
+      cs = utf8;
+    }
+    char* nm;
+    size_t nm_length=0;
+    size_t nm_used=0;
+    nm_length = feed_length+32;
+    nm = ftcore_malloc(nm_length);
+    if(!nm){
+      if(feed_req_free){ ftcore_free(feed); }
+      return FTCORE_MEMORY_ERROR;
+    }
+    if(feed_length > 0){
+      nm_used = uni_normalize(feed, feed_length, nm, nm_length, config->normalization, config->unicode_3_2);
+      if(nm_used == 0){
+        fputs("unicode normalization failed.\n",stderr);
+        fflush(stderr);
+
+        if(feed_req_free){ ftcore_free(feed); }
+        ftcore_free(nm);
+        return FTCORE_NORMALIZATION_ERROR;
+      }else if(nm_used > nm_length){
+        nm_length = nm_used + 8;
+        char *tmp = ftcore_realloc(nm, nm_length);
+        if(tmp){
+          nm = tmp;
+        }else{
+          if(feed_req_free){ ftcore_free(feed); }
+          ftcore_free(nm);
+          return FTCORE_MEMORY_ERROR;
+        }
+        nm_used = uni_normalize(feed, feed_length, nm, nm_length, config->normalization, config->unicode_3_2);
+        if(nm_used == 0){
+          fputs("unicode normalization failed.\n",stderr);
+          fflush(stderr);
+
+          if(feed_req_free){ ftcore_free(feed); }
+          ftcore_free(nm);
+          return FTCORE_NORMALIZATION_ERROR;
+        }
+      }
+      if(feed_req_free){ ftcore_free(feed); }
+      feed = nm;
+      feed_length = nm_used;
+      feed_req_free = 1;
+    }else{
+      ftcore_free(nm);
+    }
+    if(config->timing){
+      unsigned long long now = ftcore_now_us();
+      parser->phases.normalize_us = now - clock;
+      clock = now;
+    }
+  }
+
+  ret = ftcore_engine_select(parser, config, algorithm, cs, utf8, codec);
+  struct sb_stemmer_scratch *scratch = ftcore_scratch();
+  if(!ret && !scratch){
+    ret = FTCORE_MEMORY_ERROR;
+  }
+  if(ret){
+    if(feed_req_free){ ftcore_free(feed); }
+    return ret;
+  }
+  parser->engine.surface = config->surface;
+  parser->engine.unaccent = config->unaccent;
+  parser->engine.tokenizer = config->tokenizer;
+  parser->engine.max_token_bytes = config->max_token_bytes;
+  parser->engine.drop = config->drop;
+  parser->engine.emit = config->emit;
+  parser->engine.edge_min = config->edge_min ? config->edge_min : FTCORE_EDGE_MIN;
+  parser->engine.edge_max = config->edge_max ? config->edge_max : FTCORE_EDGE_MAX;
+  if(parser->engine.edge_max < parser->engine.edge_min){
+    parser->engine.edge_max = parser->engine.edge_min;
+  }
+  parser->engine.budget_skip = config->budget_skip;
+  const FTCORE_ENGINE *engine = &parser->engine;
+  if(strcmp(cs->name, engine->codec->name)!=0){
+    size_t tmp_len = ftconv_max_length(cs, feed_length, engine->codec);
+    char* tmp = ftcore_malloc(tmp_len + 1);
+    if(!tmp){
+      if(feed_req_free){ ftcore_free(feed); }
+      return FTCORE_MEMORY_ERROR;
+    }
+    tmp_len = ftconv_convert(cs, feed, feed_length, engine->codec, tmp, tmp_len);
+    if(feed_req_free){ ftcore_free(feed); }
+    feed = tmp;
+    feed_length = tmp_len;
+    feed_req_free = 1;
+    cs = engine->codec;
+  }
+  if(config->timing){
+    unsigned long long now = ftcore_now_us();
+    parser->phases.convert_us = now - clock;
+    clock = now;
+  }
+
+  if(mode == FTCORE_MODE_BOOLEAN){
+    ret = ftcore_parse_boolean(engine, scratch, &parser->stem, &budget, feed, feed_length, feed_req_free, sink, ctx);
+  }else if(config->parallel_threshold > 0 && feed_length >= config->parallel_threshold && ftpool_size() > 0){
+    ret = ftcore_parse_parallel(engine, &budget, feed, feed_length, sink, ctx);
+  }else{
+    ret = ftcore_parse_natural(engine, scratch, &parser->stem, &budget, feed, feed_length, sink, ctx);
+  }
+  parser->over_budget = budget.exceeded;
+  if(config->timing){
+    parser->phases.tokenize_us = ftcore_now_us() - clock;
+  }
+  if(feed_req_free){ ftcore_free(feed); }
+  return ret;
+}
+/** /parser */
+
+/** dictionary building */
+/** converts a word into the charset the engine stems */
+static const char* ftcore_dict_convert(const FTCORE_ENGINE *engine, const FTCORE_CODEC *codec,
+                                       const char *word, size_t *length, char **tmp){
+  *tmp = NULL;
+  if(strcmp(codec->name, engine->codec->name) == 0){
+    return word;
+  }
+  size_t cv_length = ftconv_max_length(codec, *length, engine->codec);
+  *tmp = (char*)ftcore_malloc(cv_length + 1);
+  if(!*tmp){
+    return NULL;
+  }
+  *length = ftconv_convert(codec, word, *length, engine->codec, *tmp, cv_length);
+  return *tmp;
+}
+
+int ftcore_dict_add(FTCORE_PARSER *parser, FTDICT_BUILDER *builder, const FTCORE_CONFIG *config,
+                    const FTCORE_CODEC *codec, const char *surface, size_t length,
+                    const char *stem, size_t stem_length){
+  const FTCORE_CODEC *utf8 = config->utf8 ? config->utf8 : &ftcore_codec_utf8;
+  const char *algorithm = config->algorithm && strlen(config->algorithm) > 0 ? config->algorithm : "english";
+  char *surface_tmp, *stem_tmp = NULL;
+  FTCORE_CONFIG plain = *config; // stems from the stemmer, never from an older dictionary
+  plain.dictionary = NULL;
+  plain.generation = 0;
+  int ret = ftcore_engine_select(parser, &plain, algorithm, codec, utf8, codec);
+  if(ret){
+    return ret;
+  }
+  const FTCORE_ENGINE *engine = &parser->engine;
+  surface = ftcore_dict_convert(engine, codec, surface, &length, &surface_tmp);
+  if(!surface){
+    return FTCORE_MEMORY_ERROR;
+  }
+  if(stem){
+    stem = ftcore_dict_convert(engine, codec, stem, &stem_length, &stem_tmp);
+  }else{
+    struct sb_stemmer_scratch *scratch = ftcore_scratch();
+    const sb_symbol *sym = scratch ? sb_stemmer_module_stem(engine->module, scratch, (const sb_symbol*)surface, (int)length) : NULL;
+    stem = (const char*)sym;
+    stem_length = sym ? (size_t)sb_stemmer_scratch_length(scratch) : 0;
+  }
+  if(!stem){
+    ret = FTCORE_MEMORY_ERROR;
+  }else if(ftdict_builder_add(builder, algorithm, engine->encoding, surface, length, stem, stem_length)){
+    ret = FTCORE_MEMORY_ERROR;
+  }
+  if(surface_tmp){ ftcore_free(surface_tmp); }
+  if(stem_tmp){ ftcore_free(stem_tmp); }
+  return ret;
+}
+/** /dictionary building */
+
+/** batch parsing */
+struct ftcore_batch_chunk {
+  const FTCORE_CONFIG *config;
+  const FTCORE_CODEC *codec;
+  const FTCORE_DOC *docs;
+  FTCORE_TOKENS *tokens; // one per document
+  size_t count;
+  int error;
+};
+
+/** FTPOOL_TASK function: parses a run of documents into their token streams. */
+static void ftcore_batch_parse(void *arg){
+  struct ftcore_batch_chunk *chunk = (struct ftcore_batch_chunk*)arg;
+  FTCORE_PARSER *parser = ftcore_parser_new();
+  size_t i;
+  if(!parser){
+    chunk->error = FTCORE_MEMORY_ERROR;
+    return;
+  }
+  for(i=0; i<chunk->count && !chunk->error; i++){
+    chunk->error = ftcore_parse(parser, chunk->config, chunk->codec, chunk->docs[i].data, chunk->docs[i].length,
+                                FTCORE_MODE_NATURAL, ftcore_tokens_sink, &chunk->tokens[i]);
+  }
+  ftcore_parser_free(parser);
+}
+
+int ftcore_parse_batch(const FTCORE_CONFIG *config, const FTCORE_CODEC *codec,
+                       const FTCORE_DOC *docs, size_t count, ftcore_sink sink){
+  unsigned int nchunk = ftpool_size() * 4 + 1;
+  size_t per_chunk = count / nchunk + 1;
+  size_t i, j;
+  int ret = 0;
+  if(count == 0){
+    return 0;
+  }
+  struct ftcore_batch_chunk *chunks = (struct ftcore_batch_chunk*)ftcore_malloc(nchunk * sizeof(struct ftcore_batch_chunk));
+  FTPOOL_TASK *tasks = (FTPOOL_TASK*)ftcore_malloc(nchunk * sizeof(FTPOOL_TASK));
+  FTCORE_TOKENS *tokens = (FTCORE_TOKENS*)ftcore_malloc(count * sizeof(FTCORE_TOKENS));
+  if(!chunks || !tasks || !tokens){
+    if(chunks){ ftcore_free(chunks); }
+    if(tasks){ ftcore_free(tasks); }
+    if(tokens){ ftcore_free(tokens); }
+    return FTCORE_MEMORY_ERROR;
+  }
+  memset(tokens, 0, count * sizeof(FTCORE_TOKENS));
+  unsigned int n = 0;
+  for(i=0; i<count; i+=per_chunk){
+    chunks[n].config = config;
+    chunks[n].codec  = codec;
+    chunks[n].docs   = docs + i;
+    chunks[n].tokens = tokens + i;
+    chunks[n].count  = count - i < per_chunk ? count - i : per_chunk;
+    chunks[n].error  = 0;
+    tasks[n].func = ftcore_batch_parse;
+    tasks[n].arg  = &chunks[n];
+    n++;
+  }
+  ftpool_run(tasks, n);
+
+  for(i=0; i<n; i++){
+    if(!ret){ ret = chunks[i].error; }
+  }
+  for(j=0; j<count; j++){
+    if(!ret){ ret = ftcore_tokens_emit(tokens[j].data, tokens[j].length, sink, docs[j].ctx); }
+    ftcore_tokens_free(&tokens[j]);
+  }
+  ftcore_free(tokens);
+  ftcore_free(tasks);
+  ftcore_free(chunks);
+  return ret;
+}
+/** /batch parsing */
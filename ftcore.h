@@ -0,0 +1,293 @@
+#ifndef FTCORE_H
+#define FTCORE_H
+
+#include <stddef.h>
+
+#include "ftdict.h"
+
+/**
+ * libftsnowball_core: the tokenizing and stemming pipeline without mysqld.
+ * Text is read through an FTCORE_CODEC, tokens are handed to an
+ * ftcore_sink callback, and memory comes from the FTCORE_HOOKS given to
+ * ftcore_init(). plugin_snowball.c is the MySQL adapter on top of this.
+ */
+
+#define FTCORE_MEMORY_ERROR -1
+#define FTCORE_NORMALIZATION_ERROR -2
+#define FTCORE_SYNTAX_ERROR -3
+#define FTCORE_CONFIG_ERROR -4
+
+typedef unsigned long ftcore_wc;
+
+/** codec return values, as in the mysql charset handlers */
+#define FTCORE_ILSEQ 0
+#define FTCORE_TOOSMALL -1
+
+/** ctype flags */
+#define FTCORE_CT_WORD  1
+#define FTCORE_CT_SPACE 2
+
+/** codec flags */
+#define FTCORE_CODEC_UTF8 1
+
+/** encodings ftconv reads and writes itself. big endian unless LE. */
+#define FTCORE_ENC_OTHER   0 // through decode() and encode()
+#define FTCORE_ENC_UTF8    1
+#define FTCORE_ENC_SBCS    2 // single byte, by to_uni
+#define FTCORE_ENC_UCS2    3
+#define FTCORE_ENC_UTF16   4
+#define FTCORE_ENC_UTF16LE 5
+#define FTCORE_ENC_UTF32   6
+
+typedef struct _ftcore_codec {
+  /** the same name means the same encoding */
+  const char *name;
+  /** libstemmer encoding to stem this text with as is, or NULL */
+  const char *stemmer_encoding;
+  int flags;
+  int mbmaxlen;
+  /** @return bytes read, FTCORE_ILSEQ or FTCORE_TOOSMALL */
+  int (*decode)(const struct _ftcore_codec *codec, ftcore_wc *wc, const unsigned char *s, const unsigned char *e);
+  /** @return bytes written, FTCORE_ILSEQ if wc has no encoding or FTCORE_TOOSMALL */
+  int (*encode)(const struct _ftcore_codec *codec, ftcore_wc wc, unsigned char *s, unsigned char *e);
+  /**
+   * Classifies the character at s.
+   * @param length bytes of the character, or <= 0 as decode()
+   * @return FTCORE_CT_* flags
+   */
+  int (*ctype)(const struct _ftcore_codec *codec, const unsigned char *s, const unsigned char *e, int *length);
+  void *data;
+  /** FTCORE_ENC_* */
+  int encoding;
+  /** FTCORE_ENC_SBCS: the code point of every byte, 0 for a byte without one */
+  const unsigned short *to_uni;
+} FTCORE_CODEC;
+
+extern const FTCORE_CODEC ftcore_codec_utf8;
+/** latin1 as mysql has it, that is cp1252 */
+extern const FTCORE_CODEC ftcore_codec_latin1;
+/** @return a built-in codec by name, or NULL */
+const FTCORE_CODEC* ftcore_codec_get(const char *name);
+
+typedef struct _ftcore_hooks {
+  void* (*malloc)(size_t size);
+  void* (*realloc)(void *ptr, size_t size);
+  void  (*free)(void *ptr);
+  /** called by each worker thread as it starts and ends. may be NULL. */
+  void  (*thread_start)(void);
+  void  (*thread_end)(void);
+} FTCORE_HOOKS;
+
+void* ftcore_malloc(size_t size);
+void* ftcore_realloc(void *ptr, size_t size);
+void  ftcore_free(void *ptr);
+void  ftcore_thread_start(void);
+void  ftcore_thread_end(void);
+
+/**
+ * @param hooks NULL for the C library. Also given to ICU when set.
+ * @param threads worker threads for parallel parsing. 0 for none.
+ * @return 0 on success
+ */
+int  ftcore_init(const FTCORE_HOOKS *hooks, unsigned int threads);
+void ftcore_deinit(void);
+
+enum ftcore_normalization {
+  FTCORE_NORM_NONE = 0,
+  FTCORE_NORM_C,
+  FTCORE_NORM_D,
+  FTCORE_NORM_KC,
+  FTCORE_NORM_KD,
+  FTCORE_NORM_FCD,
+  FTCORE_NORM_C_CF,  // NFC of the case folded text
+  FTCORE_NORM_KC_CF  // NFKC of the case folded text
+};
+
+enum ftcore_tokenizer {
+  FTCORE_TOKENIZER_DEFAULT = 0, // runs of word characters
+  FTCORE_TOKENIZER_CJK_BIGRAM,  // and in UTF-8, runs of Han, kana and Hangul as overlapping bigrams
+  FTCORE_TOKENIZER_ICU          // ICU word break iteration in UTF-8. DEFAULT without ICU.
+};
+
+enum ftcore_mode {
+  FTCORE_MODE_NATURAL = 0,
+  FTCORE_MODE_BOOLEAN
+};
+
+/**
+ * Token classes. Tokens of a class are never stemmed: they are emitted as
+ * they are, or dropped when the class is in FTCORE_CONFIG.drop.
+ */
+#define FTCORE_CLASS_NUMERIC  1 /* digits only */
+#define FTCORE_CLASS_HEX      2 /* 8 or more hex digits, with a decimal digit and a letter */
+#define FTCORE_CLASS_OVERLONG 4 /* longer than max_token_bytes. truncated when emitted. */
+
+/**
+ * Tokens emitted besides the stems, each kind behind its own run of
+ * markers. The markers are word characters, so that mysqld keeps them;
+ * words lose their leading markers when any of these is on.
+ */
+#define FTCORE_EMIT_SURFACE 1 /* the word as written, where its stem differs */
+#define FTCORE_EMIT_EDGE    2 /* the prefixes of the word, edge_min to edge_max characters */
+#define FTCORE_EMIT_TRIGRAM 4 /* every three characters of the word */
+
+#define FTCORE_MARK '_'
+/** markers in front of each kind */
+#define FTCORE_MARKS_SURFACE 1
+#define FTCORE_MARKS_EDGE    2
+#define FTCORE_MARKS_TRIGRAM 3
+
+/** characters of the edge n-grams when FTCORE_CONFIG leaves them 0 */
+#define FTCORE_EDGE_MIN 2
+#define FTCORE_EDGE_MAX 15
+
+typedef struct _ftcore_config {
+  /** stemming algorithm or alias. NULL for english. */
+  const char *algorithm;
+  enum ftcore_normalization normalization;
+  enum ftcore_tokenizer tokenizer;
+  /** normalize by Unicode 3.2 */
+  int unicode_3_2;
+  /** codec for text transcoded into UTF-8. NULL for ftcore_codec_utf8. */
+  const FTCORE_CODEC *utf8;
+  /** natural mode documents of at least this many bytes are parsed on the workers. 0 never. */
+  size_t parallel_threshold;
+  /** stems looked up before running the stemmer. may be NULL. */
+  const FTDICT *dictionary;
+  /** emit the words unstemmed, as ftsnowball_bulk does to count them */
+  int surface;
+  /**
+   * Strip the accents of every token after stemming, so that the stemmer
+   * still sees them and words written with and without them meet.
+   */
+  int unaccent;
+  /**
+   * bytes of the longest token emitted, in the output charset and marks
+   * included; longer words are FTCORE_CLASS_OVERLONG. 0 for no limit.
+   */
+  size_t max_token_bytes;
+  /** FTCORE_CLASS_* flags of the tokens to drop */
+  int drop;
+  /** FTCORE_EMIT_* flags of the tokens to emit besides the stems */
+  int emit;
+  /** characters of the shortest and the longest edge n-grams. 0 for FTCORE_EDGE_MIN and FTCORE_EDGE_MAX. */
+  unsigned int edge_min;
+  unsigned int edge_max;
+  /**
+   * Microseconds a document may take. Past that, the rest of it is emitted
+   * unstemmed, or dropped if budget_skip is set. 0 for no limit.
+   */
+  unsigned long time_budget_us;
+  int budget_skip;
+  /** measure the phases of each document, see ftcore_parser_phases() */
+  int timing;
+  /**
+   * Identifies the settings above when not 0: a parser that has seen the
+   * generation before skips comparing them. Give a new one for every change.
+   */
+  unsigned long generation;
+} FTCORE_CONFIG;
+
+enum ftcore_token_type {
+  FTCORE_TOKEN_WORD = 1,
+  FTCORE_TOKEN_LEFT_PAREN,
+  FTCORE_TOKEN_RIGHT_PAREN
+};
+
+/** boolean query operators of a token */
+typedef struct _ftcore_boolean_info {
+  enum ftcore_token_type type;
+  int  yesno;
+  int  weight_adjust;
+  char wasign;
+  char trunc;
+  char quot;
+  /** '=' before the word: match the surface form, with FTCORE_EMIT_SURFACE */
+  char exact;
+  /**
+   * '^' or '%' before the word: FTCORE_EMIT_EDGE to match the words it
+   * begins, FTCORE_EMIT_TRIGRAM the words it is part of.
+   */
+  char ngram;
+} FTCORE_BOOLEAN_INFO;
+
+/**
+ * Receives the tokens of a document in document order, in the charset of
+ * the document. word is only valid during the call.
+ * @param info NULL in natural mode
+ * @return 0 to go on, anything else stops parsing and is returned
+ */
+typedef int (*ftcore_sink)(void *ctx, const char *word, size_t length, const FTCORE_BOOLEAN_INFO *info);
+
+/** a token stream of 4 byte lengths, each followed by the bytes */
+typedef struct _ftcore_tokens {
+  char*  data;
+  size_t length;
+  size_t capacity;
+} FTCORE_TOKENS;
+
+/**
+ * Appends the length of a token to the stream and returns the place for its
+ * bytes.
+ * @param limit maximum length of the whole stream. 0 means no limit.
+ * @return NULL if the limit was hit or memory ran out
+ */
+char* ftcore_tokens_push(FTCORE_TOKENS *tokens, size_t length, size_t limit);
+/** hands every token of the stream to sink */
+int   ftcore_tokens_emit(const char *data, size_t length, ftcore_sink sink, void *ctx);
+void  ftcore_tokens_free(FTCORE_TOKENS *tokens);
+
+/** per document state. a parser is used by one thread at a time. */
+typedef struct _ftcore_parser FTCORE_PARSER;
+
+/** microseconds spent in each phase of a document */
+typedef struct _ftcore_phases {
+  unsigned long long normalize_us;
+  unsigned long long convert_us;  /* into the charset of the stemmer */
+  unsigned long long tokenize_us; /* tokenizing, stemming and the sink */
+} FTCORE_PHASES;
+
+FTCORE_PARSER* ftcore_parser_new(void);
+void ftcore_parser_free(FTCORE_PARSER *parser);
+/** @return whether the last document parsed ran out of its time budget */
+int  ftcore_parser_over_budget(const FTCORE_PARSER *parser);
+/** @return the phases of the last document, all 0 unless it was parsed with timing set */
+const FTCORE_PHASES* ftcore_parser_phases(const FTCORE_PARSER *parser);
+/** @return microseconds of a monotonic clock, the one timing and budgets use */
+unsigned long long ftcore_now_us(void);
+
+/**
+ * Normalizes, tokenizes and stems a document.
+ * @return 0, FTCORE_*_ERROR or the first non-zero sink result
+ */
+int ftcore_parse(FTCORE_PARSER *parser, const FTCORE_CONFIG *config,
+                 const FTCORE_CODEC *codec, const char *doc, size_t length,
+                 enum ftcore_mode mode, ftcore_sink sink, void *ctx);
+
+/**
+ * Adds a dictionary entry for the stemmer the config selects for text in
+ * codec, converting the words into the encoding that stemmer reads. The
+ * surface is taken as it is, so it should already be normalized.
+ * @param stem the stem in codec, or NULL for what the stemmer makes of surface
+ * @return 0, FTCORE_MEMORY_ERROR or FTCORE_CONFIG_ERROR
+ */
+int ftcore_dict_add(FTCORE_PARSER *parser, FTDICT_BUILDER *builder, const FTCORE_CONFIG *config,
+                    const FTCORE_CODEC *codec, const char *surface, size_t length,
+                    const char *stem, size_t stem_length);
+
+typedef struct _ftcore_doc {
+  const char *data;
+  size_t length;
+  /** passed to the sink along with the tokens of this document */
+  void *ctx;
+} FTCORE_DOC;
+
+/**
+ * Parses documents in natural mode on the workers. The sink is called from
+ * the calling thread, document after document, in order.
+ * @return 0, FTCORE_*_ERROR or the first non-zero sink result
+ */
+int ftcore_parse_batch(const FTCORE_CONFIG *config, const FTCORE_CODEC *codec,
+                       const FTCORE_DOC *docs, size_t count, ftcore_sink sink);
+
+#endif
@@ -0,0 +1,430 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ftcore.h"
+#include "ftdict.h"
+#include "fthash.h"
+
+/**
+ * File layout, in host byte order:
+ *   header, section descriptors, then the buckets and the word pool of each
+ *   section, every part aligned to 8 bytes.
+ */
+#define FTDICT_MAGIC "FTSBDICT"
+#define FTDICT_VERSION 1
+#define FTDICT_BYTEORDER 0x01020304U
+#define FTDICT_MAX_WORD 0xFFFF
+
+struct ftdict_header {
+  char     magic[8];
+  uint32_t version;
+  uint32_t byteorder;
+  uint32_t sections;
+  uint32_t reserved;
+  uint64_t file_size;
+};
+
+struct ftdict_descriptor {
+  char     algorithm[32];
+  char     encoding[16];
+  uint64_t buckets;      // file offset
+  uint32_t bucket_count; // power of 2
+  uint32_t entries;
+  uint64_t pool;         // file offset
+  uint64_t pool_length;
+};
+
+/** an empty bucket has surface_length 0 */
+struct ftdict_bucket {
+  uint64_t hash;
+  uint32_t offset; // of the surface in the pool, followed by the stem
+  uint16_t surface_length;
+  uint16_t stem_length;
+};
+
+struct _ftdict_section {
+  const struct ftdict_descriptor *desc;
+  const struct ftdict_bucket *buckets;
+  uint64_t mask;
+  const char *pool;
+};
+
+struct _ftdict {
+  void*  map;
+  size_t length;
+  unsigned int count;
+  FTDICT_SECTION *sections;
+};
+
+static uint64_t ftdict_hash(const char *word, size_t length){
+  FTHASH128 h;
+  fthash128(word, length, 0, &h);
+  return h.h1;
+}
+
+#define FTDICT_ALIGN(x) (((x)+7) & ~(uint64_t)7)
+
+/** checks everything lookups rely on, so that a broken file can not crash them. */
+static int ftdict_validate(const char *map, size_t length, const struct ftdict_descriptor *desc){
+  uint64_t i, used = 0;
+  if(!memchr(desc->algorithm, '\0', sizeof(desc->algorithm)) || !memchr(desc->encoding, '\0', sizeof(desc->encoding))){
+    return -1;
+  }
+  if(desc->bucket_count == 0 || (desc->bucket_count & (desc->bucket_count-1)) != 0
+      || desc->entries >= desc->bucket_count){
+    return -1;
+  }
+  if(desc->buckets % 8 || desc->buckets > length
+      || (uint64_t)desc->bucket_count * sizeof(struct ftdict_bucket) > length - desc->buckets){
+    return -1;
+  }
+  if(desc->pool > length || desc->pool_length > length - desc->pool){
+    return -1;
+  }
+  const struct ftdict_bucket *buckets = (const struct ftdict_bucket*)(map + desc->buckets);
+  for(i=0; i<desc->bucket_count; i++){
+    if(!buckets[i].surface_length){
+      continue;
+    }
+    if((uint64_t)buckets[i].offset + buckets[i].surface_length + buckets[i].stem_length > desc->pool_length){
+      return -1;
+    }
+    used++;
+  }
+  if(used == desc->bucket_count){
+    return -1; // lookups of missing words end at an empty bucket
+  }
+  return 0;
+}
+
+FTDICT* ftdict_open(const char *path){
+  struct stat st;
+  int fd = open(path, O_RDONLY);
+  FTDICT *dict = NULL;
+  void *map;
+  unsigned int i;
+  if(fd < 0){
+    return NULL;
+  }
+  if(fstat(fd, &st) || (size_t)st.st_size < sizeof(struct ftdict_header)){
+    close(fd);
+    return NULL;
+  }
+  map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(map == MAP_FAILED){
+    return NULL;
+  }
+  const struct ftdict_header *header = (const struct ftdict_header*)map;
+  if(memcmp(header->magic, FTDICT_MAGIC, 8) != 0 || header->version != FTDICT_VERSION
+      || header->byteorder != FTDICT_BYTEORDER || header->file_size != (uint64_t)st.st_size
+      || header->sections > ((size_t)st.st_size - sizeof(struct ftdict_header)) / sizeof(struct ftdict_descriptor)){
+    munmap(map, (size_t)st.st_size);
+    return NULL;
+  }
+  dict = (FTDICT*)ftcore_malloc(sizeof(FTDICT));
+  if(dict){
+    dict->map = map;
+    dict->length = (size_t)st.st_size;
+    dict->count = header->sections;
+    dict->sections = (FTDICT_SECTION*)ftcore_malloc((header->sections + 1) * sizeof(FTDICT_SECTION));
+  }
+  if(!dict || !dict->sections){
+    if(dict){ ftcore_free(dict); }
+    munmap(map, (size_t)st.st_size);
+    return NULL;
+  }
+  const struct ftdict_descriptor *descs = (const struct ftdict_descriptor*)(header + 1);
+  for(i=0; i<dict->count; i++){
+    if(ftdict_validate((const char*)map, dict->length, &descs[i])){
+      ftdict_close(dict);
+      return NULL;
+    }
+    dict->sections[i].desc    = &descs[i];
+    dict->sections[i].buckets = (const struct ftdict_bucket*)((const char*)map + descs[i].buckets);
+    dict->sections[i].mask    = descs[i].bucket_count - 1;
+    dict->sections[i].pool    = (const char*)map + descs[i].pool;
+  }
+  return dict;
+}
+
+void ftdict_close(FTDICT *dict){
+  if(!dict){ return; }
+  munmap(dict->map, dict->length);
+  ftcore_free(dict->sections);
+  ftcore_free(dict);
+}
+
+unsigned int ftdict_sections(const FTDICT *dict){ return dict->count; }
+const FTDICT_SECTION* ftdict_section(const FTDICT *dict, unsigned int index){ return &dict->sections[index]; }
+const char* ftdict_section_algorithm(const FTDICT_SECTION *section){ return section->desc->algorithm; }
+const char* ftdict_section_encoding(const FTDICT_SECTION *section){ return section->desc->encoding; }
+size_t ftdict_section_entries(const FTDICT_SECTION *section){ return (size_t)section->desc->entries; }
+
+const char* ftdict_lookup(const FTDICT_SECTION *section, const char *word, size_t length, size_t *stem_length){
+  uint64_t hash = ftdict_hash(word, length);
+  uint64_t i = hash & section->mask;
+  uint64_t probes;
+  for(probes=0; probes<=section->mask; probes++){
+    const struct ftdict_bucket *bucket = &section->buckets[i];
+    if(bucket->surface_length == 0){
+      return NULL;
+    }
+    if(bucket->hash == hash && bucket->surface_length == length
+        && memcmp(section->pool + bucket->offset, word, length) == 0){
+      *stem_length = bucket->stem_length;
+      return section->pool + bucket->offset + length;
+    }
+    i = (i+1) & section->mask;
+  }
+  return NULL;
+}
+
+/** builder */
+struct ftdict_entry {
+  uint64_t hash;
+  size_t   offset; // in the builder's words
+  unsigned int surface_length;
+  unsigned int stem_length;
+  unsigned int section;
+};
+
+struct ftdict_builder_section {
+  struct ftdict_descriptor desc;
+  unsigned int count;
+};
+
+struct _ftdict_builder {
+  struct ftdict_entry *entries;
+  size_t count;
+  size_t capacity;
+  char*  words;
+  size_t words_length;
+  size_t words_capacity;
+  struct ftdict_builder_section *sections;
+  unsigned int section_count;
+};
+
+FTDICT_BUILDER* ftdict_builder_new(void){
+  FTDICT_BUILDER *builder = (FTDICT_BUILDER*)ftcore_malloc(sizeof(FTDICT_BUILDER));
+  if(builder){
+    memset(builder, 0, sizeof(FTDICT_BUILDER));
+  }
+  return builder;
+}
+
+void ftdict_builder_free(FTDICT_BUILDER *builder){
+  if(!builder){ return; }
+  if(builder->entries){ ftcore_free(builder->entries); }
+  if(builder->words){ ftcore_free(builder->words); }
+  if(builder->sections){ ftcore_free(builder->sections); }
+  ftcore_free(builder);
+}
+
+static int ftdict_builder_section(FTDICT_BUILDER *builder, const char *algorithm, const char *encoding){
+  unsigned int i;
+  for(i=0; i<builder->section_count; i++){
+    if(strcmp(builder->sections[i].desc.algorithm, algorithm) == 0
+        && strcmp(builder->sections[i].desc.encoding, encoding) == 0){
+      return (int)i;
+    }
+  }
+  if(strlen(algorithm) >= sizeof(builder->sections[0].desc.algorithm)
+      || strlen(encoding) >= sizeof(builder->sections[0].desc.encoding)){
+    return -1;
+  }
+  struct ftdict_builder_section *tmp = (struct ftdict_builder_section*)(builder->sections
+      ? ftcore_realloc(builder->sections, (i+1) * sizeof(struct ftdict_builder_section))
+      : ftcore_malloc(sizeof(struct ftdict_builder_section)));
+  if(!tmp){
+    return -1;
+  }
+  builder->sections = tmp;
+  memset(&tmp[i], 0, sizeof(struct ftdict_builder_section));
+  strcpy(tmp[i].desc.algorithm, algorithm);
+  strcpy(tmp[i].desc.encoding, encoding);
+  builder->section_count++;
+  return (int)i;
+}
+
+int ftdict_builder_add(FTDICT_BUILDER *builder, const char *algorithm, const char *encoding,
+                       const char *surface, size_t length, const char *stem, size_t stem_length){
+  if(length == 0 || length > FTDICT_MAX_WORD || stem_length > FTDICT_MAX_WORD){
+    return 0;
+  }
+  int section = ftdict_builder_section(builder, algorithm, encoding);
+  if(section < 0){
+    return -1;
+  }
+  if(builder->count == builder->capacity){
+    size_t sz = builder->capacity ? builder->capacity<<1 : 1024;
+    struct ftdict_entry *tmp = (struct ftdict_entry*)(builder->entries
+        ? ftcore_realloc(builder->entries, sz * sizeof(struct ftdict_entry))
+        : ftcore_malloc(sz * sizeof(struct ftdict_entry)));
+    if(!tmp){
+      return -1;
+    }
+    builder->entries = tmp;
+    builder->capacity = sz;
+  }
+  if(builder->words_length + length + stem_length > builder->words_capacity){
+    size_t sz = builder->words_capacity ? builder->words_capacity : 65536;
+    while(sz < builder->words_length + length + stem_length){
+      sz = sz<<1;
+    }
+    char *tmp = builder->words ? ftcore_realloc(builder->words, sz) : ftcore_malloc(sz);
+    if(!tmp){
+      return -1;
+    }
+    builder->words = tmp;
+    builder->words_capacity = sz;
+  }
+  struct ftdict_entry *entry = &builder->entries[builder->count++];
+  entry->hash = ftdict_hash(surface, length);
+  entry->offset = builder->words_length;
+  entry->surface_length = (unsigned int)length;
+  entry->stem_length = (unsigned int)stem_length;
+  entry->section = (unsigned int)section;
+  memcpy(builder->words + builder->words_length, surface, length);
+  memcpy(builder->words + builder->words_length + length, stem, stem_length);
+  builder->words_length += length + stem_length;
+  return 0;
+}
+
+/** lays the entries of a section out in buckets and a pool. */
+static int ftdict_builder_layout(FTDICT_BUILDER *builder, unsigned int section,
+                                 struct ftdict_bucket **buckets, char **pool){
+  struct ftdict_descriptor *desc = &builder->sections[section].desc;
+  uint64_t size = 16;
+  size_t i, used = 0;
+  while(size < (uint64_t)builder->sections[section].count * 2){
+    size = size<<1;
+  }
+  *buckets = (struct ftdict_bucket*)ftcore_malloc(size * sizeof(struct ftdict_bucket));
+  *pool = (char*)ftcore_malloc(builder->words_length + 1);
+  if(!*buckets || !*pool){
+    return -1;
+  }
+  memset(*buckets, 0, size * sizeof(struct ftdict_bucket));
+  desc->entries = 0;
+  for(i=0; i<builder->count; i++){
+    const struct ftdict_entry *entry = &builder->entries[i];
+    if(entry->section != section){
+      continue;
+    }
+    uint64_t j = entry->hash & (size-1);
+    for(; (*buckets)[j].surface_length; j = (j+1) & (size-1)){
+      if((*buckets)[j].hash == entry->hash && (*buckets)[j].surface_length == entry->surface_length
+          && memcmp(*pool + (*buckets)[j].offset, builder->words + entry->offset, entry->surface_length) == 0){
+        break;
+      }
+    }
+    if((*buckets)[j].surface_length){
+      continue; // the first entry wins.
+    }
+    (*buckets)[j].hash = entry->hash;
+    (*buckets)[j].offset = (uint32_t)used;
+    (*buckets)[j].surface_length = (uint16_t)entry->surface_length;
+    (*buckets)[j].stem_length = (uint16_t)entry->stem_length;
+    memcpy(*pool + used, builder->words + entry->offset, entry->surface_length + entry->stem_length);
+    used += entry->surface_length + entry->stem_length;
+    desc->entries++;
+  }
+  desc->bucket_count = (uint32_t)size;
+  desc->pool_length = used;
+  return 0;
+}
+
+int ftdict_builder_write(FTDICT_BUILDER *builder, const char *path){
+  struct ftdict_header header;
+  struct ftdict_bucket **buckets;
+  char **pools;
+  static const char zero[8] = { 0 };
+  unsigned int i;
+  size_t n = builder->section_count;
+  int ret = -1;
+  uint64_t offset;
+  FILE *fp = NULL;
+
+  if(builder->words_length > 0xFFFFFFFFU){
+    return -1; // pool offsets are 32 bit
+  }
+  for(i=0; i<builder->section_count; i++){
+    builder->sections[i].count = 0;
+  }
+  size_t k;
+  for(k=0; k<builder->count; k++){
+    builder->sections[builder->entries[k].section].count++;
+  }
+  buckets = (struct ftdict_bucket**)ftcore_malloc((n+1) * sizeof(struct ftdict_bucket*));
+  pools = (char**)ftcore_malloc((n+1) * sizeof(char*));
+  if(!buckets || !pools){
+    goto end;
+  }
+  memset(buckets, 0, (n+1) * sizeof(struct ftdict_bucket*));
+  memset(pools, 0, (n+1) * sizeof(char*));
+
+  offset = FTDICT_ALIGN(sizeof(header) + n * sizeof(struct ftdict_descriptor));
+  for(i=0; i<n; i++){
+    struct ftdict_descriptor *desc = &builder->sections[i].desc;
+    if(ftdict_builder_layout(builder, i, &buckets[i], &pools[i])){
+      goto end;
+    }
+    desc->buckets = offset;
+    offset += (uint64_t)desc->bucket_count * sizeof(struct ftdict_bucket);
+    desc->pool = offset;
+    offset = FTDICT_ALIGN(offset + desc->pool_length);
+  }
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, FTDICT_MAGIC, 8);
+  header.version = FTDICT_VERSION;
+  header.byteorder = FTDICT_BYTEORDER;
+  header.sections = (uint32_t)n;
+  header.file_size = offset;
+
+  size_t tmp_length = strlen(path) + 5;
+  char *tmp_path = (char*)ftcore_malloc(tmp_length);
+  if(!tmp_path){
+    goto end;
+  }
+  snprintf(tmp_path, tmp_length, "%s.tmp", path);
+  fp = fopen(tmp_path, "wb");
+  if(fp){
+    size_t pos = sizeof(header) + n * sizeof(struct ftdict_descriptor);
+    int failed = fwrite(&header, sizeof(header), 1, fp) != 1;
+    for(i=0; i<n && !failed; i++){
+      failed = fwrite(&builder->sections[i].desc, sizeof(struct ftdict_descriptor), 1, fp) != 1;
+    }
+    for(i=0; i<n && !failed; i++){
+      const struct ftdict_descriptor *desc = &builder->sections[i].desc;
+      failed = fwrite(zero, 1, (size_t)(desc->buckets - pos), fp) != (size_t)(desc->buckets - pos)
+            || fwrite(buckets[i], sizeof(struct ftdict_bucket), desc->bucket_count, fp) != desc->bucket_count
+            || fwrite(pools[i], 1, (size_t)desc->pool_length, fp) != (size_t)desc->pool_length;
+      pos = (size_t)(desc->pool + desc->pool_length);
+    }
+    if(!failed && pos < offset){
+      failed = fwrite(zero, 1, (size_t)(offset - pos), fp) != (size_t)(offset - pos);
+    }
+    if(fclose(fp) == 0 && !failed && rename(tmp_path, path) == 0){
+      ret = 0;
+    }else{
+      unlink(tmp_path);
+    }
+  }
+  ftcore_free(tmp_path);
+end:
+  for(i=0; i<n && buckets && pools; i++){
+    if(buckets[i]){ ftcore_free(buckets[i]); }
+    if(pools[i]){ ftcore_free(pools[i]); }
+  }
+  if(buckets){ ftcore_free(buckets); }
+  if(pools){ ftcore_free(pools); }
+  return ret;
+}
+/** /builder */
@@ -0,0 +1,51 @@
+#ifndef FTDICT_H
+#define FTDICT_H
+
+#include <stddef.h>
+
+/**
+ * Stem dictionary: precomputed surface to stem mappings, one section per
+ * stemming algorithm and encoding, in a file that is mmap()ed read-only and
+ * shared by every thread through the page cache. Each section is an open
+ * addressing table kept at most half full, so a word is mostly found or
+ * missed with one probe.
+ */
+
+typedef struct _ftdict FTDICT;
+typedef struct _ftdict_section FTDICT_SECTION;
+typedef struct _ftdict_builder FTDICT_BUILDER;
+
+/** @return NULL if the file can not be mapped or is not a valid dictionary */
+FTDICT* ftdict_open(const char *path);
+void    ftdict_close(FTDICT *dict);
+
+unsigned int ftdict_sections(const FTDICT *dict);
+const FTDICT_SECTION* ftdict_section(const FTDICT *dict, unsigned int index);
+const char*  ftdict_section_algorithm(const FTDICT_SECTION *section);
+/** libstemmer encoding name of the words of the section */
+const char*  ftdict_section_encoding(const FTDICT_SECTION *section);
+size_t       ftdict_section_entries(const FTDICT_SECTION *section);
+
+/**
+ * @param stem_length the length of the stem found
+ * @return the stem, or NULL if the word is not in the section
+ */
+const char* ftdict_lookup(const FTDICT_SECTION *section, const char *word, size_t length, size_t *stem_length);
+
+FTDICT_BUILDER* ftdict_builder_new(void);
+/**
+ * Adds an entry to the section of algorithm and encoding. The first entry
+ * of a surface wins. Words longer than 65535 bytes are ignored.
+ * @return 0 on success
+ */
+int  ftdict_builder_add(FTDICT_BUILDER *builder, const char *algorithm, const char *encoding,
+                        const char *surface, size_t length, const char *stem, size_t stem_length);
+/**
+ * Writes the dictionary next to path and renames it over path, so that
+ * processes mapping the old file keep it.
+ * @return 0 on success
+ */
+int  ftdict_builder_write(FTDICT_BUILDER *builder, const char *path);
+void ftdict_builder_free(FTDICT_BUILDER *builder);
+
+#endif
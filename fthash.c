@@ -0,0 +1,74 @@
+#include <string.h>
+#include "fthash.h"
+
+/**
+ * MurmurHash3 x64 128 by Austin Appleby, placed in the public domain.
+ * Blocks are read through memcpy, so data needs no alignment.
+ */
+
+#define ROTL64(x,r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+static unsigned long long fmix64(unsigned long long k){
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdULL;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ULL;
+  k ^= k >> 33;
+  return k;
+}
+
+void fthash128(const void *data, size_t length, unsigned long long seed, FTHASH128 *out){
+  const unsigned char *p = (const unsigned char*)data;
+  size_t nblocks = length / 16;
+  unsigned long long h1 = seed;
+  unsigned long long h2 = seed;
+  const unsigned long long c1 = 0x87c37b91114253d5ULL;
+  const unsigned long long c2 = 0x4cf5ad432745937fULL;
+  unsigned long long k1, k2;
+  size_t i;
+  
+  for(i=0; i<nblocks; i++){
+    memcpy(&k1, p + i*16, 8);
+    memcpy(&k2, p + i*16 + 8, 8);
+    
+    k1 *= c1; k1 = ROTL64(k1,31); k1 *= c2; h1 ^= k1;
+    h1 = ROTL64(h1,27); h1 += h2; h1 = h1*5+0x52dce729;
+    k2 *= c2; k2 = ROTL64(k2,33); k2 *= c1; h2 ^= k2;
+    h2 = ROTL64(h2,31); h2 += h1; h2 = h2*5+0x38495ab5;
+  }
+  
+  const unsigned char *tail = p + nblocks*16;
+  k1 = 0;
+  k2 = 0;
+  switch(length & 15){
+    case 15: k2 ^= ((unsigned long long)tail[14]) << 48; /* fall through */
+    case 14: k2 ^= ((unsigned long long)tail[13]) << 40; /* fall through */
+    case 13: k2 ^= ((unsigned long long)tail[12]) << 32; /* fall through */
+    case 12: k2 ^= ((unsigned long long)tail[11]) << 24; /* fall through */
+    case 11: k2 ^= ((unsigned long long)tail[10]) << 16; /* fall through */
+    case 10: k2 ^= ((unsigned long long)tail[ 9]) << 8; /* fall through */
+    case  9: k2 ^= ((unsigned long long)tail[ 8]) << 0;
+      k2 *= c2; k2 = ROTL64(k2,33); k2 *= c1; h2 ^= k2; /* fall through */
+    case  8: k1 ^= ((unsigned long long)tail[ 7]) << 56; /* fall through */
+    case  7: k1 ^= ((unsigned long long)tail[ 6]) << 48; /* fall through */
+    case  6: k1 ^= ((unsigned long long)tail[ 5]) << 40; /* fall through */
+    case  5: k1 ^= ((unsigned long long)tail[ 4]) << 32; /* fall through */
+    case  4: k1 ^= ((unsigned long long)tail[ 3]) << 24; /* fall through */
+    case  3: k1 ^= ((unsigned long long)tail[ 2]) << 16; /* fall through */
+    case  2: k1 ^= ((unsigned long long)tail[ 1]) << 8; /* fall through */
+    case  1: k1 ^= ((unsigned long long)tail[ 0]) << 0;
+      k1 *= c1; k1 = ROTL64(k1,31); k1 *= c2; h1 ^= k1;
+  }
+  
+  h1 ^= (unsigned long long)length;
+  h2 ^= (unsigned long long)length;
+  h1 += h2;
+  h2 += h1;
+  h1 = fmix64(h1);
+  h2 = fmix64(h2);
+  h1 += h2;
+  h2 += h1;
+  
+  out->h1 = h1;
+  out->h2 = h2;
+}
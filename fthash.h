@@ -0,0 +1,20 @@
+#ifndef FTHASH_H
+#define FTHASH_H
+
+#include <stddef.h>
+
+typedef struct _fthash128 {
+  unsigned long long h1;
+  unsigned long long h2;
+} FTHASH128;
+
+/**
+ * 128-bit non-cryptographic hash (MurmurHash3 x64 128).
+ * @param data bytes to hash
+ * @param length byte length of data
+ * @param seed mixed into the result; hashes with different seeds are unrelated
+ * @param out result
+ */
+void fthash128(const void *data, size_t length, unsigned long long seed, FTHASH128 *out);
+
+#endif
@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include "ftcore.h"
+#include "ftlog.h"
+
+#define FTLOG_MIN_CAPACITY 4096
+#define FTLOG_IDLE_NS      10000000 // writer poll interval when the ring is empty
+
+/**
+ * A record in the ring is a header followed by the payload, padded to 8
+ * bytes so that a header never wraps around the end of the ring. Producers
+ * reserve space by moving head forward with a CAS, copy the payload and then
+ * set ready. The writer takes records in order at tail, clears ready and
+ * moves tail forward, which gives the space back.
+ */
+typedef struct _ftlog_header {
+  uint32_t length;
+  uint32_t ready;
+} FTLOG_HEADER;
+
+struct _ftlog {
+  FILE *fp;
+  unsigned char *ring;
+  size_t capacity;
+  uint64_t head;
+  uint64_t tail;
+  unsigned long dropped;
+  unsigned long long written;
+  int quit;
+  pthread_t writer;
+};
+
+static size_t record_size(size_t length){
+  return sizeof(FTLOG_HEADER) + ((length + 7) & ~(size_t)7);
+}
+
+static void ring_copy_in(FTLOG *log, uint64_t pos, const void *src, size_t length){
+  size_t off = (size_t)(pos & (log->capacity - 1));
+  size_t first = log->capacity - off;
+  if(first >= length){
+    memcpy(log->ring + off, src, length);
+  }else{
+    memcpy(log->ring + off, src, first);
+    memcpy(log->ring, (const unsigned char*)src + first, length - first);
+  }
+}
+
+static void ring_write_out(FTLOG *log, uint64_t pos, size_t length){
+  size_t off = (size_t)(pos & (log->capacity - 1));
+  size_t first = log->capacity - off;
+  if(first >= length){
+    fwrite(log->ring + off, 1, length, log->fp);
+  }else{
+    fwrite(log->ring + off, 1, first, log->fp);
+    fwrite(log->ring, 1, length - first, log->fp);
+  }
+}
+
+static void* writer_main(void *arg){
+  FTLOG *log = (FTLOG*)arg;
+  struct timespec idle = { 0, FTLOG_IDLE_NS };
+  uint64_t tail = log->tail;
+  while(1){
+    uint64_t head = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+    if(tail == head){
+      if(__atomic_load_n(&log->quit, __ATOMIC_ACQUIRE)){
+        break; // writers are gone once quit is set
+      }
+      fflush(log->fp);
+      nanosleep(&idle, NULL);
+      continue;
+    }
+    while(tail != head){
+      FTLOG_HEADER *h = (FTLOG_HEADER*)(log->ring + (size_t)(tail & (log->capacity - 1)));
+      while(!__atomic_load_n(&h->ready, __ATOMIC_ACQUIRE)){
+        sched_yield(); // reserved, still being copied in
+      }
+      size_t length = h->length;
+      ring_write_out(log, tail + sizeof(FTLOG_HEADER), length);
+      __atomic_store_n(&h->ready, 0, __ATOMIC_RELAXED);
+      tail += record_size(length);
+      __atomic_store_n(&log->tail, tail, __ATOMIC_RELEASE);
+      __atomic_fetch_add(&log->written, length, __ATOMIC_RELAXED);
+    }
+  }
+  fflush(log->fp);
+  return NULL;
+}
+
+FTLOG* ftlog_open(const char *path, size_t capacity){
+  FTLOG *log;
+  size_t sz = FTLOG_MIN_CAPACITY;
+  while(sz < capacity && sz < ((size_t)1 << 30)){
+    sz <<= 1;
+  }
+  log = (FTLOG*)ftcore_malloc(sizeof(FTLOG));
+  if(!log){
+    return NULL;
+  }
+  memset(log, 0, sizeof(FTLOG));
+  log->capacity = sz;
+  log->ring = (unsigned char*)ftcore_malloc(sz);
+  if(!log->ring){
+    ftcore_free(log);
+    return NULL;
+  }
+  memset(log->ring, 0, sz);
+  log->fp = fopen(path, "ab");
+  if(!log->fp){
+    ftcore_free(log->ring);
+    ftcore_free(log);
+    return NULL;
+  }
+  if(pthread_create(&log->writer, NULL, writer_main, log)){
+    fclose(log->fp);
+    ftcore_free(log->ring);
+    ftcore_free(log);
+    return NULL;
+  }
+  return log;
+}
+
+void ftlog_close(FTLOG *log){
+  if(!log){
+    return;
+  }
+  __atomic_store_n(&log->quit, 1, __ATOMIC_RELEASE);
+  pthread_join(log->writer, NULL);
+  fclose(log->fp);
+  ftcore_free(log->ring);
+  ftcore_free(log);
+}
+
+int ftlog_write(FTLOG *log, const void *head, size_t head_length, const void *body, size_t body_length){
+  size_t length = head_length + body_length;
+  size_t size = record_size(length);
+  uint64_t pos;
+  FTLOG_HEADER *h;
+  if(length > UINT32_MAX || size > log->capacity){
+    __atomic_fetch_add(&log->dropped, 1, __ATOMIC_RELAXED);
+    return -1;
+  }
+  pos = __atomic_load_n(&log->head, __ATOMIC_RELAXED);
+  do{
+    uint64_t tail = __atomic_load_n(&log->tail, __ATOMIC_ACQUIRE);
+    if(pos + size - tail > log->capacity){
+      __atomic_fetch_add(&log->dropped, 1, __ATOMIC_RELAXED);
+      return -1;
+    }
+  }while(!__atomic_compare_exchange_n(&log->head, &pos, pos + size, 1, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+  h = (FTLOG_HEADER*)(log->ring + (size_t)(pos & (log->capacity - 1)));
+  h->length = (uint32_t)length;
+  if(head_length){
+    ring_copy_in(log, pos + sizeof(FTLOG_HEADER), head, head_length);
+  }
+  if(body_length){
+    ring_copy_in(log, pos + sizeof(FTLOG_HEADER) + head_length, body, body_length);
+  }
+  __atomic_store_n(&h->ready, 1, __ATOMIC_RELEASE);
+  return 0;
+}
+
+unsigned long ftlog_dropped(const FTLOG *log){
+  return __atomic_load_n(&log->dropped, __ATOMIC_RELAXED);
+}
+
+unsigned long long ftlog_written(const FTLOG *log){
+  return __atomic_load_n(&log->written, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,35 @@
+#ifndef FTLOG_H
+#define FTLOG_H
+
+#include <stddef.h>
+
+/**
+ * Asynchronous record log: any thread appends records to a lock-free ring
+ * buffer, and a background thread writes them to a file in the order their
+ * space was reserved. A record that does not fit in the ring is dropped
+ * rather than making the caller wait.
+ */
+
+typedef struct _ftlog FTLOG;
+
+/**
+ * @param path opened for appending
+ * @param capacity bytes of the ring, rounded up to a power of 2
+ * @return NULL if the file can not be opened
+ */
+FTLOG* ftlog_open(const char *path, size_t capacity);
+/** writes the records still in the ring, stops the writer and closes the file. */
+void ftlog_close(FTLOG *log);
+
+/**
+ * Appends a record made of two parts, either of which may be empty.
+ * @return 0, or -1 if the ring had no room and the record was dropped
+ */
+int ftlog_write(FTLOG *log, const void *head, size_t head_length, const void *body, size_t body_length);
+
+/** @return records dropped so far */
+unsigned long ftlog_dropped(const FTLOG *log);
+/** @return bytes handed to the file so far */
+unsigned long long ftlog_written(const FTLOG *log);
+
+#endif
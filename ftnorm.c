@@ -1,18 +1,89 @@
-#if HAVE_ICU
-#include <my_global.h>
-#include <my_sys.h>
-#include <m_string.h>
+#include <stdio.h>
+#include <string.h>
 
+#if HAVE_ICU
 #include <unicode/unorm.h>
 #include <unicode/ustring.h>
+#endif
 
+#include "ftcore.h"
+#include "ftconv.h"
 #include "ftnorm.h"
+#include "ftnormtab.h"
+#include "ftprobe.h"
+
+#if HAVE_ICU
+/** runs unorm_normalize() into a new buffer. @return NULL on failure */
+static UChar* uni_normalize_icu_run(const UChar *s, int32_t s_length, UNormalizationMode umode, int32_t opt, int32_t *d_length){
+    UErrorCode ustatus = U_ZERO_ERROR;
+    UChar *d;
+    int32_t d_capacity;
+
+	*d_length = unorm_normalize(s, s_length, umode, opt, NULL, 0, &ustatus);
+	if(U_FAILURE(ustatus) && ustatus!=U_BUFFER_OVERFLOW_ERROR){
+		char buf[1024];
+		sprintf(buf,"ICU unorm_normalize(pre-flighting) error with %d\n", ustatus);
+		fputs(buf, stderr); fflush(stderr);
+		return NULL;
+	}else{
+	    ustatus = U_ZERO_ERROR;
+	}
+	d_capacity = (*d_length+8)/8*8;
+    d = (UChar*)ftcore_malloc(d_capacity*sizeof(UChar));
+    if(!d){
+		fputs("malloc failure\n", stderr); fflush(stderr);
+		return NULL;
+    }
+	*d_length = unorm_normalize(s, s_length, umode, opt, d, d_capacity, &ustatus);
+	if(U_FAILURE(ustatus)){
+		char buf[1024];
+		sprintf(buf,"ICU unorm_normalize error with %d\n", ustatus);
+		fputs(buf, stderr); fflush(stderr);
+		ftcore_free(d);
+		return NULL;
+	}
+	return d;
+}
+
+/** runs u_strFoldCase() into a new buffer. @return NULL on failure */
+static UChar* uni_fold_icu_run(const UChar *s, int32_t s_length, int32_t *d_length){
+    UErrorCode ustatus = U_ZERO_ERROR;
+    UChar *d;
+    int32_t d_capacity;
+
+	*d_length = u_strFoldCase(NULL, 0, s, s_length, U_FOLD_CASE_DEFAULT, &ustatus);
+	if(U_FAILURE(ustatus) && ustatus!=U_BUFFER_OVERFLOW_ERROR){
+		char buf[1024];
+		sprintf(buf,"ICU u_strFoldCase(pre-flighting) error with %d\n", ustatus);
+		fputs(buf, stderr); fflush(stderr);
+		return NULL;
+	}else{
+	    ustatus = U_ZERO_ERROR;
+	}
+	d_capacity = (*d_length+8)/8*8;
+    d = (UChar*)ftcore_malloc(d_capacity*sizeof(UChar));
+    if(!d){
+		fputs("malloc failure\n", stderr); fflush(stderr);
+		return NULL;
+    }
+	*d_length = u_strFoldCase(d, d_capacity, s, s_length, U_FOLD_CASE_DEFAULT, &ustatus);
+	if(U_FAILURE(ustatus)){
+		char buf[1024];
+		sprintf(buf,"ICU u_strFoldCase error with %d\n", ustatus);
+		fputs(buf, stderr); fflush(stderr);
+		ftcore_free(d);
+		return NULL;
+	}
+	return d;
+}
 
 /**
- * @param mode same with ICU mode flag UNormalizationMode.
+ * @param mode FTCORE_NORM_*. the case folding forms are decomposed, folded
+ * and composed again.
  */
-size_t uni_normalize(char* src, size_t src_len, char* dst, size_t dst_capacity, int mode, int opt){
-    UNormalizationMode umode = (UNormalizationMode)mode;
+static size_t uni_normalize_icu(const char* src, size_t src_len, char* dst, size_t dst_capacity, int mode, int opt){
+    UNormalizationMode umode = UNORM_NONE;
+    UNormalizationMode fold_umode = UNORM_NONE;
     // status holder
     UErrorCode ustatus = U_ZERO_ERROR;
     // UChar source
@@ -20,10 +91,21 @@ size_t uni_normalize(char* src, size_t src_len, char* dst, size_t dst_capacity,
     int32_t s_length, s_capacity;
     // UChar normalized
     UChar *d;
-    int32_t d_length, d_capacity;
+    int32_t d_length;
     // UTF8 normalzied
     int32_t dst_alloc;
-	
+
+    switch(mode){
+      case FTCORE_NORM_C:     umode = UNORM_NFC; break;
+      case FTCORE_NORM_D:     umode = UNORM_NFD; break;
+      case FTCORE_NORM_KC:    umode = UNORM_NFKC; break;
+      case FTCORE_NORM_KD:    umode = UNORM_NFKD; break;
+      case FTCORE_NORM_FCD:   umode = UNORM_FCD; break;
+      case FTCORE_NORM_C_CF:  umode = UNORM_NFC;  fold_umode = UNORM_NFD; break;
+      case FTCORE_NORM_KC_CF: umode = UNORM_NFKC; fold_umode = UNORM_NFKD; break;
+      default: break;
+    }
+
     // convert UTF-8 -> UChar
 	u_strFromUTF8(NULL, 0, &s_length, src, (int32_t)src_len, &ustatus);
 	if(U_FAILURE(ustatus) && ustatus!=U_BUFFER_OVERFLOW_ERROR){
@@ -35,7 +117,7 @@ size_t uni_normalize(char* src, size_t src_len, char* dst, size_t dst_capacity,
 	    ustatus = U_ZERO_ERROR;
 	}
 	s_capacity = (s_length+7)/8*8; // for '\0' termination
-    s = (UChar*)my_malloc(s_capacity*sizeof(UChar), MYF(MY_WME));
+    s = (UChar*)ftcore_malloc(s_capacity*sizeof(UChar));
     if(!s){
 		fputs("malloc failure\n", stderr); fflush(stderr);
 		return 0;
@@ -45,46 +127,480 @@ size_t uni_normalize(char* src, size_t src_len, char* dst, size_t dst_capacity,
 		char buf[1024];
 		sprintf(buf,"ICU u_strFromUTF8 error with %d\n", ustatus);
 		fputs(buf, stderr); fflush(stderr);
-		my_free(s);
+		ftcore_free(s);
 		return 0;
 	}else{
 	    ustatus = U_ZERO_ERROR;
 	}
-	
+
+    if(fold_umode != UNORM_NONE){
+        d = uni_normalize_icu_run(s, s_length, fold_umode, (int32_t)opt, &d_length);
+        ftcore_free(s);
+        if(!d){
+            return 0;
+        }
+        s = uni_fold_icu_run(d, d_length, &s_length);
+        ftcore_free(d);
+        if(!s){
+            return 0;
+        }
+    }
+
     // normalize
-	d_length = unorm_normalize(s, s_length, umode, (int32_t)opt, NULL, 0, &ustatus);
-	if(U_FAILURE(ustatus) && ustatus!=U_BUFFER_OVERFLOW_ERROR){
-		char buf[1024];
-		sprintf(buf,"ICU unorm_normalize(pre-flighting) error with %d\n", ustatus);
-		fputs(buf, stderr); fflush(stderr);
-		my_free(s);
-		return 0;
-	}else{
-	    ustatus = U_ZERO_ERROR;
-	}
-	d_capacity = (d_length+7)/8*8;
-    d = (UChar*)my_malloc(d_capacity*sizeof(UChar), MYF(MY_WME));
+    d = uni_normalize_icu_run(s, s_length, umode, (int32_t)opt, &d_length);
+	ftcore_free(s);
     if(!d){
-		fputs("malloc failure\n", stderr); fflush(stderr);
-		my_free(s);
-		return 0;
+        return 0;
     }
-	d_length = unorm_normalize(s, s_length, umode, (int32_t)opt, d, d_capacity, &ustatus);
-	if(U_FAILURE(ustatus)){
-		char buf[1024];
-		sprintf(buf,"ICU unorm_normalize error with %d\n", ustatus);
-		fputs(buf, stderr); fflush(stderr);
-		my_free(s);
-		my_free(d);
-		return 0;
-	}else{
-	    ustatus = U_ZERO_ERROR;
-	}
-	my_free(s);
-	
+
     // encode UChar -> UTF-8
     u_strToUTF8(dst, (int32_t)dst_capacity, &dst_alloc, d, d_length, &ustatus);
-    my_free(d);
+    ftcore_free(d);
 	return (size_t)dst_alloc;
 }
 #endif
+
+/** tables */
+#define FTNORM_SBASE  0xAC00
+#define FTNORM_LBASE  0x1100
+#define FTNORM_VBASE  0x1161
+#define FTNORM_TBASE  0x11A7
+#define FTNORM_LCOUNT 19
+#define FTNORM_VCOUNT 21
+#define FTNORM_TCOUNT 28
+#define FTNORM_NCOUNT (FTNORM_VCOUNT * FTNORM_TCOUNT)
+#define FTNORM_SCOUNT (FTNORM_LCOUNT * FTNORM_NCOUNT)
+
+/** normalized UTF-8. past the capacity it is only counted. */
+struct ftnorm_out {
+  char *dst;
+  size_t capacity;
+  size_t length;
+};
+
+struct ftnorm_item {
+  ftcore_wc wc;
+  unsigned int ccc;
+};
+
+/** a starter and the characters that may combine with it, in canonical order */
+struct ftnorm_seg {
+  struct ftnorm_item *items;
+  size_t n;
+  size_t capacity;
+  struct ftnorm_item local[32];
+};
+
+static const struct ftnormtab_record* ftnorm_record(ftcore_wc wc){
+  if(wc > 0xFFFF){
+    return &ftnormtab_records[0];
+  }
+  return &ftnormtab_records[ftnormtab_stage2[ftnormtab_stage1[wc >> 6] * 64 + (wc & 63)]];
+}
+
+/** @return the primary composite of a and b, or 0 */
+static ftcore_wc ftnorm_compose(ftcore_wc a, ftcore_wc b){
+  size_t lo = 0, hi = sizeof(ftnormtab_pairs) / sizeof(ftnormtab_pairs[0]);
+  if(a >= FTNORM_LBASE && a < FTNORM_LBASE + FTNORM_LCOUNT && b >= FTNORM_VBASE && b < FTNORM_VBASE + FTNORM_VCOUNT){
+    return FTNORM_SBASE + ((a - FTNORM_LBASE) * FTNORM_VCOUNT + (b - FTNORM_VBASE)) * FTNORM_TCOUNT;
+  }
+  if(a >= FTNORM_SBASE && a < FTNORM_SBASE + FTNORM_SCOUNT && (a - FTNORM_SBASE) % FTNORM_TCOUNT == 0
+      && b > FTNORM_TBASE && b < FTNORM_TBASE + FTNORM_TCOUNT){
+    return a + (b - FTNORM_TBASE);
+  }
+  if(a > 0xFFFF || b > 0xFFFF){
+    return 0;
+  }
+  while(lo < hi){
+    size_t mid = (lo + hi) / 2;
+    const struct ftnormtab_pair *p = &ftnormtab_pairs[mid];
+    if(p->first < a || (p->first == a && p->second < b)){
+      lo = mid + 1;
+    }else if(p->first == a && p->second == b){
+      return p->composite;
+    }else{
+      hi = mid;
+    }
+  }
+  return 0;
+}
+
+#if HAVE_ICU
+/** @return whether nothing before wc changes by it, in the mapping given */
+static int ftnorm_boundary(ftcore_wc wc, int variant){
+  const struct ftnormtab_record *r = ftnorm_record(wc);
+  if(r->flags & FTNORMTAB_HANGUL){
+    return 1;
+  }
+  if(r->map[variant]){
+    r = ftnorm_record(ftnormtab_maps[r->map[variant] + 1]);
+  }
+  return r->ccc == 0 && !(r->flags & FTNORMTAB_BACK);
+}
+#endif
+
+static void ftnorm_put(struct ftnorm_out *out, ftcore_wc wc){
+  char tmp[4];
+  size_t n;
+  if(wc < 0x80){
+    tmp[0] = (char)wc;
+    n = 1;
+  }else if(wc < 0x800){
+    tmp[0] = (char)(0xC0 | (wc >> 6));
+    tmp[1] = (char)(0x80 | (wc & 0x3F));
+    n = 2;
+  }else if(wc < 0x10000){
+    tmp[0] = (char)(0xE0 | (wc >> 12));
+    tmp[1] = (char)(0x80 | ((wc >> 6) & 0x3F));
+    tmp[2] = (char)(0x80 | (wc & 0x3F));
+    n = 3;
+  }else{
+    tmp[0] = (char)(0xF0 | (wc >> 18));
+    tmp[1] = (char)(0x80 | ((wc >> 12) & 0x3F));
+    tmp[2] = (char)(0x80 | ((wc >> 6) & 0x3F));
+    tmp[3] = (char)(0x80 | (wc & 0x3F));
+    n = 4;
+  }
+  if(out->length + n <= out->capacity){
+    memcpy(out->dst + out->length, tmp, n);
+  }
+  out->length += n;
+}
+
+/** the state of one normalization */
+struct ftnorm_ctx {
+  int variant;  // FTNORMTAB_CANON or FTNORMTAB_COMPAT
+  int fold;     // FTNORMTAB_*_FOLD, or -1
+  int compose;
+  struct ftnorm_seg seg;
+  struct ftnorm_seg folded;
+  struct ftnorm_out out;
+};
+
+static void ftnorm_seg_init(struct ftnorm_seg *seg){
+  seg->items = seg->local;
+  seg->n = 0;
+  seg->capacity = sizeof(seg->local) / sizeof(seg->local[0]);
+}
+
+static void ftnorm_seg_deinit(struct ftnorm_seg *seg){
+  if(seg->items != seg->local){
+    ftcore_free(seg->items);
+  }
+}
+
+/** appends wc, keeping the combining marks in canonical order */
+static int ftnorm_push(struct ftnorm_seg *seg, ftcore_wc wc, unsigned int ccc){
+  size_t i;
+  if(seg->n == seg->capacity){
+    size_t capacity = seg->capacity * 2;
+    struct ftnorm_item *tmp;
+    if(seg->items == seg->local){
+      tmp = (struct ftnorm_item*)ftcore_malloc(capacity * sizeof(struct ftnorm_item));
+      if(tmp){ memcpy(tmp, seg->local, sizeof(seg->local)); }
+    }else{
+      tmp = (struct ftnorm_item*)ftcore_realloc(seg->items, capacity * sizeof(struct ftnorm_item));
+    }
+    if(!tmp){
+      return -1;
+    }
+    seg->items = tmp;
+    seg->capacity = capacity;
+  }
+  i = seg->n++;
+  while(ccc && i > 0 && seg->items[i - 1].ccc > ccc){
+    seg->items[i] = seg->items[i - 1];
+    i--;
+  }
+  seg->items[i].wc = wc;
+  seg->items[i].ccc = ccc;
+  return 0;
+}
+
+/**
+ * Case folds the segment if asked, composes it if asked, and writes it out.
+ * Folding comes after the canonical ordering, as it may turn a combining
+ * mark into a starter (U+0345 into U+03B9).
+ */
+static int ftnorm_flush(struct ftnorm_ctx *ctx){
+  struct ftnorm_seg *seg = &ctx->seg;
+  struct ftnorm_item *items;
+  size_t i;
+  if(ctx->fold >= 0){
+    for(i=0; i<seg->n && !ftnorm_record(seg->items[i].wc)->map[ctx->fold]; i++);
+    if(i < seg->n){
+      ctx->folded.n = 0;
+      for(i=0; i<seg->n; i++){
+        const struct ftnormtab_record *r = ftnorm_record(seg->items[i].wc);
+        if(r->map[ctx->fold]){
+          const unsigned short *m = &ftnormtab_maps[r->map[ctx->fold]];
+          unsigned int k;
+          for(k=1; k<=m[0]; k++){
+            if(ftnorm_push(&ctx->folded, m[k], ftnorm_record(m[k])->ccc)){
+              return -1;
+            }
+          }
+        }else if(ftnorm_push(&ctx->folded, seg->items[i].wc, seg->items[i].ccc)){
+          return -1;
+        }
+      }
+      seg->n = 0;
+      seg = &ctx->folded;
+    }
+  }
+  items = seg->items;
+  if(ctx->compose && seg->n > 1){
+    int starter = items[0].ccc == 0;
+    size_t st = 0, w = 1;
+    unsigned int last = 0; // ccc of the last character kept after the starter
+    for(i=1; i<seg->n; i++){
+      ftcore_wc comp;
+      // blocked by a character in between of the same or higher class
+      if(starter && (w - 1 == st || (items[i].ccc != 0 && last < items[i].ccc))
+          && (comp = ftnorm_compose(items[st].wc, items[i].wc)) != 0){
+        items[st].wc = comp;
+        continue;
+      }
+      if(items[i].ccc == 0){
+        starter = 1;
+        st = w;
+      }
+      last = items[i].ccc;
+      items[w++] = items[i];
+    }
+    seg->n = w;
+  }
+  for(i=0; i<seg->n; i++){
+    ftnorm_put(&ctx->out, items[i].wc);
+  }
+  seg->n = 0;
+  return 0;
+}
+
+static int ftnorm_add(struct ftnorm_ctx *ctx, ftcore_wc wc){
+  const struct ftnormtab_record *r = ftnorm_record(wc);
+  if(r->ccc == 0 && !(r->flags & FTNORMTAB_BACK) && ctx->seg.n && ftnorm_flush(ctx)){
+    return -1;
+  }
+  return ftnorm_push(&ctx->seg, wc, r->ccc);
+}
+
+/** @return the character at *s of valid UTF-8, moving *s past it */
+static ftcore_wc ftnorm_next(const unsigned char **s){
+  const unsigned char *p = *s;
+  if(p[0] < 0x80){
+    *s = p + 1;
+    return p[0];
+  }
+  if(p[0] < 0xE0){
+    *s = p + 2;
+    return (ftcore_wc)(p[0] & 0x1F) << 6 | (p[1] & 0x3F);
+  }
+  if(p[0] < 0xF0){
+    *s = p + 3;
+    return (ftcore_wc)(p[0] & 0x0F) << 12 | (ftcore_wc)(p[1] & 0x3F) << 6 | (p[2] & 0x3F);
+  }
+  *s = p + 4;
+  return (ftcore_wc)(p[0] & 0x07) << 18 | (ftcore_wc)(p[1] & 0x3F) << 12 | (ftcore_wc)(p[2] & 0x3F) << 6 | (p[3] & 0x3F);
+}
+
+/** normalizes valid UTF-8 by the tables. what they do not cover is left as it is. */
+static int ftnorm_table(struct ftnorm_ctx *ctx, const unsigned char *s, const unsigned char *e){
+  while(s < e){
+    ftcore_wc wc = ftnorm_next(&s);
+    const struct ftnormtab_record *r = ftnorm_record(wc);
+    int ret = 0;
+    if(r->flags & FTNORMTAB_HANGUL){
+      ftcore_wc si = wc - FTNORM_SBASE;
+      ret |= ftnorm_add(ctx, FTNORM_LBASE + si / FTNORM_NCOUNT);
+      ret |= ftnorm_add(ctx, FTNORM_VBASE + (si % FTNORM_NCOUNT) / FTNORM_TCOUNT);
+      if(si % FTNORM_TCOUNT){
+        ret |= ftnorm_add(ctx, FTNORM_TBASE + si % FTNORM_TCOUNT);
+      }
+    }else if(r->map[ctx->variant]){
+      const unsigned short *m = &ftnormtab_maps[r->map[ctx->variant]];
+      unsigned int i;
+      for(i=1; i<=m[0]; i++){
+        ret |= ftnorm_add(ctx, m[i]);
+      }
+    }else{
+      ret = ftnorm_add(ctx, wc);
+    }
+    if(ret){
+      return -1;
+    }
+  }
+  return ftnorm_flush(ctx);
+}
+
+static size_t uni_normalize_tables(char* src, size_t src_len, char* dst, size_t dst_capacity, int mode){
+  const unsigned char *pos = (const unsigned char*)src;
+  const unsigned char *end = pos + src_len;
+  const unsigned char *start = pos;
+  struct ftnorm_ctx ctx;
+  int ret = 0;
+  ctx.fold = -1;
+  ctx.compose = 1;
+  switch(mode){
+    case FTCORE_NORM_C:     ctx.variant = FTNORMTAB_CANON; break;
+    case FTCORE_NORM_D:     ctx.variant = FTNORMTAB_CANON; ctx.compose = 0; break;
+    case FTCORE_NORM_KC:    ctx.variant = FTNORMTAB_COMPAT; break;
+    case FTCORE_NORM_KD:    ctx.variant = FTNORMTAB_COMPAT; ctx.compose = 0; break;
+    case FTCORE_NORM_C_CF:  ctx.variant = FTNORMTAB_CANON; ctx.fold = FTNORMTAB_CANON_FOLD; break;
+    case FTCORE_NORM_KC_CF: ctx.variant = FTNORMTAB_COMPAT; ctx.fold = FTNORMTAB_COMPAT_FOLD; break;
+    default: return 0;
+  }
+  ctx.out.dst = dst;
+  ctx.out.capacity = dst_capacity;
+  ctx.out.length = 0;
+  ftnorm_seg_init(&ctx.seg);
+  ftnorm_seg_init(&ctx.folded);
+#if HAVE_ICU
+  {
+    const unsigned char *boundary = pos; // the last character nothing before is changed by
+    while(pos < end){
+      const unsigned char *at = pos;
+      ftcore_wc wc = ftnorm_next(&pos);
+      size_t used;
+      if(ftnorm_record(wc)->flags & FTNORMTAB_COVERED){
+        if(ftnorm_boundary(wc, ctx.variant)){
+          boundary = at;
+        }
+        continue;
+      }
+      // ICU takes the text from the last boundary to the next covered one
+      if(ftnorm_table(&ctx, start, boundary)){
+        ret = -1;
+        break;
+      }
+      while(pos < end){
+        at = pos;
+        wc = ftnorm_next(&pos);
+        if((ftnorm_record(wc)->flags & FTNORMTAB_COVERED) && ftnorm_boundary(wc, ctx.variant)){
+          pos = at;
+          break;
+        }
+      }
+      used = uni_normalize_icu((const char*)boundary, (size_t)(pos - boundary),
+                               ctx.out.length < ctx.out.capacity ? ctx.out.dst + ctx.out.length : NULL,
+                               ctx.out.length < ctx.out.capacity ? ctx.out.capacity - ctx.out.length : 0, mode, 0);
+      if(!used){
+        ret = -1;
+        break;
+      }
+      ctx.out.length += used;
+      start = boundary = pos;
+    }
+  }
+#endif
+  if(!ret){
+    ret = ftnorm_table(&ctx, start, end);
+  }
+  ftnorm_seg_deinit(&ctx.seg);
+  ftnorm_seg_deinit(&ctx.folded);
+  return ret ? 0 : ctx.out.length;
+}
+/** /tables */
+
+/** normalizes valid UTF-8 */
+static size_t uni_normalize_valid(char* src, size_t src_len, char* dst, size_t dst_capacity, int mode, int unicode_3_2){
+    if(mode != FTCORE_NORM_FCD && !unicode_3_2){
+        return uni_normalize_tables(src, src_len, dst, dst_capacity, mode);
+    }
+#if HAVE_ICU
+    return uni_normalize_icu(src, src_len, dst, dst_capacity, mode, unicode_3_2 ? UNORM_UNICODE_3_2 : 0);
+#else
+    return 0;
+#endif
+}
+
+size_t uni_normalize(char* src, size_t src_len, char* dst, size_t dst_capacity, int mode, int unicode_3_2){
+    size_t ret = 0;
+    size_t pos = 0;
+    FTPROBE1(normalize_begin, src_len);
+    // the valid runs are normalized, the bytes between them copied as they are.
+    while(pos < src_len){
+        size_t valid = ftconv_utf8_valid(src + pos, src_len - pos);
+        if(valid > 0){
+            size_t used = uni_normalize_valid(src + pos, valid,
+                                              ret < dst_capacity ? dst + ret : NULL,
+                                              ret < dst_capacity ? dst_capacity - ret : 0, mode, unicode_3_2);
+            if(!used){
+                ret = 0;
+                break;
+            }
+            ret += used;
+            pos += valid;
+        }
+        if(pos < src_len){
+            if(ret < dst_capacity){
+                dst[ret] = src[pos];
+            }
+            ret++;
+            pos++;
+        }
+    }
+    FTPROBE2(normalize_end, ret, ret != 0);
+    return ret;
+}
+
+/** accents */
+/** writes wc into dst by cs. @return bytes written, 0 if it did not fit */
+static size_t uni_unaccent_put(const FTCORE_CODEC *cs, ftcore_wc wc, unsigned char *dst, unsigned char *end){
+  int n = cs->encode(cs, wc, dst, end);
+  if(n == FTCORE_ILSEQ){
+    n = cs->encode(cs, '?', dst, end);
+  }
+  return n > 0 ? (size_t)n : 0;
+}
+
+size_t uni_unaccent(const FTCORE_CODEC *cs, const char *src, size_t length, char *dst, size_t capacity){
+  const unsigned char *s = (const unsigned char*)src;
+  const unsigned char *e = s + length;
+  unsigned char *d = (unsigned char*)dst;
+  unsigned char *dend = d + capacity;
+  while(s < e){
+    const struct ftnormtab_record *r;
+    ftcore_wc wc;
+    int n;
+    if(*s < 0x80 && (cs->encoding == FTCORE_ENC_UTF8 || (cs->encoding == FTCORE_ENC_SBCS && cs->to_uni[*s] == *s))){
+      if(d == dend){ break; }
+      *d++ = *s++;
+      continue;
+    }
+    n = cs->decode(cs, &wc, s, e);
+    if(n <= 0){
+      break; // tokens are whole characters, so this is damage.
+    }
+    s += n;
+    r = ftnorm_record(wc);
+    if(r->flags & FTNORMTAB_MARK){
+      continue;
+    }
+    if(r->map[FTNORMTAB_CANON]){
+      // an accented letter decomposes into one letter and its accents.
+      const unsigned short *m = &ftnormtab_maps[r->map[FTNORMTAB_CANON]];
+      ftcore_wc base = 0;
+      int accented = 0;
+      unsigned int i;
+      for(i=1; i<=m[0]; i++){
+        if(ftnorm_record(m[i])->flags & FTNORMTAB_MARK){
+          accented = 1;
+        }else{
+          base = m[i];
+        }
+      }
+      if(accented){
+        if(!base){ continue; }
+        wc = base;
+      }
+    }
+    n = (int)uni_unaccent_put(cs, wc, d, dend);
+    if(!n){
+      break;
+    }
+    d += n;
+  }
+  return (size_t)((char*)d - dst);
+}
+/** /accents */
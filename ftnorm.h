@@ -1,10 +1,30 @@
+#ifndef FTNORM_H
+#define FTNORM_H
+
+#include "ftcore.h"
+
 /**
+ * Text in the blocks of ftnormtab.h is normalized by the tables, the rest
+ * by ICU. Without ICU the rest is left as it is, and FCD and Unicode 3.2
+ * fail.
  * @param src source UTF-8 string pointer
  * @param src_len source UTF-8 string length (byte length)
  * @param dst normalized UTF-8 string pointer
  * @param dst_capacity normalized UTF-8 string length (byte length)
- * @param mode normalization mode
- * @param options normalization options
- * @return actual size of written. 0 on failure.
+ * @param mode FTCORE_NORM_*
+ * @param unicode_3_2 normalize by Unicode 3.2
+ * @return size of the normalized string, larger than dst_capacity if it did not fit. 0 on failure.
  */
-size_t uni_normalize(char* src, size_t src_len, char* dst, size_t dst_capacity, int mode, int options);
+size_t uni_normalize(char* src, size_t src_len, char* dst, size_t dst_capacity, int mode, int unicode_3_2);
+
+/**
+ * Strips the accents of the Latin, Greek and Cyrillic letters by their
+ * canonical decompositions in ftnormtab.h; the kana voicing marks are kept.
+ * No character gets longer. One whose base letter the charset lacks
+ * becomes '?'.
+ * @param cs charset of src and dst
+ * @return bytes written, stopping at the last character that fits capacity
+ */
+size_t uni_unaccent(const FTCORE_CODEC *cs, const char *src, size_t length, char *dst, size_t capacity);
+
+#endif
@@ -0,0 +1,2336 @@
+/* generated by tools/mknormtab.py from Unicode 15.1.0. do not edit. */
+#ifndef FTNORMTAB_H
+#define FTNORMTAB_H
+
+#define FTNORMTAB_UNICODE "15.1.0"
+
+#define FTNORMTAB_COVERED 1 // normalized by the tables
+#define FTNORMTAB_BACK    2 // composes with the character before
+#define FTNORMTAB_HANGUL  4 // a Hangul syllable, decomposed by arithmetic
+#define FTNORMTAB_MARK    8 // an accent, stripped by uni_unaccent()
+
+/** the mappings of a record */
+#define FTNORMTAB_CANON       0
+#define FTNORMTAB_COMPAT      1
+#define FTNORMTAB_CANON_FOLD  2 // of decomposed text
+#define FTNORMTAB_COMPAT_FOLD 3
+
+struct ftnormtab_record {
+  unsigned char ccc;
+  unsigned char flags;
+  unsigned short map[4]; // 0 for the code point itself, or where its length is in ftnormtab_maps
+};
+
+struct ftnormtab_pair {
+  unsigned short first, second, composite;
+};
+
+static const unsigned short ftnormtab_stage1[1024] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 21, 26, 27, 28, 21, 29,
+  30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 38, 39, 36, 40, 41, 42,
+  38, 43, 38, 44, 45, 42, 21, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+  55, 21, 56, 21, 0, 57, 58, 59, 21, 21, 21, 21, 21, 60, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 61, 21, 21, 62,
+  21, 21, 63, 21, 64, 21, 21, 21, 65, 66, 67, 68, 69, 70, 71, 72,
+  73, 21, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 0, 0, 0,
+  0, 101, 102, 103, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 104, 21, 105, 21, 106, 21, 107, 21, 21, 21, 21, 21, 21, 21, 21,
+  108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 124, 125, 126, 127, 128, 129, 130,
+  131, 21, 21, 132, 133, 134, 135, 136, 21, 21, 137, 138, 115, 139, 21, 140,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 142, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 143, 144, 145, 146, 147, 148, 149, 150, 151, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 152, 153, 21, 21, 154, 155, 156, 157
+};
+
+static const unsigned short ftnormtab_stage2[10112] = {
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+  17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  28, 1, 1, 1, 1, 1, 1, 1, 29, 1, 30, 1, 1, 1, 1, 31,
+  1, 1, 32, 33, 34, 35, 1, 1, 36, 37, 38, 1, 39, 40, 41, 1,
+  42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+  58, 59, 60, 61, 62, 63, 64, 1, 65, 66, 67, 68, 69, 70, 71, 72,
+  73, 74, 75, 76, 77, 78, 1, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  1, 88, 89, 90, 91, 92, 93, 1, 1, 94, 95, 96, 97, 98, 1, 99,
+  100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+  116, 1, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
+  131, 132, 133, 134, 135, 136, 137, 1, 138, 139, 140, 141, 142, 143, 144, 145,
+  146, 1, 147, 148, 149, 150, 151, 152, 1, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 1, 162, 163, 164, 165, 166, 167, 168, 169, 1, 170, 171, 172, 173,
+  174, 175, 176, 1, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
+  189, 190, 191, 192, 193, 194, 195, 1, 196, 197, 198, 199, 200, 201, 202, 203,
+  204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
+  1, 220, 221, 1, 222, 1, 223, 224, 1, 225, 226, 227, 1, 1, 228, 229,
+  230, 231, 1, 232, 233, 1, 234, 235, 236, 1, 1, 1, 237, 238, 1, 239,
+  240, 241, 242, 1, 243, 1, 244, 245, 1, 246, 1, 1, 247, 1, 248, 249,
+  250, 251, 252, 253, 1, 254, 1, 255, 256, 1, 1, 1, 257, 1, 1, 1,
+  1, 1, 1, 1, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+  270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 1, 283, 284,
+  285, 286, 287, 288, 289, 1, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+  300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+  316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+  332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 1, 345, 346,
+  347, 1, 348, 1, 349, 1, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359,
+  360, 361, 362, 363, 1, 1, 1, 1, 1, 1, 364, 365, 1, 366, 367, 1,
+  1, 368, 1, 369, 370, 371, 372, 1, 373, 1, 374, 1, 375, 1, 376, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  377, 378, 379, 380, 381, 382, 383, 384, 385, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 386, 387, 388, 389, 390, 391, 1, 1,
+  392, 393, 394, 395, 396, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  397, 397, 397, 397, 397, 398, 397, 397, 397, 397, 397, 397, 397, 398, 398, 397,
+  398, 397, 398, 397, 397, 399, 400, 400, 400, 400, 399, 401, 400, 400, 400, 400,
+  400, 402, 402, 403, 403, 403, 403, 404, 404, 400, 400, 400, 400, 403, 403, 400,
+  403, 403, 400, 400, 405, 405, 405, 405, 406, 400, 400, 400, 400, 398, 398, 398,
+  407, 408, 397, 409, 410, 411, 398, 400, 400, 400, 398, 398, 398, 400, 400, 412,
+  398, 398, 398, 400, 400, 400, 400, 398, 399, 400, 400, 398, 413, 414, 414, 413,
+  414, 414, 413, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+  415, 1, 416, 1, 417, 1, 418, 1, 1, 1, 419, 1, 1, 1, 420, 421,
+  1, 1, 1, 1, 34, 422, 423, 424, 425, 426, 427, 1, 428, 1, 429, 430,
+  431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+  447, 448, 1, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461,
+  462, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 449, 1, 1, 1, 1, 1, 1, 1, 463, 464, 465, 466, 467, 468,
+  469, 470, 471, 472, 473, 474, 475, 1, 476, 1, 477, 1, 478, 1, 479, 1,
+  480, 1, 481, 1, 482, 1, 483, 1, 484, 1, 485, 1, 486, 1, 487, 1,
+  488, 489, 490, 1, 491, 492, 1, 493, 1, 494, 495, 1, 1, 496, 497, 498,
+  499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514,
+  515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+  531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 547, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  548, 549, 1, 550, 1, 1, 1, 551, 1, 1, 1, 1, 552, 553, 554, 1,
+  555, 1, 556, 1, 557, 1, 558, 1, 559, 1, 560, 1, 561, 1, 562, 1,
+  563, 1, 564, 1, 565, 1, 566, 567, 568, 1, 569, 1, 570, 1, 571, 1,
+  572, 1, 1, 398, 398, 398, 398, 398, 412, 412, 573, 1, 574, 1, 575, 1,
+  576, 1, 577, 1, 578, 1, 579, 1, 580, 1, 581, 1, 582, 1, 583, 1,
+  584, 1, 585, 1, 586, 1, 587, 1, 588, 1, 589, 1, 590, 1, 591, 1,
+  592, 1, 593, 1, 594, 1, 595, 1, 596, 1, 597, 1, 598, 1, 599, 1,
+  600, 601, 602, 603, 1, 604, 1, 605, 1, 606, 1, 607, 1, 608, 1, 1,
+  609, 610, 611, 612, 613, 1, 614, 615, 616, 1, 617, 618, 619, 620, 621, 622,
+  623, 1, 624, 625, 626, 627, 628, 629, 630, 1, 631, 632, 633, 634, 635, 636,
+  637, 638, 639, 640, 641, 642, 643, 1, 644, 645, 646, 1, 647, 1, 648, 1,
+  649, 1, 650, 1, 651, 1, 652, 1, 653, 1, 654, 1, 655, 1, 656, 1,
+  657, 1, 658, 1, 659, 1, 660, 1, 661, 1, 662, 1, 663, 1, 664, 1,
+  665, 1, 666, 1, 667, 1, 668, 1, 669, 1, 670, 1, 671, 1, 672, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 673, 674, 674, 674, 674, 673, 674, 674, 674, 675, 673, 674, 674, 674, 674,
+  674, 674, 673, 673, 673, 673, 673, 673, 674, 674, 673, 674, 674, 675, 676, 674,
+  677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 686, 687, 688, 689, 0, 690,
+  0, 691, 692, 0, 674, 673, 0, 685, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  674, 674, 674, 674, 674, 674, 674, 674, 693, 694, 695, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 696, 697, 698, 693, 694,
+  695, 699, 700, 701, 701, 702, 673, 674, 674, 674, 674, 674, 673, 674, 674, 673,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 674, 674, 674, 674, 674, 674, 674, 0, 0, 674,
+  674, 674, 674, 673, 674, 0, 0, 674, 674, 0, 673, 674, 674, 673, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  674, 673, 674, 674, 673, 674, 674, 673, 673, 673, 674, 673, 673, 674, 673, 674,
+  674, 674, 673, 674, 673, 674, 673, 674, 673, 674, 674, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 674, 674, 674, 674, 674,
+  674, 674, 673, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 673, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 674, 674, 674, 674, 0, 674, 674, 674, 674, 674,
+  674, 674, 674, 674, 0, 674, 674, 674, 0, 674, 674, 674, 674, 674, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 673, 673, 673, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 674, 673, 673, 673, 674, 674, 674, 674,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 674, 674, 674, 674, 674, 673,
+  673, 673, 673, 673, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674,
+  674, 674, 0, 673, 674, 674, 673, 674, 674, 673, 674, 674, 674, 673, 673, 673,
+  696, 697, 698, 674, 674, 674, 673, 674, 674, 673, 673, 674, 674, 674, 674, 674,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 705, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0,
+  0, 674, 673, 674, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 707, 0, 708, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 708, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 674, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 707, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0,
+  0, 0, 0, 0, 0, 0, 708, 708, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 708, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0,
+  0, 0, 0, 0, 0, 709, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 708, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0,
+  0, 0, 0, 0, 0, 708, 708, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 706, 0, 708, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 711, 0, 0, 0, 0, 708,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 712, 712, 706, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 713, 713, 713, 713, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 714, 714, 706, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 715, 715, 715, 715, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 673, 673, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 673, 0, 673, 0, 716, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 717, 718, 0, 719, 0, 0, 0, 0, 0, 718, 718, 718, 718, 0, 0,
+  718, 0, 674, 674, 706, 0, 674, 674, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 673, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 708, 0,
+  0, 0, 0, 0, 0, 0, 0, 707, 0, 706, 706, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 673, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+  720, 720, 720, 720, 720, 720, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 720, 720, 720, 720, 720, 720, 720, 720,
+  720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+  720, 720, 720, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 674, 674, 674,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 706, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 674, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 676, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 675, 674, 673, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 674, 673, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 674, 674, 674, 674, 674, 674, 674, 674, 0, 0, 673,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  398, 398, 398, 398, 398, 400, 400, 400, 400, 400, 400, 398, 398, 400, 412, 400,
+  400, 398, 398, 400, 400, 398, 398, 398, 398, 398, 400, 398, 398, 398, 398, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 707, 708, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 674, 673, 674, 674, 674,
+  674, 674, 674, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 706, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 707, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 706, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 707, 0, 0, 0, 0, 0, 0, 0, 0,
+  517, 519, 529, 532, 533, 533, 541, 556, 721, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  674, 674, 674, 0, 722, 673, 673, 673, 673, 673, 674, 674, 673, 673, 673, 673,
+  674, 0, 722, 722, 722, 722, 722, 722, 722, 0, 0, 0, 0, 673, 0, 0,
+  0, 0, 0, 0, 674, 0, 0, 0, 674, 674, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 723, 724, 725, 1,
+  726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 1, 737, 738, 739, 740,
+  741, 742, 743, 30, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 1, 754,
+  755, 756, 38, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+  770, 771, 772, 380, 762, 765, 767, 768, 773, 770, 771, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 774, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 775, 776, 777, 778, 752,
+  779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
+  795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810,
+  398, 398, 400, 398, 398, 398, 398, 398, 398, 398, 400, 398, 398, 414, 811, 400,
+  402, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+  398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+  398, 398, 398, 398, 398, 398, 399, 812, 812, 400, 813, 398, 413, 400, 398, 400,
+  814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829,
+  830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845,
+  846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861,
+  862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877,
+  878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893,
+  894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909,
+  910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925,
+  926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941,
+  942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957,
+  958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 1, 1, 72, 1,
+  970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985,
+  986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001,
+  1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+  1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
+  1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049,
+  1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1, 1061, 1, 1062, 1,
+  1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078,
+  1079, 1080, 1081, 1082, 1083, 1084, 1, 1, 1085, 1086, 1087, 1088, 1089, 1090, 1, 1,
+  1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
+  1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122,
+  1123, 1124, 1125, 1126, 1127, 1128, 1, 1, 1129, 1130, 1131, 1132, 1133, 1134, 1, 1,
+  1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1, 1143, 1, 1144, 1, 1145, 1, 1146,
+  1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162,
+  1163, 458, 1164, 459, 1165, 460, 1166, 461, 1167, 465, 1168, 466, 1169, 467, 1, 1,
+  1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+  1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201,
+  1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217,
+  1218, 1219, 1220, 1221, 1222, 1, 1223, 1224, 1225, 1226, 1227, 423, 1228, 1229, 1230, 1229,
+  1231, 1232, 1233, 1234, 1235, 1, 1236, 1237, 1238, 425, 1239, 426, 1240, 1241, 1242, 1243,
+  1244, 1245, 1246, 431, 1, 1, 1247, 1248, 1249, 1250, 1251, 427, 1, 1252, 1253, 1254,
+  1255, 1256, 1257, 462, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 429, 1265, 1266, 422, 1267,
+  1, 1, 1268, 1269, 1270, 1, 1271, 1272, 1273, 428, 1274, 430, 1275, 1276, 1277, 1,
+  1278, 1279, 28, 28, 28, 28, 28, 28, 28, 28, 28, 1, 1, 1, 1, 1,
+  1, 1280, 1, 1, 1, 1, 1, 1281, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1282, 1283, 1284, 1, 1, 1, 1, 1, 1, 1, 1, 28,
+  1, 1, 1, 1285, 1286, 1, 1287, 1288, 1, 1, 1, 1, 1289, 1, 1290, 1,
+  1, 1, 1, 1, 1, 1, 1, 1291, 1292, 1293, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1294, 1, 1, 1, 1, 1, 1, 1, 28,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1295, 772, 1, 1, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307,
+  1295, 37, 32, 33, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1,
+  30, 749, 38, 395, 750, 377, 754, 393, 755, 1307, 760, 394, 761, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1308, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  398, 398, 405, 405, 398, 398, 398, 398, 405, 405, 405, 398, 398, 412, 412, 412,
+  412, 398, 412, 412, 412, 405, 405, 398, 400, 398, 405, 405, 400, 400, 400, 400,
+  398, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1309, 1310, 1311, 1312, 1, 1313, 1314, 1315, 1, 1316, 753, 730, 730, 730, 377, 1317,
+  731, 731, 734, 393, 1, 736, 1318, 1, 1, 739, 1319, 740, 740, 740, 1, 1,
+  1320, 1321, 1322, 1, 1323, 1, 1324, 1, 1323, 1, 1325, 47, 725, 1311, 1, 749,
+  727, 1326, 1327, 735, 38, 0, 0, 0, 0, 772, 1, 1328, 1329, 768, 1330, 1331,
+  1332, 1, 1, 1, 1, 726, 748, 749, 772, 379, 1, 1, 1, 1, 1, 1,
+  1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
+  1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
+  772, 1365, 1366, 1367, 765, 1368, 1369, 1370, 1371, 395, 1372, 1373, 393, 776, 748, 755,
+  1, 1, 1, 1374, 1, 1, 1, 1, 1, 1375, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1376, 1377, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1378, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1379, 1380, 1381,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1382, 1, 1, 1, 1, 1383, 1, 1, 1384, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1385, 1, 1386, 1, 1, 1, 1, 1, 1387, 1388, 1, 1389,
+  1390, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1391, 1, 1, 1392, 1, 1, 1393, 1, 1394, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1395, 1, 1396, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1397, 1398, 1399,
+  1400, 1401, 1, 1, 1402, 1403, 1, 1, 1404, 1405, 1, 1, 1, 1, 1, 1,
+  1406, 1407, 1, 1, 1408, 1409, 1, 1, 1410, 1411, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1412, 1413, 1414, 1415,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1416, 1417, 1418, 1419, 1, 1, 1, 1, 1, 1, 1420, 1421, 1422, 1423, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1424, 1425, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  37, 32, 33, 1296, 1297, 1298, 1299, 1300, 1301, 1426, 1427, 1428, 1429, 1430, 1431, 1432,
+  1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448,
+  1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464,
+  1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480,
+  1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496,
+  1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512,
+  1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528,
+  30, 747, 776, 748, 749, 779, 753, 377, 772, 379, 754, 393, 755, 1307, 38, 760,
+  1529, 380, 394, 761, 762, 765, 384, 395, 385, 806, 1295, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1530, 1, 1531, 1532, 1533, 1, 1, 1534, 1, 1535, 1, 1536, 1, 1537, 1538, 1539,
+  1540, 1, 1541, 1, 1, 1542, 1, 1, 1, 1, 1, 1, 379, 1543, 1544, 1545,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 674,
+  674, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+  398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+  28, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1546, 1547, 1548, 1549, 1550, 1550,
+  1, 1, 1, 1, 1, 1, 1551, 1, 1552, 1553, 1554, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1555, 1, 1556, 1,
+  1557, 1, 1558, 1, 1559, 1, 1560, 1, 1561, 1, 1562, 1, 1563, 1, 1564, 1,
+  1565, 1, 1566, 1, 1, 1567, 1, 1568, 1, 1569, 1, 1, 1, 1, 1, 1,
+  1570, 1571, 1, 1572, 1573, 1, 1574, 1575, 1, 1576, 1577, 1, 1578, 1579, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1580, 1, 1, 1, 1, 1581, 1581, 1582, 1583, 1, 1584, 1585,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1586, 1, 1587, 1,
+  1588, 1, 1589, 1, 1590, 1, 1591, 1, 1592, 1, 1593, 1, 1594, 1, 1595, 1,
+  1596, 1, 1597, 1, 1, 1598, 1, 1599, 1, 1600, 1, 1, 1, 1, 1, 1,
+  1601, 1602, 1, 1603, 1604, 1, 1605, 1606, 1, 1607, 1608, 1, 1609, 1610, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1611, 1, 1, 1612, 1613, 1614, 1615, 1, 1, 1, 1616, 1617,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632,
+  1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648,
+  1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664,
+  1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680,
+  1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696,
+  1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+  1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1,
+  1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758,
+  1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774,
+  1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1, 1, 1, 1, 1, 1, 1, 1,
+  1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798,
+  1618, 1621, 1624, 1626, 1634, 1635, 1638, 1640, 1641, 1643, 1644, 1645, 1646, 1647, 1799, 1800,
+  1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1,
+  1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1552, 1825, 1826, 1827, 1828, 1829, 1830,
+  1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846,
+  1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862,
+  1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878,
+  1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894,
+  1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910,
+  1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926,
+  1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942,
+  1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958,
+  1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974,
+  1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990,
+  1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006,
+  2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022,
+  2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038,
+  2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054,
+  2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070,
+  2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086,
+  2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102,
+  2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118,
+  2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134,
+  2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150,
+  2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166,
+  2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182,
+  2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198,
+  2199, 1, 2200, 1, 2201, 1, 2202, 1, 2203, 1, 721, 1, 2204, 1, 2205, 1,
+  2206, 1, 2207, 1, 2208, 1, 2209, 1, 2210, 1, 2211, 1, 2212, 1, 2213, 1,
+  2214, 1, 2215, 1, 2216, 1, 2217, 1, 2218, 1, 2219, 1, 2220, 1, 1, 2221,
+  1, 1, 1, 1, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 1, 1,
+  2222, 1, 2223, 1, 2224, 1, 2225, 1, 2226, 1, 2227, 1, 2228, 1, 2229, 1,
+  2230, 1, 2231, 1, 2232, 1, 2233, 1, 2234, 1, 2235, 1, 2236, 2237, 2221, 2221,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  674, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 2238, 1, 2239, 1, 2240, 1, 2241, 1, 2242, 1, 2243, 1, 2244, 1,
+  1, 1, 2245, 1, 2246, 1, 2247, 1, 2248, 1, 2249, 1, 2250, 1, 2251, 1,
+  2252, 1, 2253, 1, 2254, 1, 2255, 1, 2256, 1, 2257, 1, 2258, 1, 2259, 1,
+  2260, 1, 2261, 1, 2262, 1, 2263, 1, 2264, 1, 2265, 1, 2266, 1, 2267, 1,
+  2268, 1, 2269, 1, 2270, 1, 2271, 1, 2272, 1, 2273, 1, 2274, 1, 2275, 1,
+  2276, 1, 1, 1, 1, 1, 1, 1, 1, 2277, 1, 2278, 1, 2279, 2280, 1,
+  2281, 1, 2282, 1, 2283, 1, 2284, 1, 1, 1, 1, 2285, 1, 2286, 1, 1,
+  2287, 1, 2288, 1, 1, 1, 2289, 1, 2290, 1, 2291, 1, 2292, 1, 2293, 1,
+  2294, 1, 2295, 1, 2296, 1, 2297, 1, 2298, 1, 2299, 2300, 2301, 2302, 2303, 1,
+  2304, 2305, 2306, 2307, 2308, 1, 2309, 1, 2310, 1, 2311, 1, 2312, 1, 2313, 1,
+  2314, 1, 2315, 1, 2316, 2317, 2318, 2319, 1, 2320, 1, 1, 1, 1, 1, 1,
+  2321, 1, 1, 1, 1, 1, 2322, 1, 2323, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1311, 1326, 1319, 2324, 1, 1, 2325, 2326, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674,
+  674, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 673, 673, 673, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 707, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  674, 0, 674, 674, 673, 0, 0, 674, 674, 0, 0, 0, 0, 0, 674, 674,
+  0, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2327, 2328, 2329, 2330,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 2331, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332,
+  2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332,
+  2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332,
+  2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332,
+  2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332,
+  2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332, 2332,
+  2332, 2332, 2332, 2332, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347,
+  2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363,
+  2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379,
+  2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395,
+  2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411,
+  2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2352, 2424, 2425, 2426,
+  2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442,
+  2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458,
+  2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474,
+  2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490,
+  2491, 2442, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2426, 2500, 2501, 2502, 2503, 2504,
+  2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2352,
+  2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535,
+  2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2428, 2547, 2548, 2549, 2550,
+  2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566,
+  2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582,
+  2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 1, 1,
+  2597, 1, 2598, 1, 1, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 1,
+  2609, 1, 2610, 1, 1, 2611, 2612, 1, 1, 1, 2613, 2614, 2615, 2616, 2617, 2618,
+  2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634,
+  2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650,
+  2651, 2652, 2653, 2654, 2655, 2656, 2657, 2481, 2658, 2659, 2660, 2661, 2662, 2663, 2663, 2664,
+  2665, 2666, 2667, 2668, 2669, 2670, 2671, 2611, 2672, 2673, 2674, 2675, 0, 2676, 1, 1,
+  2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2625, 2685, 2686, 2687, 2597, 2688, 2689, 2690,
+  2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2634, 2700, 2635, 2701, 2702, 2703, 2704,
+  2705, 2598, 2373, 2706, 2707, 2708, 2443, 2530, 2709, 2710, 2642, 2711, 2643, 2712, 2713, 2714,
+  2600, 2715, 2716, 2717, 2718, 2719, 2601, 2720, 2721, 2722, 2723, 2724, 2725, 2657, 2726, 2727,
+  2481, 2728, 2661, 2729, 2730, 2731, 2732, 2733, 2666, 2734, 2610, 2735, 2667, 2424, 2736, 2668,
+  2737, 2670, 2738, 2739, 2740, 2741, 2742, 2672, 2606, 2743, 2673, 2744, 2674, 2745, 2340, 0,
+  0, 0, 2746, 2747, 2748, 0, 0, 0, 2749, 2750, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  2751, 2752, 2753, 2754, 2755, 2756, 2756, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2757, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  674, 674, 674, 674, 674, 674, 674, 673, 673, 673, 673, 673, 673, 673, 674, 674,
+  1283, 2758, 2759, 2760, 2760, 1305, 1306, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769,
+  2770, 2771, 2772, 2773, 2774, 1, 1, 2775, 2776, 1290, 1290, 1290, 1290, 2760, 2760, 2760,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 1305, 1306, 2784, 1302, 2785, 2786, 1282, 2787,
+  1295, 37, 32, 33, 1296, 1297, 1298, 1299, 1300, 1301, 2788, 2789, 2790, 1304, 2791, 2792,
+  2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808,
+  2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2775, 2820, 2776, 2821, 2760,
+  2822, 30, 747, 776, 748, 749, 779, 753, 377, 772, 379, 754, 393, 755, 1307, 38,
+  760, 1529, 380, 394, 761, 762, 765, 384, 395, 385, 806, 2761, 2823, 2762, 2824, 0,
+  0, 2825, 2771, 2772, 2826, 2827, 1941, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836,
+  2837, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909,
+  1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925,
+  1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 2838, 2839, 2840,
+  1669, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632,
+  1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1,
+  1, 1, 1648, 1649, 1650, 1651, 1652, 1653, 1, 1, 1654, 1655, 1656, 1657, 1658, 1659,
+  1, 1, 1660, 1661, 1662, 1663, 1664, 1665, 1, 1, 1666, 1667, 1668, 1, 1, 1,
+  2841, 2842, 2843, 31, 2844, 2845, 2846, 1, 0, 2847, 2848, 2849, 2850, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const struct ftnormtab_record ftnormtab_records[2851] = {
+  {0,0,{0,0,0,0}}, {0,1,{0,0,0,0}}, {0,1,{0,0,1,1}}, {0,1,{0,0,3,3}},
+  {0,1,{0,0,5,5}}, {0,1,{0,0,7,7}}, {0,1,{0,0,9,9}}, {0,1,{0,0,11,11}},
+  {0,1,{0,0,13,13}}, {0,1,{0,0,15,15}}, {0,1,{0,0,17,17}}, {0,1,{0,0,19,19}},
+  {0,1,{0,0,21,21}}, {0,1,{0,0,23,23}}, {0,1,{0,0,25,25}}, {0,1,{0,0,27,27}},
+  {0,1,{0,0,29,29}}, {0,1,{0,0,31,31}}, {0,1,{0,0,33,33}}, {0,1,{0,0,35,35}},
+  {0,1,{0,0,37,37}}, {0,1,{0,0,39,39}}, {0,1,{0,0,41,41}}, {0,1,{0,0,43,43}},
+  {0,1,{0,0,45,45}}, {0,1,{0,0,47,47}}, {0,1,{0,0,49,49}}, {0,1,{0,0,51,51}},
+  {0,1,{0,53,0,53}}, {0,1,{0,55,0,55}}, {0,1,{0,1,0,1}}, {0,1,{0,58,0,58}},
+  {0,1,{0,61,0,61}}, {0,1,{0,63,0,63}}, {0,1,{0,65,0,65}}, {0,1,{0,68,68,68}},
+  {0,1,{0,70,0,70}}, {0,1,{0,73,0,73}}, {0,1,{0,29,0,29}}, {0,1,{0,75,0,75}},
+  {0,1,{0,79,0,79}}, {0,1,{0,83,0,83}}, {0,1,{87,87,90,90}}, {0,1,{93,93,96,96}},
+  {0,1,{99,99,102,102}}, {0,1,{105,105,108,108}}, {0,1,{111,111,114,114}}, {0,1,{117,117,120,120}},
+  {0,1,{0,0,123,123}}, {0,1,{125,125,128,128}}, {0,1,{131,131,134,134}}, {0,1,{137,137,140,140}},
+  {0,1,{143,143,146,146}}, {0,1,{149,149,152,152}}, {0,1,{155,155,158,158}}, {0,1,{161,161,164,164}},
+  {0,1,{167,167,170,170}}, {0,1,{173,173,176,176}}, {0,1,{0,0,179,179}}, {0,1,{181,181,184,184}},
+  {0,1,{187,187,190,190}}, {0,1,{193,193,196,196}}, {0,1,{199,199,202,202}}, {0,1,{205,205,208,208}},
+  {0,1,{211,211,214,214}}, {0,1,{0,0,217,217}}, {0,1,{219,219,222,222}}, {0,1,{225,225,228,228}},
+  {0,1,{231,231,234,234}}, {0,1,{237,237,240,240}}, {0,1,{243,243,246,246}}, {0,1,{0,0,249,249}},
+  {0,1,{0,0,251,251}}, {0,1,{90,90,90,90}}, {0,1,{96,96,96,96}}, {0,1,{102,102,102,102}},
+  {0,1,{108,108,108,108}}, {0,1,{114,114,114,114}}, {0,1,{120,120,120,120}}, {0,1,{128,128,128,128}},
+  {0,1,{134,134,134,134}}, {0,1,{140,140,140,140}}, {0,1,{146,146,146,146}}, {0,1,{152,152,152,152}},
+  {0,1,{158,158,158,158}}, {0,1,{164,164,164,164}}, {0,1,{170,170,170,170}}, {0,1,{176,176,176,176}},
+  {0,1,{184,184,184,184}}, {0,1,{190,190,190,190}}, {0,1,{196,196,196,196}}, {0,1,{202,202,202,202}},
+  {0,1,{208,208,208,208}}, {0,1,{214,214,214,214}}, {0,1,{222,222,222,222}}, {0,1,{228,228,228,228}},
+  {0,1,{234,234,234,234}}, {0,1,{240,240,240,240}}, {0,1,{246,246,246,246}}, {0,1,{254,254,254,254}},
+  {0,1,{257,257,260,260}}, {0,1,{260,260,260,260}}, {0,1,{263,263,266,266}}, {0,1,{266,266,266,266}},
+  {0,1,{269,269,272,272}}, {0,1,{272,272,272,272}}, {0,1,{275,275,278,278}}, {0,1,{278,278,278,278}},
+  {0,1,{281,281,284,284}}, {0,1,{284,284,284,284}}, {0,1,{287,287,290,290}}, {0,1,{290,290,290,290}},
+  {0,1,{293,293,296,296}}, {0,1,{296,296,296,296}}, {0,1,{299,299,302,302}}, {0,1,{302,302,302,302}},
+  {0,1,{0,0,305,305}}, {0,1,{307,307,310,310}}, {0,1,{310,310,310,310}}, {0,1,{313,313,316,316}},
+  {0,1,{316,316,316,316}}, {0,1,{319,319,322,322}}, {0,1,{322,322,322,322}}, {0,1,{325,325,328,328}},
+  {0,1,{328,328,328,328}}, {0,1,{331,331,334,334}}, {0,1,{334,334,334,334}}, {0,1,{337,337,340,340}},
+  {0,1,{340,340,340,340}}, {0,1,{343,343,346,346}}, {0,1,{346,346,346,346}}, {0,1,{349,349,352,352}},
+  {0,1,{352,352,352,352}}, {0,1,{355,355,358,358}}, {0,1,{358,358,358,358}}, {0,1,{361,361,364,364}},
+  {0,1,{364,364,364,364}}, {0,1,{0,0,367,367}}, {0,1,{369,369,372,372}}, {0,1,{372,372,372,372}},
+  {0,1,{375,375,378,378}}, {0,1,{378,378,378,378}}, {0,1,{381,381,384,384}}, {0,1,{384,384,384,384}},
+  {0,1,{387,387,390,390}}, {0,1,{390,390,390,390}}, {0,1,{393,393,396,396}}, {0,1,{0,399,402,404}},
+  {0,1,{0,404,0,404}}, {0,1,{407,407,410,410}}, {0,1,{410,410,410,410}}, {0,1,{413,413,416,416}},
+  {0,1,{416,416,416,416}}, {0,1,{419,419,422,422}}, {0,1,{422,422,422,422}}, {0,1,{425,425,428,428}},
+  {0,1,{428,428,428,428}}, {0,1,{431,431,434,434}}, {0,1,{434,434,434,434}}, {0,1,{0,437,440,442}},
+  {0,1,{0,442,0,442}}, {0,1,{0,0,445,445}}, {0,1,{447,447,450,450}}, {0,1,{450,450,450,450}},
+  {0,1,{453,453,456,456}}, {0,1,{456,456,456,456}}, {0,1,{459,459,462,462}}, {0,1,{462,462,462,462}},
+  {0,1,{0,465,465,465}}, {0,1,{0,0,468,468}}, {0,1,{470,470,473,473}}, {0,1,{473,473,473,473}},
+  {0,1,{476,476,479,479}}, {0,1,{479,479,479,479}}, {0,1,{482,482,485,485}}, {0,1,{485,485,485,485}},
+  {0,1,{0,0,488,488}}, {0,1,{490,490,493,493}}, {0,1,{493,493,493,493}}, {0,1,{496,496,499,499}},
+  {0,1,{499,499,499,499}}, {0,1,{502,502,505,505}}, {0,1,{505,505,505,505}}, {0,1,{508,508,511,511}},
+  {0,1,{511,511,511,511}}, {0,1,{514,514,517,517}}, {0,1,{517,517,517,517}}, {0,1,{520,520,523,523}},
+  {0,1,{523,523,523,523}}, {0,1,{526,526,529,529}}, {0,1,{529,529,529,529}}, {0,1,{532,532,535,535}},
+  {0,1,{535,535,535,535}}, {0,1,{538,538,541,541}}, {0,1,{541,541,541,541}}, {0,1,{0,0,544,544}},
+  {0,1,{546,546,549,549}}, {0,1,{549,549,549,549}}, {0,1,{552,552,555,555}}, {0,1,{555,555,555,555}},
+  {0,1,{558,558,561,561}}, {0,1,{561,561,561,561}}, {0,1,{564,564,567,567}}, {0,1,{567,567,567,567}},
+  {0,1,{570,570,573,573}}, {0,1,{573,573,573,573}}, {0,1,{576,576,579,579}}, {0,1,{579,579,579,579}},
+  {0,1,{582,582,585,585}}, {0,1,{585,585,585,585}}, {0,1,{588,588,591,591}}, {0,1,{591,591,591,591}},
+  {0,1,{594,594,254,254}}, {0,1,{597,597,600,600}}, {0,1,{600,600,600,600}}, {0,1,{603,603,606,606}},
+  {0,1,{606,606,606,606}}, {0,1,{609,609,612,612}}, {0,1,{612,612,612,612}}, {0,1,{0,37,37,37}},
+  {0,1,{0,0,615,615}}, {0,1,{0,0,617,617}}, {0,1,{0,0,619,619}}, {0,1,{0,0,621,621}},
+  {0,1,{0,0,623,623}}, {0,1,{0,0,625,625}}, {0,1,{0,0,627,627}}, {0,1,{0,0,629,629}},
+  {0,1,{0,0,631,631}}, {0,1,{0,0,633,633}}, {0,1,{0,0,635,635}}, {0,1,{0,0,637,637}},
+  {0,1,{0,0,639,639}}, {0,1,{0,0,641,641}}, {0,1,{0,0,643,643}}, {0,1,{0,0,645,645}},
+  {0,1,{0,0,647,647}}, {0,1,{0,0,649,649}}, {0,1,{0,0,651,651}}, {0,1,{0,0,653,653}},
+  {0,1,{655,655,658,658}}, {0,1,{658,658,658,658}}, {0,1,{0,0,661,661}}, {0,1,{0,0,663,663}},
+  {0,1,{0,0,665,665}}, {0,1,{0,0,667,667}}, {0,1,{0,0,669,669}}, {0,1,{0,0,671,671}},
+  {0,1,{0,0,673,673}}, {0,1,{675,675,678,678}}, {0,1,{678,678,678,678}}, {0,1,{0,0,681,681}},
+  {0,1,{0,0,683,683}}, {0,1,{0,0,685,685}}, {0,1,{0,0,687,687}}, {0,1,{0,0,689,689}},
+  {0,1,{0,0,691,691}}, {0,1,{0,0,693,693}}, {0,1,{0,695,699,701}}, {0,1,{0,705,699,701}},
+  {0,1,{0,701,0,701}}, {0,1,{0,709,712,714}}, {0,1,{0,717,712,714}}, {0,1,{0,714,0,714}},
+  {0,1,{0,720,723,725}}, {0,1,{0,728,723,725}}, {0,1,{0,725,0,725}}, {0,1,{731,731,734,734}},
+  {0,1,{734,734,734,734}}, {0,1,{737,737,740,740}}, {0,1,{740,740,740,740}}, {0,1,{743,743,746,746}},
+  {0,1,{746,746,746,746}}, {0,1,{749,749,752,752}}, {0,1,{752,752,752,752}}, {0,1,{755,755,759,759}},
+  {0,1,{759,759,759,759}}, {0,1,{763,763,767,767}}, {0,1,{767,767,767,767}}, {0,1,{771,771,775,775}},
+  {0,1,{775,775,775,775}}, {0,1,{779,779,783,783}}, {0,1,{783,783,783,783}}, {0,1,{787,787,791,791}},
+  {0,1,{791,791,791,791}}, {0,1,{795,795,799,799}}, {0,1,{799,799,799,799}}, {0,1,{803,803,806,806}},
+  {0,1,{806,806,806,806}}, {0,1,{0,0,809,809}}, {0,1,{811,811,814,814}}, {0,1,{814,814,814,814}},
+  {0,1,{817,817,820,820}}, {0,1,{820,820,820,820}}, {0,1,{823,823,826,826}}, {0,1,{826,826,826,826}},
+  {0,1,{829,829,833,833}}, {0,1,{833,833,833,833}}, {0,1,{837,837,840,840}}, {0,1,{840,840,840,840}},
+  {0,1,{843,843,843,843}}, {0,1,{0,846,849,851}}, {0,1,{0,854,849,851}}, {0,1,{0,851,0,851}},
+  {0,1,{857,857,860,860}}, {0,1,{860,860,860,860}}, {0,1,{0,0,863,863}}, {0,1,{0,0,865,865}},
+  {0,1,{867,867,870,870}}, {0,1,{870,870,870,870}}, {0,1,{873,873,877,877}}, {0,1,{877,877,877,877}},
+  {0,1,{881,881,884,884}}, {0,1,{884,884,884,884}}, {0,1,{887,887,890,890}}, {0,1,{890,890,890,890}},
+  {0,1,{893,893,896,896}}, {0,1,{896,896,896,896}}, {0,1,{899,899,902,902}}, {0,1,{902,902,902,902}},
+  {0,1,{905,905,908,908}}, {0,1,{908,908,908,908}}, {0,1,{911,911,914,914}}, {0,1,{914,914,914,914}},
+  {0,1,{917,917,920,920}}, {0,1,{920,920,920,920}}, {0,1,{923,923,926,926}}, {0,1,{926,926,926,926}},
+  {0,1,{929,929,932,932}}, {0,1,{932,932,932,932}}, {0,1,{935,935,938,938}}, {0,1,{938,938,938,938}},
+  {0,1,{941,941,944,944}}, {0,1,{944,944,944,944}}, {0,1,{947,947,950,950}}, {0,1,{950,950,950,950}},
+  {0,1,{953,953,956,956}}, {0,1,{956,956,956,956}}, {0,1,{959,959,962,962}}, {0,1,{962,962,962,962}},
+  {0,1,{965,965,968,968}}, {0,1,{968,968,968,968}}, {0,1,{971,971,974,974}}, {0,1,{974,974,974,974}},
+  {0,1,{0,0,977,977}}, {0,1,{979,979,982,982}}, {0,1,{982,982,982,982}}, {0,1,{0,0,985,985}},
+  {0,1,{0,0,987,987}}, {0,1,{0,0,989,989}}, {0,1,{991,991,994,994}}, {0,1,{994,994,994,994}},
+  {0,1,{997,997,1000,1000}}, {0,1,{1000,1000,1000,1000}}, {0,1,{1003,1003,1007,1007}}, {0,1,{1007,1007,1007,1007}},
+  {0,1,{1011,1011,1015,1015}}, {0,1,{1015,1015,1015,1015}}, {0,1,{1019,1019,1022,1022}}, {0,1,{1022,1022,1022,1022}},
+  {0,1,{1025,1025,1029,1029}}, {0,1,{1029,1029,1029,1029}}, {0,1,{1033,1033,1036,1036}}, {0,1,{1036,1036,1036,1036}},
+  {0,1,{0,0,1039,1039}}, {0,1,{0,0,1041,1041}}, {0,1,{0,0,1043,1043}}, {0,1,{0,0,1045,1045}},
+  {0,1,{0,0,1047,1047}}, {0,1,{0,0,1049,1049}}, {0,1,{0,0,1051,1051}}, {0,1,{0,0,1053,1053}},
+  {0,1,{0,0,1055,1055}}, {0,1,{0,0,1057,1057}}, {0,1,{0,0,1059,1059}}, {0,1,{0,0,1061,1061}},
+  {0,1,{0,0,1063,1063}}, {0,1,{0,15,0,15}}, {0,1,{0,1065,0,1065}}, {0,1,{0,19,0,19}},
+  {0,1,{0,35,0,35}}, {0,1,{0,1067,0,1067}}, {0,1,{0,1069,0,1069}}, {0,1,{0,1071,0,1071}},
+  {0,1,{0,45,0,45}}, {0,1,{0,49,0,49}}, {0,1,{0,1073,0,1073}}, {0,1,{0,1076,0,1076}},
+  {0,1,{0,1079,0,1079}}, {0,1,{0,1082,0,1082}}, {0,1,{0,1085,0,1085}}, {0,1,{0,1088,0,1088}},
+  {0,1,{0,641,0,641}}, {0,1,{0,23,0,23}}, {0,1,{0,37,0,37}}, {0,1,{0,47,0,47}},
+  {0,1,{0,1091,0,1091}}, {230,11,{0,0,0,0}}, {230,9,{0,0,0,0}}, {232,9,{0,0,0,0}},
+  {220,9,{0,0,0,0}}, {216,11,{0,0,0,0}}, {202,9,{0,0,0,0}}, {220,11,{0,0,0,0}},
+  {202,11,{0,0,0,0}}, {1,9,{0,0,0,0}}, {1,11,{0,0,0,0}}, {230,9,{1093,1093,1093,1093}},
+  {230,9,{1095,1095,1095,1095}}, {230,9,{1097,1097,1097,1097}}, {230,9,{1099,1099,1099,1099}}, {240,11,{0,0,1102,1102}},
+  {0,9,{0,0,0,0}}, {233,9,{0,0,0,0}}, {234,9,{0,0,0,0}}, {0,1,{0,0,1104,1104}},
+  {0,1,{0,0,1106,1106}}, {0,1,{1108,1108,1108,1108}}, {0,1,{0,0,1110,1110}}, {0,1,{0,1112,0,1112}},
+  {0,1,{1115,1115,1115,1115}}, {0,1,{0,0,1117,1117}}, {0,1,{1119,1122,1119,1122}}, {0,1,{1126,1126,1129,1129}},
+  {0,1,{1132,1132,1132,1132}}, {0,1,{1134,1134,1137,1137}}, {0,1,{1140,1140,1143,1143}}, {0,1,{1146,1146,1149,1149}},
+  {0,1,{1152,1152,1155,1155}}, {0,1,{1158,1158,1161,1161}}, {0,1,{1164,1164,1167,1167}}, {0,1,{1170,1170,1170,1170}},
+  {0,1,{0,0,1174,1174}}, {0,1,{0,0,1176,1176}}, {0,1,{0,0,1178,1178}}, {0,1,{0,0,1180,1180}},
+  {0,1,{0,0,1182,1182}}, {0,1,{0,0,1184,1184}}, {0,1,{0,0,1186,1186}}, {0,1,{0,0,1188,1188}},
+  {0,1,{0,0,1102,1102}}, {0,1,{0,0,1190,1190}}, {0,1,{0,0,1192,1192}}, {0,1,{0,0,68,68}},
+  {0,1,{0,0,1194,1194}}, {0,1,{0,0,1196,1196}}, {0,1,{0,0,1198,1198}}, {0,1,{0,0,1200,1200}},
+  {0,1,{0,0,1202,1202}}, {0,1,{0,0,1204,1204}}, {0,1,{0,0,1206,1206}}, {0,1,{0,0,1208,1208}},
+  {0,1,{0,0,1210,1210}}, {0,1,{0,0,1212,1212}}, {0,1,{0,0,1214,1214}}, {0,1,{0,0,1216,1216}},
+  {0,1,{1218,1218,1221,1221}}, {0,1,{1224,1224,1227,1227}}, {0,1,{1129,1129,1129,1129}}, {0,1,{1137,1137,1137,1137}},
+  {0,1,{1143,1143,1143,1143}}, {0,1,{1149,1149,1149,1149}}, {0,1,{1230,1230,1230,1230}}, {0,1,{1221,1221,1221,1221}},
+  {0,1,{1227,1227,1227,1227}}, {0,1,{1155,1155,1155,1155}}, {0,1,{1161,1161,1161,1161}}, {0,1,{1167,1167,1167,1167}},
+  {0,1,{0,0,1234,1234}}, {0,1,{0,1176,1176,1176}}, {0,1,{0,1188,1188,1188}}, {0,1,{0,1236,0,1236}},
+  {0,1,{1238,1158,1238,1158}}, {0,1,{1241,1224,1241,1224}}, {0,1,{0,1210,1210,1210}}, {0,1,{0,1200,1200,1200}},
+  {0,1,{0,0,1244,1244}}, {0,1,{0,0,1246,1246}}, {0,1,{0,0,1248,1248}}, {0,1,{0,0,1250,1250}},
+  {0,1,{0,0,1252,1252}}, {0,1,{0,0,1254,1254}}, {0,1,{0,0,1256,1256}}, {0,1,{0,0,1258,1258}},
+  {0,1,{0,0,1260,1260}}, {0,1,{0,0,1262,1262}}, {0,1,{0,0,1264,1264}}, {0,1,{0,0,1266,1266}},
+  {0,1,{0,1190,1190,1190}}, {0,1,{0,1202,1202,1202}}, {0,1,{0,1268,0,1268}}, {0,1,{0,1270,1188,1188}},
+  {0,1,{0,1182,1182,1182}}, {0,1,{0,0,1272,1272}}, {0,1,{0,1274,1276,1268}}, {0,1,{0,0,1278,1278}},
+  {0,1,{0,0,1280,1280}}, {0,1,{0,0,1282,1282}}, {0,1,{0,0,1284,1284}}, {0,1,{1286,1286,1289,1289}},
+  {0,1,{1292,1292,1295,1295}}, {0,1,{0,0,1298,1298}}, {0,1,{1300,1300,1303,1303}}, {0,1,{0,0,1306,1306}},
+  {0,1,{0,0,1308,1308}}, {0,1,{0,0,1310,1310}}, {0,1,{1312,1312,1315,1315}}, {0,1,{0,0,1318,1318}},
+  {0,1,{0,0,1320,1320}}, {0,1,{0,0,1322,1322}}, {0,1,{0,0,1324,1324}}, {0,1,{1326,1326,1329,1329}},
+  {0,1,{1332,1332,1335,1335}}, {0,1,{1338,1338,1341,1341}}, {0,1,{0,0,1344,1344}}, {0,1,{0,0,1346,1346}},
+  {0,1,{0,0,1348,1348}}, {0,1,{0,0,1350,1350}}, {0,1,{0,0,1352,1352}}, {0,1,{0,0,1354,1354}},
+  {0,1,{0,0,1356,1356}}, {0,1,{0,0,1358,1358}}, {0,1,{0,0,1360,1360}}, {0,1,{0,0,1362,1362}},
+  {0,1,{1364,1364,1367,1367}}, {0,1,{0,0,1370,1370}}, {0,1,{0,0,1372,1372}}, {0,1,{0,0,1374,1374}},
+  {0,1,{0,0,1376,1376}}, {0,1,{0,0,1378,1378}}, {0,1,{0,0,1380,1380}}, {0,1,{0,0,1382,1382}},
+  {0,1,{0,0,1384,1384}}, {0,1,{0,0,1386,1386}}, {0,1,{0,0,1388,1388}}, {0,1,{0,0,1390,1390}},
+  {0,1,{0,0,1392,1392}}, {0,1,{0,0,1394,1394}}, {0,1,{0,0,1396,1396}}, {0,1,{0,0,1398,1398}},
+  {0,1,{0,0,1400,1400}}, {0,1,{0,0,1402,1402}}, {0,1,{0,0,1404,1404}}, {0,1,{0,0,1406,1406}},
+  {0,1,{0,0,1408,1408}}, {0,1,{0,0,1410,1410}}, {0,1,{0,0,1412,1412}}, {0,1,{1367,1367,1367,1367}},
+  {0,1,{1289,1289,1289,1289}}, {0,1,{1295,1295,1295,1295}}, {0,1,{1303,1303,1303,1303}}, {0,1,{1315,1315,1315,1315}},
+  {0,1,{1329,1329,1329,1329}}, {0,1,{1335,1335,1335,1335}}, {0,1,{1341,1341,1341,1341}}, {0,1,{0,0,1414,1414}},
+  {0,1,{0,0,1416,1416}}, {0,1,{0,0,1418,1418}}, {0,1,{0,0,1420,1420}}, {0,1,{0,0,1422,1422}},
+  {0,1,{0,0,1424,1424}}, {0,1,{0,0,1426,1426}}, {0,1,{0,0,1428,1428}}, {0,1,{0,0,1430,1430}},
+  {0,1,{0,0,1432,1432}}, {0,1,{0,0,1434,1434}}, {0,1,{1436,1436,1439,1439}}, {0,1,{1439,1439,1439,1439}},
+  {0,1,{0,0,1442,1442}}, {0,1,{0,0,1444,1444}}, {0,1,{0,0,1446,1446}}, {0,1,{0,0,1448,1448}},
+  {0,1,{0,0,1450,1450}}, {0,1,{0,0,1452,1452}}, {0,1,{0,0,1454,1454}}, {0,1,{0,0,1456,1456}},
+  {0,1,{0,0,1458,1458}}, {0,1,{0,0,1460,1460}}, {0,1,{0,0,1462,1462}}, {0,1,{0,0,1464,1464}},
+  {0,1,{0,0,1466,1466}}, {0,1,{0,0,1468,1468}}, {0,1,{0,0,1470,1470}}, {0,1,{0,0,1472,1472}},
+  {0,1,{0,0,1474,1474}}, {0,1,{0,0,1476,1476}}, {0,1,{0,0,1478,1478}}, {0,1,{0,0,1480,1480}},
+  {0,1,{0,0,1482,1482}}, {0,1,{0,0,1484,1484}}, {0,1,{0,0,1486,1486}}, {0,1,{0,0,1488,1488}},
+  {0,1,{0,0,1490,1490}}, {0,1,{0,0,1492,1492}}, {0,1,{0,0,1494,1494}}, {0,1,{0,0,1496,1496}},
+  {0,1,{0,0,1498,1498}}, {0,1,{0,0,1500,1500}}, {0,1,{0,0,1502,1502}}, {0,1,{0,0,1504,1504}},
+  {0,1,{0,0,1506,1506}}, {0,1,{1508,1508,1511,1511}}, {0,1,{1511,1511,1511,1511}}, {0,1,{0,0,1514,1514}},
+  {0,1,{0,0,1516,1516}}, {0,1,{0,0,1518,1518}}, {0,1,{0,0,1520,1520}}, {0,1,{0,0,1522,1522}},
+  {0,1,{0,0,1524,1524}}, {0,1,{1526,1526,1529,1529}}, {0,1,{1529,1529,1529,1529}}, {0,1,{1532,1532,1535,1535}},
+  {0,1,{1535,1535,1535,1535}}, {0,1,{0,0,1538,1538}}, {0,1,{1540,1540,1543,1543}}, {0,1,{1543,1543,1543,1543}},
+  {0,1,{0,0,1546,1546}}, {0,1,{1548,1548,1551,1551}}, {0,1,{1551,1551,1551,1551}}, {0,1,{1554,1554,1557,1557}},
+  {0,1,{1557,1557,1557,1557}}, {0,1,{1560,1560,1563,1563}}, {0,1,{1563,1563,1563,1563}}, {0,1,{0,0,1566,1566}},
+  {0,1,{1568,1568,1571,1571}}, {0,1,{1571,1571,1571,1571}}, {0,1,{1574,1574,1577,1577}}, {0,1,{1577,1577,1577,1577}},
+  {0,1,{1580,1580,1583,1583}}, {0,1,{1583,1583,1583,1583}}, {0,1,{0,0,1586,1586}}, {0,1,{1588,1588,1591,1591}},
+  {0,1,{1591,1591,1591,1591}}, {0,1,{1594,1594,1597,1597}}, {0,1,{1597,1597,1597,1597}}, {0,1,{1600,1600,1603,1603}},
+  {0,1,{1603,1603,1603,1603}}, {0,1,{1606,1606,1609,1609}}, {0,1,{1609,1609,1609,1609}}, {0,1,{1612,1612,1615,1615}},
+  {0,1,{1615,1615,1615,1615}}, {0,1,{1618,1618,1621,1621}}, {0,1,{1621,1621,1621,1621}}, {0,1,{0,0,1624,1624}},
+  {0,1,{1626,1626,1629,1629}}, {0,1,{1629,1629,1629,1629}}, {0,1,{0,0,1632,1632}}, {0,1,{0,0,1634,1634}},
+  {0,1,{0,0,1636,1636}}, {0,1,{0,0,1638,1638}}, {0,1,{0,0,1640,1640}}, {0,1,{0,0,1642,1642}},
+  {0,1,{0,0,1644,1644}}, {0,1,{0,0,1646,1646}}, {0,1,{0,0,1648,1648}}, {0,1,{0,0,1650,1650}},
+  {0,1,{0,0,1652,1652}}, {0,1,{0,0,1654,1654}}, {0,1,{0,0,1656,1656}}, {0,1,{0,0,1658,1658}},
+  {0,1,{0,0,1660,1660}}, {0,1,{0,0,1662,1662}}, {0,1,{0,0,1664,1664}}, {0,1,{0,0,1666,1666}},
+  {0,1,{0,0,1668,1668}}, {0,1,{0,0,1670,1670}}, {0,1,{0,0,1672,1672}}, {0,1,{0,0,1674,1674}},
+  {0,1,{0,0,1676,1676}}, {0,1,{0,0,1678,1678}}, {0,1,{0,0,1680,1680}}, {0,1,{0,0,1682,1682}},
+  {0,1,{0,0,1684,1684}}, {220,0,{0,0,0,0}}, {230,0,{0,0,0,0}}, {222,0,{0,0,0,0}},
+  {228,0,{0,0,0,0}}, {10,0,{0,0,0,0}}, {11,0,{0,0,0,0}}, {12,0,{0,0,0,0}},
+  {13,0,{0,0,0,0}}, {14,0,{0,0,0,0}}, {15,0,{0,0,0,0}}, {16,0,{0,0,0,0}},
+  {17,0,{0,0,0,0}}, {18,0,{0,0,0,0}}, {19,0,{0,0,0,0}}, {20,0,{0,0,0,0}},
+  {21,0,{0,0,0,0}}, {22,0,{0,0,0,0}}, {23,0,{0,0,0,0}}, {24,0,{0,0,0,0}},
+  {25,0,{0,0,0,0}}, {30,0,{0,0,0,0}}, {31,0,{0,0,0,0}}, {32,0,{0,0,0,0}},
+  {27,0,{0,0,0,0}}, {28,0,{0,0,0,0}}, {29,0,{0,0,0,0}}, {33,0,{0,0,0,0}},
+  {34,0,{0,0,0,0}}, {230,2,{0,0,0,0}}, {220,2,{0,0,0,0}}, {35,0,{0,0,0,0}},
+  {36,0,{0,0,0,0}}, {7,2,{0,0,0,0}}, {9,0,{0,0,0,0}}, {7,0,{0,0,0,0}},
+  {0,2,{0,0,0,0}}, {84,0,{0,0,0,0}}, {91,2,{0,0,0,0}}, {9,2,{0,0,0,0}},
+  {103,0,{0,0,0,0}}, {107,0,{0,0,0,0}}, {118,0,{0,0,0,0}}, {122,0,{0,0,0,0}},
+  {216,0,{0,0,0,0}}, {129,0,{0,0,0,0}}, {130,0,{0,0,0,0}}, {132,0,{0,0,0,0}},
+  {0,3,{0,0,0,0}}, {0,1,{0,0,1686,1686}}, {1,0,{0,0,0,0}}, {0,1,{0,1688,0,1688}},
+  {0,1,{0,1690,0,1690}}, {0,1,{0,1692,0,1692}}, {0,1,{0,1694,0,1694}}, {0,1,{0,1696,0,1696}},
+  {0,1,{0,1698,0,1698}}, {0,1,{0,1700,0,1700}}, {0,1,{0,1702,0,1702}}, {0,1,{0,1704,0,1704}},
+  {0,1,{0,1706,0,1706}}, {0,1,{0,1708,0,1708}}, {0,1,{0,1710,0,1710}}, {0,1,{0,1712,0,1712}},
+  {0,1,{0,1714,0,1714}}, {0,1,{0,1716,0,1716}}, {0,1,{0,1718,0,1718}}, {0,1,{0,1720,0,1720}},
+  {0,1,{0,1722,0,1722}}, {0,1,{0,1724,0,1724}}, {0,1,{0,1726,0,1726}}, {0,1,{0,1728,0,1728}},
+  {0,1,{0,1730,0,1730}}, {0,1,{0,1732,0,1732}}, {0,1,{0,1734,0,1734}}, {0,1,{0,3,0,3}},
+  {0,1,{0,7,0,7}}, {0,1,{0,9,0,9}}, {0,1,{0,633,0,633}}, {0,1,{0,635,0,635}},
+  {0,1,{0,1736,0,1736}}, {0,1,{0,13,0,13}}, {0,1,{0,21,0,21}}, {0,1,{0,25,0,25}},
+  {0,1,{0,468,0,468}}, {0,1,{0,621,0,621}}, {0,1,{0,1738,0,1738}}, {0,1,{0,1740,0,1740}},
+  {0,1,{0,31,0,31}}, {0,1,{0,39,0,39}}, {0,1,{0,41,0,41}}, {0,1,{0,1742,0,1742}},
+  {0,1,{0,649,0,649}}, {0,1,{0,43,0,43}}, {0,1,{0,1744,0,1744}}, {0,1,{0,1176,0,1176}},
+  {0,1,{0,1178,0,1178}}, {0,1,{0,1180,0,1180}}, {0,1,{0,1210,0,1210}}, {0,1,{0,1212,0,1212}},
+  {0,1,{0,17,0,17}}, {0,1,{0,1202,0,1202}}, {0,1,{0,1376,0,1376}}, {0,1,{0,1746,0,1746}},
+  {0,1,{0,5,0,5}}, {0,1,{0,1748,0,1748}}, {0,1,{0,179,0,179}}, {0,1,{0,11,0,11}},
+  {0,1,{0,1750,0,1750}}, {0,1,{0,1752,0,1752}}, {0,1,{0,1754,0,1754}}, {0,1,{0,645,0,645}},
+  {0,1,{0,643,0,643}}, {0,1,{0,1756,0,1756}}, {0,1,{0,1758,0,1758}}, {0,1,{0,1760,0,1760}},
+  {0,1,{0,1762,0,1762}}, {0,1,{0,1764,0,1764}}, {0,1,{0,1766,0,1766}}, {0,1,{0,1768,0,1768}},
+  {0,1,{0,1770,0,1770}}, {0,1,{0,651,0,651}}, {0,1,{0,1772,0,1772}}, {0,1,{0,1774,0,1774}},
+  {0,1,{0,653,0,653}}, {0,1,{0,1776,0,1776}}, {0,1,{0,1778,0,1778}}, {0,1,{0,669,0,669}},
+  {0,1,{0,1780,0,1780}}, {0,1,{0,1051,0,1051}}, {0,1,{0,681,0,681}}, {0,1,{0,1782,0,1782}},
+  {0,1,{0,683,0,683}}, {0,1,{0,1053,0,1053}}, {0,1,{0,51,0,51}}, {0,1,{0,1784,0,1784}},
+  {0,1,{0,1786,0,1786}}, {0,1,{0,689,0,689}}, {0,1,{0,1188,0,1188}}, {214,9,{0,0,0,0}},
+  {228,9,{0,0,0,0}}, {218,9,{0,0,0,0}}, {0,1,{1788,1788,1791,1791}}, {0,1,{1791,1791,1791,1791}},
+  {0,1,{1794,1794,1797,1797}}, {0,1,{1797,1797,1797,1797}}, {0,1,{1800,1800,1803,1803}}, {0,1,{1803,1803,1803,1803}},
+  {0,1,{1806,1806,1809,1809}}, {0,1,{1809,1809,1809,1809}}, {0,1,{1812,1812,1816,1816}}, {0,1,{1816,1816,1816,1816}},
+  {0,1,{1820,1820,1823,1823}}, {0,1,{1823,1823,1823,1823}}, {0,1,{1826,1826,1829,1829}}, {0,1,{1829,1829,1829,1829}},
+  {0,1,{1832,1832,1835,1835}}, {0,1,{1835,1835,1835,1835}}, {0,1,{1838,1838,1841,1841}}, {0,1,{1841,1841,1841,1841}},
+  {0,1,{1844,1844,1847,1847}}, {0,1,{1847,1847,1847,1847}}, {0,1,{1850,1850,1854,1854}}, {0,1,{1854,1854,1854,1854}},
+  {0,1,{1858,1858,1862,1862}}, {0,1,{1862,1862,1862,1862}}, {0,1,{1866,1866,1869,1869}}, {0,1,{1869,1869,1869,1869}},
+  {0,1,{1872,1872,1875,1875}}, {0,1,{1875,1875,1875,1875}}, {0,1,{1878,1878,1882,1882}}, {0,1,{1882,1882,1882,1882}},
+  {0,1,{1886,1886,1889,1889}}, {0,1,{1889,1889,1889,1889}}, {0,1,{1892,1892,1895,1895}}, {0,1,{1895,1895,1895,1895}},
+  {0,1,{1898,1898,1901,1901}}, {0,1,{1901,1901,1901,1901}}, {0,1,{1904,1904,1907,1907}}, {0,1,{1907,1907,1907,1907}},
+  {0,1,{1910,1910,1913,1913}}, {0,1,{1913,1913,1913,1913}}, {0,1,{1916,1916,1919,1919}}, {0,1,{1919,1919,1919,1919}},
+  {0,1,{1922,1922,1925,1925}}, {0,1,{1925,1925,1925,1925}}, {0,1,{1928,1928,1931,1931}}, {0,1,{1931,1931,1931,1931}},
+  {0,1,{1934,1934,1938,1938}}, {0,1,{1938,1938,1938,1938}}, {0,1,{1942,1942,1945,1945}}, {0,1,{1945,1945,1945,1945}},
+  {0,1,{1948,1948,1951,1951}}, {0,1,{1951,1951,1951,1951}}, {0,1,{1954,1954,1957,1957}}, {0,1,{1957,1957,1957,1957}},
+  {0,1,{1960,1960,1963,1963}}, {0,1,{1963,1963,1963,1963}}, {0,1,{1966,1966,1970,1970}}, {0,1,{1970,1970,1970,1970}},
+  {0,1,{1974,1974,1977,1977}}, {0,1,{1977,1977,1977,1977}}, {0,1,{1980,1980,1983,1983}}, {0,1,{1983,1983,1983,1983}},
+  {0,1,{1986,1986,1989,1989}}, {0,1,{1989,1989,1989,1989}}, {0,1,{1992,1992,1995,1995}}, {0,1,{1995,1995,1995,1995}},
+  {0,1,{1998,1998,2001,2001}}, {0,1,{2001,2001,2001,2001}}, {0,1,{2004,2004,2007,2007}}, {0,1,{2007,2007,2007,2007}},
+  {0,1,{2010,2010,2013,2013}}, {0,1,{2013,2013,2013,2013}}, {0,1,{2016,2016,2019,2019}}, {0,1,{2019,2019,2019,2019}},
+  {0,1,{2022,2022,2025,2025}}, {0,1,{2025,2025,2025,2025}}, {0,1,{2028,2028,2032,2032}}, {0,1,{2032,2032,2032,2032}},
+  {0,1,{2036,2036,2040,2040}}, {0,1,{2040,2040,2040,2040}}, {0,1,{2044,2044,2048,2048}}, {0,1,{2048,2048,2048,2048}},
+  {0,1,{2052,2052,2056,2056}}, {0,1,{2056,2056,2056,2056}}, {0,1,{2060,2060,2063,2063}}, {0,1,{2063,2063,2063,2063}},
+  {0,1,{2066,2066,2069,2069}}, {0,1,{2069,2069,2069,2069}}, {0,1,{2072,2072,2075,2075}}, {0,1,{2075,2075,2075,2075}},
+  {0,1,{2078,2078,2081,2081}}, {0,1,{2081,2081,2081,2081}}, {0,1,{2084,2084,2088,2088}}, {0,1,{2088,2088,2088,2088}},
+  {0,1,{2092,2092,2095,2095}}, {0,1,{2095,2095,2095,2095}}, {0,1,{2098,2098,2101,2101}}, {0,1,{2101,2101,2101,2101}},
+  {0,1,{2104,2104,2107,2107}}, {0,1,{2107,2107,2107,2107}}, {0,1,{2110,2110,2114,2114}}, {0,1,{2114,2114,2114,2114}},
+  {0,1,{2118,2118,2122,2122}}, {0,1,{2122,2122,2122,2122}}, {0,1,{2126,2126,2130,2130}}, {0,1,{2130,2130,2130,2130}},
+  {0,1,{2134,2134,2137,2137}}, {0,1,{2137,2137,2137,2137}}, {0,1,{2140,2140,2143,2143}}, {0,1,{2143,2143,2143,2143}},
+  {0,1,{2146,2146,2149,2149}}, {0,1,{2149,2149,2149,2149}}, {0,1,{2152,2152,2155,2155}}, {0,1,{2155,2155,2155,2155}},
+  {0,1,{2158,2158,2161,2161}}, {0,1,{2161,2161,2161,2161}}, {0,1,{2164,2164,2167,2167}}, {0,1,{2167,2167,2167,2167}},
+  {0,1,{2170,2170,2173,2173}}, {0,1,{2173,2173,2173,2173}}, {0,1,{2176,2176,2180,2180}}, {0,1,{2180,2180,2180,2180}},
+  {0,1,{2184,2184,2188,2188}}, {0,1,{2188,2188,2188,2188}}, {0,1,{2192,2192,2195,2195}}, {0,1,{2195,2195,2195,2195}},
+  {0,1,{2198,2198,2201,2201}}, {0,1,{2201,2201,2201,2201}}, {0,1,{2204,2204,2207,2207}}, {0,1,{2207,2207,2207,2207}},
+  {0,1,{2210,2210,2213,2213}}, {0,1,{2213,2213,2213,2213}}, {0,1,{2216,2216,2219,2219}}, {0,1,{2219,2219,2219,2219}},
+  {0,1,{2222,2222,2225,2225}}, {0,1,{2225,2225,2225,2225}}, {0,1,{2228,2228,2231,2231}}, {0,1,{2231,2231,2231,2231}},
+  {0,1,{2234,2234,2237,2237}}, {0,1,{2237,2237,2237,2237}}, {0,1,{2240,2240,2243,2243}}, {0,1,{2243,2243,2243,2243}},
+  {0,1,{2246,2246,2249,2249}}, {0,1,{2249,2249,2249,2249}}, {0,1,{2252,2252,2255,2255}}, {0,1,{2255,2255,2255,2255}},
+  {0,1,{2258,2258,2261,2261}}, {0,1,{2261,2261,2261,2261}}, {0,1,{2264,2264,2267,2267}}, {0,1,{2267,2267,2267,2267}},
+  {0,1,{2270,2270,2270,2270}}, {0,1,{2273,2273,2273,2273}}, {0,1,{2276,2276,2276,2276}}, {0,1,{2279,2279,2279,2279}},
+  {0,1,{0,2282,2282,2282}}, {0,1,{2285,2101,2101,2101}}, {0,1,{2288,2288,2291,2291}}, {0,1,{2291,2291,2291,2291}},
+  {0,1,{2294,2294,2297,2297}}, {0,1,{2297,2297,2297,2297}}, {0,1,{2300,2300,2304,2304}}, {0,1,{2304,2304,2304,2304}},
+  {0,1,{2308,2308,2312,2312}}, {0,1,{2312,2312,2312,2312}}, {0,1,{2316,2316,2320,2320}}, {0,1,{2320,2320,2320,2320}},
+  {0,1,{2324,2324,2328,2328}}, {0,1,{2328,2328,2328,2328}}, {0,1,{2332,2332,2336,2336}}, {0,1,{2336,2336,2336,2336}},
+  {0,1,{2340,2340,2344,2344}}, {0,1,{2344,2344,2344,2344}}, {0,1,{2348,2348,2352,2352}}, {0,1,{2352,2352,2352,2352}},
+  {0,1,{2356,2356,2360,2360}}, {0,1,{2360,2360,2360,2360}}, {0,1,{2364,2364,2368,2368}}, {0,1,{2368,2368,2368,2368}},
+  {0,1,{2372,2372,2376,2376}}, {0,1,{2376,2376,2376,2376}}, {0,1,{2380,2380,2383,2383}}, {0,1,{2383,2383,2383,2383}},
+  {0,1,{2386,2386,2389,2389}}, {0,1,{2389,2389,2389,2389}}, {0,1,{2392,2392,2395,2395}}, {0,1,{2395,2395,2395,2395}},
+  {0,1,{2398,2398,2402,2402}}, {0,1,{2402,2402,2402,2402}}, {0,1,{2406,2406,2410,2410}}, {0,1,{2410,2410,2410,2410}},
+  {0,1,{2414,2414,2418,2418}}, {0,1,{2418,2418,2418,2418}}, {0,1,{2422,2422,2426,2426}}, {0,1,{2426,2426,2426,2426}},
+  {0,1,{2430,2430,2434,2434}}, {0,1,{2434,2434,2434,2434}}, {0,1,{2438,2438,2441,2441}}, {0,1,{2441,2441,2441,2441}},
+  {0,1,{2444,2444,2447,2447}}, {0,1,{2447,2447,2447,2447}}, {0,1,{2450,2450,2453,2453}}, {0,1,{2453,2453,2453,2453}},
+  {0,1,{2456,2456,2459,2459}}, {0,1,{2459,2459,2459,2459}}, {0,1,{2462,2462,2466,2466}}, {0,1,{2466,2466,2466,2466}},
+  {0,1,{2470,2470,2474,2474}}, {0,1,{2474,2474,2474,2474}}, {0,1,{2478,2478,2482,2482}}, {0,1,{2482,2482,2482,2482}},
+  {0,1,{2486,2486,2490,2490}}, {0,1,{2490,2490,2490,2490}}, {0,1,{2494,2494,2498,2498}}, {0,1,{2498,2498,2498,2498}},
+  {0,1,{2502,2502,2506,2506}}, {0,1,{2506,2506,2506,2506}}, {0,1,{2510,2510,2514,2514}}, {0,1,{2514,2514,2514,2514}},
+  {0,1,{2518,2518,2522,2522}}, {0,1,{2522,2522,2522,2522}}, {0,1,{2526,2526,2530,2530}}, {0,1,{2530,2530,2530,2530}},
+  {0,1,{2534,2534,2538,2538}}, {0,1,{2538,2538,2538,2538}}, {0,1,{2542,2542,2545,2545}}, {0,1,{2545,2545,2545,2545}},
+  {0,1,{2548,2548,2551,2551}}, {0,1,{2551,2551,2551,2551}}, {0,1,{2554,2554,2558,2558}}, {0,1,{2558,2558,2558,2558}},
+  {0,1,{2562,2562,2566,2566}}, {0,1,{2566,2566,2566,2566}}, {0,1,{2570,2570,2574,2574}}, {0,1,{2574,2574,2574,2574}},
+  {0,1,{2578,2578,2582,2582}}, {0,1,{2582,2582,2582,2582}}, {0,1,{2586,2586,2590,2590}}, {0,1,{2590,2590,2590,2590}},
+  {0,1,{2594,2594,2597,2597}}, {0,1,{2597,2597,2597,2597}}, {0,1,{2600,2600,2603,2603}}, {0,1,{2603,2603,2603,2603}},
+  {0,1,{2606,2606,2609,2609}}, {0,1,{2609,2609,2609,2609}}, {0,1,{2612,2612,2615,2615}}, {0,1,{2615,2615,2615,2615}},
+  {0,1,{0,0,2618,2618}}, {0,1,{0,0,2620,2620}}, {0,1,{0,0,2622,2622}}, {0,1,{2624,2624,2624,2624}},
+  {0,1,{2627,2627,2627,2627}}, {0,1,{2630,2630,2630,2630}}, {0,1,{2634,2634,2634,2634}}, {0,1,{2638,2638,2638,2638}},
+  {0,1,{2642,2642,2642,2642}}, {0,1,{2646,2646,2646,2646}}, {0,1,{2650,2650,2650,2650}}, {0,1,{2654,2654,2624,2624}},
+  {0,1,{2657,2657,2627,2627}}, {0,1,{2660,2660,2630,2630}}, {0,1,{2664,2664,2634,2634}}, {0,1,{2668,2668,2638,2638}},
+  {0,1,{2672,2672,2642,2642}}, {0,1,{2676,2676,2646,2646}}, {0,1,{2680,2680,2650,2650}}, {0,1,{2684,2684,2684,2684}},
+  {0,1,{2687,2687,2687,2687}}, {0,1,{2690,2690,2690,2690}}, {0,1,{2694,2694,2694,2694}}, {0,1,{2698,2698,2698,2698}},
+  {0,1,{2702,2702,2702,2702}}, {0,1,{2706,2706,2684,2684}}, {0,1,{2709,2709,2687,2687}}, {0,1,{2712,2712,2690,2690}},
+  {0,1,{2716,2716,2694,2694}}, {0,1,{2720,2720,2698,2698}}, {0,1,{2724,2724,2702,2702}}, {0,1,{2728,2728,2728,2728}},
+  {0,1,{2731,2731,2731,2731}}, {0,1,{2734,2734,2734,2734}}, {0,1,{2738,2738,2738,2738}}, {0,1,{2742,2742,2742,2742}},
+  {0,1,{2746,2746,2746,2746}}, {0,1,{2750,2750,2750,2750}}, {0,1,{2754,2754,2754,2754}}, {0,1,{2758,2758,2728,2728}},
+  {0,1,{2761,2761,2731,2731}}, {0,1,{2764,2764,2734,2734}}, {0,1,{2768,2768,2738,2738}}, {0,1,{2772,2772,2742,2742}},
+  {0,1,{2776,2776,2746,2746}}, {0,1,{2780,2780,2750,2750}}, {0,1,{2784,2784,2754,2754}}, {0,1,{2788,2788,2788,2788}},
+  {0,1,{2791,2791,2791,2791}}, {0,1,{2794,2794,2794,2794}}, {0,1,{2798,2798,2798,2798}}, {0,1,{2802,2802,2802,2802}},
+  {0,1,{2806,2806,2806,2806}}, {0,1,{2810,2810,2810,2810}}, {0,1,{2814,2814,2814,2814}}, {0,1,{2818,2818,2788,2788}},
+  {0,1,{2821,2821,2791,2791}}, {0,1,{2824,2824,2794,2794}}, {0,1,{2828,2828,2798,2798}}, {0,1,{2832,2832,2802,2802}},
+  {0,1,{2836,2836,2806,2806}}, {0,1,{2840,2840,2810,2810}}, {0,1,{2844,2844,2814,2814}}, {0,1,{2848,2848,2848,2848}},
+  {0,1,{2851,2851,2851,2851}}, {0,1,{2854,2854,2854,2854}}, {0,1,{2858,2858,2858,2858}}, {0,1,{2862,2862,2862,2862}},
+  {0,1,{2866,2866,2866,2866}}, {0,1,{2870,2870,2848,2848}}, {0,1,{2873,2873,2851,2851}}, {0,1,{2876,2876,2854,2854}},
+  {0,1,{2880,2880,2858,2858}}, {0,1,{2884,2884,2862,2862}}, {0,1,{2888,2888,2866,2866}}, {0,1,{2892,2892,2892,2892}},
+  {0,1,{2895,2895,2895,2895}}, {0,1,{2898,2898,2898,2898}}, {0,1,{2902,2902,2902,2902}}, {0,1,{2906,2906,2906,2906}},
+  {0,1,{2910,2910,2910,2910}}, {0,1,{2914,2914,2914,2914}}, {0,1,{2918,2918,2918,2918}}, {0,1,{2922,2922,2895,2895}},
+  {0,1,{2925,2925,2902,2902}}, {0,1,{2929,2929,2910,2910}}, {0,1,{2933,2933,2918,2918}}, {0,1,{2937,2937,2937,2937}},
+  {0,1,{2940,2940,2940,2940}}, {0,1,{2943,2943,2943,2943}}, {0,1,{2947,2947,2947,2947}}, {0,1,{2951,2951,2951,2951}},
+  {0,1,{2955,2955,2955,2955}}, {0,1,{2959,2959,2959,2959}}, {0,1,{2963,2963,2963,2963}}, {0,1,{2967,2967,2937,2937}},
+  {0,1,{2970,2970,2940,2940}}, {0,1,{2973,2973,2943,2943}}, {0,1,{2977,2977,2947,2947}}, {0,1,{2981,2981,2951,2951}},
+  {0,1,{2985,2985,2955,2955}}, {0,1,{2989,2989,2959,2959}}, {0,1,{2993,2993,2963,2963}}, {0,1,{2997,2997,2997,2997}},
+  {0,1,{3000,3000,3000,3000}}, {0,1,{3003,3003,3003,3003}}, {0,1,{3006,3006,3006,3006}}, {0,1,{3009,3009,3009,3009}},
+  {0,1,{3012,3012,3012,3012}}, {0,1,{3015,3015,3015,3015}}, {0,1,{3018,3018,3022,3022}}, {0,1,{3026,3026,3030,3030}},
+  {0,1,{3034,3034,3039,3039}}, {0,1,{3044,3044,3049,3049}}, {0,1,{3054,3054,3059,3059}}, {0,1,{3064,3064,3069,3069}},
+  {0,1,{3074,3074,3079,3079}}, {0,1,{3084,3084,3089,3089}}, {0,1,{3094,3094,3022,3022}}, {0,1,{3098,3098,3030,3030}},
+  {0,1,{3102,3102,3039,3039}}, {0,1,{3107,3107,3049,3049}}, {0,1,{3112,3112,3059,3059}}, {0,1,{3117,3117,3069,3069}},
+  {0,1,{3122,3122,3079,3079}}, {0,1,{3127,3127,3089,3089}}, {0,1,{3132,3132,3136,3136}}, {0,1,{3140,3140,3144,3144}},
+  {0,1,{3148,3148,3153,3153}}, {0,1,{3158,3158,3163,3163}}, {0,1,{3168,3168,3173,3173}}, {0,1,{3178,3178,3183,3183}},
+  {0,1,{3188,3188,3193,3193}}, {0,1,{3198,3198,3203,3203}}, {0,1,{3208,3208,3136,3136}}, {0,1,{3212,3212,3144,3144}},
+  {0,1,{3216,3216,3153,3153}}, {0,1,{3221,3221,3163,3163}}, {0,1,{3226,3226,3173,3173}}, {0,1,{3231,3231,3183,3183}},
+  {0,1,{3236,3236,3193,3193}}, {0,1,{3241,3241,3203,3203}}, {0,1,{3246,3246,3250,3250}}, {0,1,{3254,3254,3258,3258}},
+  {0,1,{3262,3262,3267,3267}}, {0,1,{3272,3272,3277,3277}}, {0,1,{3282,3282,3287,3287}}, {0,1,{3292,3292,3297,3297}},
+  {0,1,{3302,3302,3307,3307}}, {0,1,{3312,3312,3317,3317}}, {0,1,{3322,3322,3250,3250}}, {0,1,{3326,3326,3258,3258}},
+  {0,1,{3330,3330,3267,3267}}, {0,1,{3335,3335,3277,3277}}, {0,1,{3340,3340,3287,3287}}, {0,1,{3345,3345,3297,3297}},
+  {0,1,{3350,3350,3307,3307}}, {0,1,{3355,3355,3317,3317}}, {0,1,{3360,3360,3360,3360}}, {0,1,{3363,3363,3363,3363}},
+  {0,1,{3366,3366,3370,3370}}, {0,1,{3374,3374,3377,3377}}, {0,1,{3380,3380,3384,3384}}, {0,1,{3388,3388,3388,3388}},
+  {0,1,{3391,3391,3395,3395}}, {0,1,{3399,3399,3360,3360}}, {0,1,{3402,3402,3363,3363}}, {0,1,{3405,3405,2997,2997}},
+  {0,1,{3408,3408,3377,3377}}, {0,1,{0,3411,0,3411}}, {0,1,{1102,1102,1102,1102}}, {0,1,{0,3414,0,3414}},
+  {0,1,{3417,3420,3417,3420}}, {0,1,{3424,3424,3428,3428}}, {0,1,{3432,3432,3435,3435}}, {0,1,{3438,3438,3442,3442}},
+  {0,1,{3446,3446,3446,3446}}, {0,1,{3449,3449,3453,3453}}, {0,1,{3457,3457,3000,3000}}, {0,1,{3460,3460,3003,3003}},
+  {0,1,{3463,3463,3435,3435}}, {0,1,{3466,3469,3466,3469}}, {0,1,{3473,3476,3473,3476}}, {0,1,{3480,3483,3480,3483}},
+  {0,1,{3487,3487,3487,3487}}, {0,1,{3490,3490,3490,3490}}, {0,1,{3493,3493,3493,3493}}, {0,1,{3497,3497,3497,3497}},
+  {0,1,{3500,3500,3500,3500}}, {0,1,{3504,3504,3487,3487}}, {0,1,{3507,3507,3490,3490}}, {0,1,{3510,3510,3006,3006}},
+  {0,1,{3513,3516,3513,3516}}, {0,1,{3520,3523,3520,3523}}, {0,1,{3527,3530,3527,3530}}, {0,1,{3534,3534,3534,3534}},
+  {0,1,{3537,3537,3537,3537}}, {0,1,{3540,3540,3540,3540}}, {0,1,{3544,3544,3544,3544}}, {0,1,{3547,3547,3547,3547}},
+  {0,1,{3550,3550,3550,3550}}, {0,1,{3553,3553,3553,3553}}, {0,1,{3557,3557,3534,3534}}, {0,1,{3560,3560,3537,3537}},
+  {0,1,{3563,3563,3012,3012}}, {0,1,{3566,3566,3547,3547}}, {0,1,{3569,3572,3569,3572}}, {0,1,{3576,3576,3576,3576}},
+  {0,1,{3578,3578,3582,3582}}, {0,1,{3586,3586,3589,3589}}, {0,1,{3592,3592,3596,3596}}, {0,1,{3600,3600,3600,3600}},
+  {0,1,{3603,3603,3607,3607}}, {0,1,{3611,3611,3009,3009}}, {0,1,{3614,3614,3015,3015}}, {0,1,{3617,3617,3589,3589}},
+  {0,1,{3620,65,3620,65}}, {0,1,{0,3622,0,3622}}, {0,1,{3625,53,3625,53}}, {0,1,{3627,53,3627,53}},
+  {0,1,{0,3629,0,3629}}, {0,1,{0,3631,0,3631}}, {0,1,{0,3634,0,3634}}, {0,1,{0,3636,0,3636}},
+  {0,1,{0,3639,0,3639}}, {0,1,{0,3643,0,3643}}, {0,1,{0,3646,0,3646}}, {0,1,{0,3650,0,3650}},
+  {0,1,{0,3653,0,3653}}, {0,1,{0,3657,0,3657}}, {0,1,{0,3660,0,3660}}, {0,1,{0,3663,0,3663}},
+  {0,1,{0,3666,0,3666}}, {0,1,{0,3669,0,3669}}, {0,1,{0,3672,0,3672}}, {0,1,{0,3677,0,3677}},
+  {0,1,{0,3679,0,3679}}, {0,1,{0,3681,0,3681}}, {0,1,{0,3683,0,3683}}, {0,1,{0,3685,0,3685}},
+  {0,1,{0,3687,0,3687}}, {0,1,{0,3689,0,3689}}, {0,1,{0,3691,0,3691}}, {0,1,{0,3693,0,3693}},
+  {0,1,{0,3695,0,3695}}, {0,1,{0,3697,0,3697}}, {0,1,{0,3699,0,3699}}, {0,1,{0,27,0,27}},
+  {0,1,{0,3701,0,3701}}, {0,1,{0,3704,0,3704}}, {0,1,{0,3708,0,3708}}, {0,1,{0,3712,0,3712}},
+  {0,1,{0,3714,0,3714}}, {0,1,{0,3717,0,3717}}, {0,1,{0,3721,0,3721}}, {0,1,{0,3725,0,3725}},
+  {0,1,{0,3727,0,3727}}, {0,1,{0,367,0,367}}, {0,1,{0,3730,0,3730}}, {0,1,{0,3733,0,3733}},
+  {0,1,{0,3735,0,3735}}, {0,1,{0,3738,0,3738}}, {0,1,{0,3742,0,3742}}, {0,1,{0,3745,0,3745}},
+  {0,1,{3747,3747,1216,1216}}, {0,1,{1708,1708,21,21}}, {0,1,{0,3749,0,3749}}, {0,1,{0,0,3751,3751}},
+  {0,1,{0,3753,0,3753}}, {0,1,{0,1200,0,1200}}, {0,1,{0,3757,0,3757}}, {0,1,{0,3759,0,3759}},
+  {0,1,{0,3761,0,3761}}, {0,1,{0,3763,0,3763}}, {0,1,{0,3767,0,3767}}, {0,1,{0,3771,0,3771}},
+  {0,1,{0,3776,0,3776}}, {0,1,{0,3780,0,3780}}, {0,1,{0,3784,0,3784}}, {0,1,{0,3788,0,3788}},
+  {0,1,{0,3792,0,3792}}, {0,1,{0,3796,0,3796}}, {0,1,{0,3800,0,3800}}, {0,1,{0,3804,0,3804}},
+  {0,1,{0,3808,0,3808}}, {0,1,{0,3812,0,3812}}, {0,1,{0,3816,0,3816}}, {0,1,{0,3820,0,3820}},
+  {0,1,{0,3824,0,3824}}, {0,1,{0,1704,3827,17}}, {0,1,{0,3829,3832,3834}}, {0,1,{0,3837,3841,3843}},
+  {0,1,{0,3847,3850,3852}}, {0,1,{0,3855,3857,43}}, {0,1,{0,3859,3862,3864}}, {0,1,{0,3867,3871,3873}},
+  {0,1,{0,3877,3882,3884}}, {0,1,{0,3889,3892,3894}}, {0,1,{0,3897,3899,47}}, {0,1,{0,3901,3904,3906}},
+  {0,1,{0,3909,3913,3915}}, {0,1,{0,1710,3919,23}}, {0,1,{0,3712,3921,5}}, {0,1,{0,1694,3923,7}},
+  {0,1,{0,1712,3925,25}}, {0,1,{0,3834,0,3834}}, {0,1,{0,3843,0,3843}}, {0,1,{0,3852,0,3852}},
+  {0,1,{0,3864,0,3864}}, {0,1,{0,3873,0,3873}}, {0,1,{0,3884,0,3884}}, {0,1,{0,3894,0,3894}},
+  {0,1,{0,3906,0,3906}}, {0,1,{0,3915,0,3915}}, {0,1,{0,0,3927,3927}}, {0,1,{0,3929,0,3929}},
+  {0,1,{3933,3933,3933,3933}}, {0,1,{3936,3936,3936,3936}}, {0,1,{3939,3939,3939,3939}}, {0,1,{3942,3942,3942,3942}},
+  {0,1,{3945,3945,3945,3945}}, {0,1,{3948,3948,3948,3948}}, {0,1,{3951,3951,3951,3951}}, {0,1,{3954,3954,3954,3954}},
+  {0,1,{3957,3957,3957,3957}}, {0,1,{3960,3960,3960,3960}}, {0,1,{3963,3963,3963,3963}}, {0,1,{0,3966,0,3966}},
+  {0,1,{0,3969,0,3969}}, {0,1,{0,3973,0,3973}}, {0,1,{0,3976,0,3976}}, {0,1,{3980,3980,3980,3980}},
+  {0,1,{3983,3983,3983,3983}}, {0,1,{3986,3986,3986,3986}}, {0,1,{3989,3989,3989,3989}}, {0,1,{3992,3992,3992,3992}},
+  {0,1,{3995,3995,3995,3995}}, {0,1,{3998,3998,3998,3998}}, {0,1,{4001,4001,4001,4001}}, {0,1,{4004,4004,4004,4004}},
+  {0,1,{4007,4007,4007,4007}}, {0,1,{4010,4010,4010,4010}}, {0,1,{4013,4013,4013,4013}}, {0,1,{4016,4016,4016,4016}},
+  {0,1,{4019,4019,4019,4019}}, {0,1,{4022,4022,4022,4022}}, {0,1,{4025,4025,4025,4025}}, {0,1,{4028,4028,4028,4028}},
+  {0,1,{4031,4031,4031,4031}}, {0,1,{4034,4034,4034,4034}}, {0,1,{4037,4037,4037,4037}}, {0,1,{4040,4040,4040,4040}},
+  {0,1,{4043,4043,4043,4043}}, {0,1,{4046,4046,4046,4046}}, {0,1,{4049,4049,4049,4049}}, {0,1,{4052,4052,4052,4052}},
+  {0,1,{4055,4055,4055,4055}}, {0,1,{4058,4058,4058,4058}}, {0,1,{4061,4061,4061,4061}}, {0,1,{4064,4064,4064,4064}},
+  {0,1,{4067,4067,4067,4067}}, {0,1,{4070,4070,4070,4070}}, {0,1,{4073,4073,4073,4073}}, {0,1,{4076,4076,4076,4076}},
+  {0,1,{4079,4079,4079,4079}}, {0,1,{4081,4081,4081,4081}}, {0,1,{0,4083,0,4083}}, {0,1,{0,4086,0,4086}},
+  {0,1,{0,4089,0,4089}}, {0,1,{0,4092,0,4092}}, {0,1,{0,4095,0,4095}}, {0,1,{0,4098,0,4098}},
+  {0,1,{0,4101,0,4101}}, {0,1,{0,4104,0,4104}}, {0,1,{0,4107,0,4107}}, {0,1,{0,4110,0,4110}},
+  {0,1,{0,4113,0,4113}}, {0,1,{0,4116,0,4116}}, {0,1,{0,4120,0,4120}}, {0,1,{0,4124,0,4124}},
+  {0,1,{0,4128,0,4128}}, {0,1,{0,4132,0,4132}}, {0,1,{0,4136,0,4136}}, {0,1,{0,4140,0,4140}},
+  {0,1,{0,4144,0,4144}}, {0,1,{0,4148,0,4148}}, {0,1,{0,4152,0,4152}}, {0,1,{0,4157,0,4157}},
+  {0,1,{0,4162,0,4162}}, {0,1,{0,4167,0,4167}}, {0,1,{0,4172,0,4172}}, {0,1,{0,4177,0,4177}},
+  {0,1,{0,4182,0,4182}}, {0,1,{0,4187,0,4187}}, {0,1,{0,4192,0,4192}}, {0,1,{0,4197,0,4197}},
+  {0,1,{0,4202,0,4202}}, {0,1,{0,4207,0,4207}}, {0,1,{0,4210,0,4210}}, {0,1,{0,4213,0,4213}},
+  {0,1,{0,4216,0,4216}}, {0,1,{0,4219,0,4219}}, {0,1,{0,4222,0,4222}}, {0,1,{0,4225,0,4225}},
+  {0,1,{0,4228,0,4228}}, {0,1,{0,4231,0,4231}}, {0,1,{0,4234,0,4234}}, {0,1,{0,4238,0,4238}},
+  {0,1,{0,4242,0,4242}}, {0,1,{0,4246,0,4246}}, {0,1,{0,4250,0,4250}}, {0,1,{0,4254,0,4254}},
+  {0,1,{0,4258,0,4258}}, {0,1,{0,4262,0,4262}}, {0,1,{0,4266,0,4266}}, {0,1,{0,4270,0,4270}},
+  {0,1,{0,4274,0,4274}}, {0,1,{0,4278,0,4278}}, {0,1,{0,4282,0,4282}}, {0,1,{0,4286,0,4286}},
+  {0,1,{0,4290,0,4290}}, {0,1,{0,4294,0,4294}}, {0,1,{0,4298,0,4298}}, {0,1,{0,4302,0,4302}},
+  {0,1,{0,4306,0,4306}}, {0,1,{0,4310,0,4310}}, {0,1,{0,4314,0,4314}}, {0,1,{0,4318,0,4318}},
+  {0,1,{0,4322,0,4322}}, {0,1,{0,4326,0,4326}}, {0,1,{0,4330,0,4330}}, {0,1,{0,4334,0,4334}},
+  {0,1,{0,4338,0,4338}}, {0,1,{0,4342,0,4342}}, {0,1,{0,4346,0,4346}}, {0,1,{0,4350,0,4350}},
+  {0,1,{0,4354,0,4354}}, {0,1,{0,4358,0,4358}}, {0,1,{0,4362,0,4362}}, {0,1,{0,4366,0,4366}},
+  {0,1,{0,4370,0,4370}}, {0,1,{0,4374,0,4374}}, {0,1,{0,4378,0,4378}}, {0,1,{0,1688,4382,1}},
+  {0,1,{0,1692,4384,3}}, {0,1,{0,3712,4386,5}}, {0,1,{0,1694,4388,7}}, {0,1,{0,1696,4390,9}},
+  {0,1,{0,3749,4392,11}}, {0,1,{0,1700,4394,13}}, {0,1,{0,1702,4396,15}}, {0,1,{0,1704,4398,17}},
+  {0,1,{0,1706,4400,19}}, {0,1,{0,1708,4402,21}}, {0,1,{0,1710,4404,23}}, {0,1,{0,1712,4406,25}},
+  {0,1,{0,1714,4408,27}}, {0,1,{0,1716,4410,29}}, {0,1,{0,1720,4412,31}}, {0,1,{0,3733,4414,33}},
+  {0,1,{0,1722,4416,35}}, {0,1,{0,4418,4420,37}}, {0,1,{0,1724,4422,39}}, {0,1,{0,1726,4424,41}},
+  {0,1,{0,3855,4426,43}}, {0,1,{0,1728,4428,45}}, {0,1,{0,3897,4430,47}}, {0,1,{0,4432,4434,49}},
+  {0,1,{0,3745,4436,51}}, {0,1,{0,33,0,33}}, {0,1,{0,0,4438,4438}}, {0,1,{0,0,4440,4440}},
+  {0,1,{0,0,4442,4442}}, {0,1,{0,0,4444,4444}}, {0,1,{0,0,4446,4446}}, {0,1,{0,0,4448,4448}},
+  {0,1,{0,0,4450,4450}}, {0,1,{0,0,1732,1732}}, {0,1,{0,0,1768,1768}}, {0,1,{0,0,1730,1730}},
+  {0,1,{0,0,1746,1746}}, {0,1,{0,0,4452,4452}}, {0,1,{0,0,4454,4454}}, {0,1,{0,3855,0,3855}},
+  {0,1,{0,0,4456,4456}}, {0,1,{0,0,4458,4458}}, {218,1,{0,0,0,0}}, {228,1,{0,0,0,0}},
+  {232,1,{0,0,0,0}}, {222,1,{0,0,0,0}}, {224,1,{0,0,0,0}}, {0,1,{0,4460,0,4460}},
+  {0,1,{0,4462,0,4462}}, {0,1,{0,4464,0,4464}}, {0,1,{0,4466,0,4466}}, {0,1,{4468,4468,4468,4468}},
+  {0,1,{4471,4471,4471,4471}}, {0,1,{4474,4474,4474,4474}}, {0,1,{4477,4477,4477,4477}}, {0,1,{4480,4480,4480,4480}},
+  {0,1,{4483,4483,4483,4483}}, {0,1,{4486,4486,4486,4486}}, {0,1,{4489,4489,4489,4489}}, {0,1,{4492,4492,4492,4492}},
+  {0,1,{4495,4495,4495,4495}}, {0,1,{4498,4498,4498,4498}}, {0,1,{4501,4501,4501,4501}}, {0,1,{4504,4504,4504,4504}},
+  {0,1,{4507,4507,4507,4507}}, {0,1,{4510,4510,4510,4510}}, {0,1,{4513,4513,4513,4513}}, {0,1,{4516,4516,4516,4516}},
+  {0,1,{4519,4519,4519,4519}}, {0,1,{4522,4522,4522,4522}}, {0,1,{4525,4525,4525,4525}}, {0,1,{4528,4528,4528,4528}},
+  {0,1,{4531,4531,4531,4531}}, {0,1,{4534,4534,4534,4534}}, {0,1,{4537,4537,4537,4537}}, {0,1,{4540,4540,4540,4540}},
+  {0,1,{4543,4543,4543,4543}}, {8,3,{0,0,0,0}}, {0,1,{0,4546,0,4546}}, {0,1,{0,4549,0,4549}},
+  {0,1,{4552,4552,4552,4552}}, {0,1,{0,4555,0,4555}}, {0,1,{4558,4558,4558,4558}}, {0,1,{4561,4561,4561,4561}},
+  {0,1,{4564,4564,4564,4564}}, {0,1,{4567,4567,4567,4567}}, {0,1,{4570,4570,4570,4570}}, {0,1,{4573,4573,4573,4573}},
+  {0,1,{4576,4576,4576,4576}}, {0,1,{4579,4579,4579,4579}}, {0,1,{4582,4582,4582,4582}}, {0,1,{4585,4585,4585,4585}},
+  {0,1,{4588,4588,4588,4588}}, {0,1,{4591,4591,4591,4591}}, {0,1,{4594,4594,4594,4594}}, {0,1,{4597,4597,4597,4597}},
+  {0,1,{4600,4600,4600,4600}}, {0,1,{4603,4603,4603,4603}}, {0,1,{4606,4606,4606,4606}}, {0,1,{4609,4609,4609,4609}},
+  {0,1,{4612,4612,4612,4612}}, {0,1,{4615,4615,4615,4615}}, {0,1,{4618,4618,4618,4618}}, {0,1,{4621,4621,4621,4621}},
+  {0,1,{4624,4624,4624,4624}}, {0,1,{4627,4627,4627,4627}}, {0,1,{4630,4630,4630,4630}}, {0,1,{4633,4633,4633,4633}},
+  {0,1,{4636,4636,4636,4636}}, {0,1,{4639,4639,4639,4639}}, {0,1,{4642,4642,4642,4642}}, {0,1,{4645,4645,4645,4645}},
+  {0,1,{4648,4648,4648,4648}}, {0,1,{0,4651,0,4651}}, {0,1,{0,4654,0,4654}}, {0,1,{0,4656,0,4656}},
+  {0,1,{0,4658,0,4658}}, {0,1,{0,4660,0,4660}}, {0,1,{0,4662,0,4662}}, {0,1,{0,4664,0,4664}},
+  {0,1,{0,4666,0,4666}}, {0,1,{0,4668,0,4668}}, {0,1,{0,4670,0,4670}}, {0,1,{0,4672,0,4672}},
+  {0,1,{0,4674,0,4674}}, {0,1,{0,4676,0,4676}}, {0,1,{0,4678,0,4678}}, {0,1,{0,4680,0,4680}},
+  {0,1,{0,4682,0,4682}}, {0,1,{0,4684,0,4684}}, {0,1,{0,4686,0,4686}}, {0,1,{0,4688,0,4688}},
+  {0,1,{0,4690,0,4690}}, {0,1,{0,4692,0,4692}}, {0,1,{0,4694,0,4694}}, {0,1,{0,4696,0,4696}},
+  {0,1,{0,4698,0,4698}}, {0,1,{0,4700,0,4700}}, {0,1,{0,4702,0,4702}}, {0,1,{0,4704,0,4704}},
+  {0,1,{0,4706,0,4706}}, {0,1,{0,4708,0,4708}}, {0,1,{0,4710,0,4710}}, {0,1,{0,4712,0,4712}},
+  {0,1,{0,4714,0,4714}}, {0,1,{0,4716,0,4716}}, {0,1,{0,4718,0,4718}}, {0,1,{0,4720,0,4720}},
+  {0,1,{0,4722,0,4722}}, {0,1,{0,4724,0,4724}}, {0,1,{0,4726,0,4726}}, {0,1,{0,4728,0,4728}},
+  {0,1,{0,4730,0,4730}}, {0,1,{0,4732,0,4732}}, {0,1,{0,4734,0,4734}}, {0,1,{0,4736,0,4736}},
+  {0,1,{0,4738,0,4738}}, {0,1,{0,4740,0,4740}}, {0,1,{0,4742,0,4742}}, {0,1,{0,4744,0,4744}},
+  {0,1,{0,4746,0,4746}}, {0,1,{0,4748,0,4748}}, {0,1,{0,4750,0,4750}}, {0,1,{0,4752,0,4752}},
+  {0,1,{0,4754,0,4754}}, {0,1,{0,4756,0,4756}}, {0,1,{0,4758,0,4758}}, {0,1,{0,4760,0,4760}},
+  {0,1,{0,4762,0,4762}}, {0,1,{0,4764,0,4764}}, {0,1,{0,4766,0,4766}}, {0,1,{0,4768,0,4768}},
+  {0,1,{0,4770,0,4770}}, {0,1,{0,4772,0,4772}}, {0,1,{0,4774,0,4774}}, {0,1,{0,4776,0,4776}},
+  {0,1,{0,4778,0,4778}}, {0,1,{0,4780,0,4780}}, {0,1,{0,4782,0,4782}}, {0,1,{0,4784,0,4784}},
+  {0,1,{0,4786,0,4786}}, {0,1,{0,4788,0,4788}}, {0,1,{0,4790,0,4790}}, {0,1,{0,4792,0,4792}},
+  {0,1,{0,4794,0,4794}}, {0,1,{0,4796,0,4796}}, {0,1,{0,4798,0,4798}}, {0,1,{0,4800,0,4800}},
+  {0,1,{0,4802,0,4802}}, {0,1,{0,4804,0,4804}}, {0,1,{0,4806,0,4806}}, {0,1,{0,4808,0,4808}},
+  {0,1,{0,4810,0,4810}}, {0,1,{0,4812,0,4812}}, {0,1,{0,4814,0,4814}}, {0,1,{0,4816,0,4816}},
+  {0,1,{0,4818,0,4818}}, {0,1,{0,4820,0,4820}}, {0,1,{0,4822,0,4822}}, {0,1,{0,4824,0,4824}},
+  {0,1,{0,4826,0,4826}}, {0,1,{0,4828,0,4828}}, {0,1,{0,4830,0,4830}}, {0,1,{0,4832,0,4832}},
+  {0,1,{0,4834,0,4834}}, {0,1,{0,4836,0,4836}}, {0,1,{0,4838,0,4838}}, {0,1,{0,4840,0,4840}},
+  {0,1,{0,4842,0,4842}}, {0,1,{0,4846,0,4846}}, {0,1,{0,4850,0,4850}}, {0,1,{0,4854,0,4854}},
+  {0,1,{0,4858,0,4858}}, {0,1,{0,4862,0,4862}}, {0,1,{0,4866,0,4866}}, {0,1,{0,4870,0,4870}},
+  {0,1,{0,4874,0,4874}}, {0,1,{0,4878,0,4878}}, {0,1,{0,4882,0,4882}}, {0,1,{0,4886,0,4886}},
+  {0,1,{0,4890,0,4890}}, {0,1,{0,4894,0,4894}}, {0,1,{0,4898,0,4898}}, {0,1,{0,4903,0,4903}},
+  {0,1,{0,4908,0,4908}}, {0,1,{0,4913,0,4913}}, {0,1,{0,4918,0,4918}}, {0,1,{0,4923,0,4923}},
+  {0,1,{0,4928,0,4928}}, {0,1,{0,4933,0,4933}}, {0,1,{0,4938,0,4938}}, {0,1,{0,4943,0,4943}},
+  {0,1,{0,4948,0,4948}}, {0,1,{0,4953,0,4953}}, {0,1,{0,4958,0,4958}}, {0,1,{0,4963,0,4963}},
+  {0,1,{0,4968,0,4968}}, {0,1,{0,4973,0,4973}}, {0,1,{0,4981,0,4981}}, {0,1,{0,4988,0,4988}},
+  {0,1,{0,4992,0,4992}}, {0,1,{0,4996,0,4996}}, {0,1,{0,5000,0,5000}}, {0,1,{0,5004,0,5004}},
+  {0,1,{0,5008,0,5008}}, {0,1,{0,5012,0,5012}}, {0,1,{0,5016,0,5016}}, {0,1,{0,5020,0,5020}},
+  {0,1,{0,5024,0,5024}}, {0,1,{0,5028,0,5028}}, {0,1,{0,5032,0,5032}}, {0,1,{0,5036,0,5036}},
+  {0,1,{0,5040,0,5040}}, {0,1,{0,5044,0,5044}}, {0,1,{0,5048,0,5048}}, {0,1,{0,5052,0,5052}},
+  {0,1,{0,5056,0,5056}}, {0,1,{0,5060,0,5060}}, {0,1,{0,5064,0,5064}}, {0,1,{0,5068,0,5068}},
+  {0,1,{0,5072,0,5072}}, {0,1,{0,5076,0,5076}}, {0,1,{0,5080,0,5080}}, {0,1,{0,5084,0,5084}},
+  {0,1,{0,5088,0,5088}}, {0,1,{0,5092,0,5092}}, {0,1,{0,5096,0,5096}}, {0,1,{0,5100,0,5100}},
+  {0,1,{0,5104,0,5104}}, {0,1,{0,5108,0,5108}}, {0,1,{0,5112,0,5112}}, {0,1,{0,5116,0,5116}},
+  {0,1,{0,5120,0,5120}}, {0,1,{0,5124,0,5124}}, {0,1,{0,5128,0,5128}}, {0,1,{0,5132,0,5132}},
+  {0,1,{0,5134,0,5134}}, {0,1,{0,5136,0,5136}}, {0,1,{0,5138,0,5138}}, {0,1,{0,5140,0,5140}},
+  {0,1,{0,5144,0,5144}}, {0,1,{0,5147,0,5147}}, {0,1,{0,5150,0,5150}}, {0,1,{0,5153,0,5153}},
+  {0,1,{0,5156,0,5156}}, {0,1,{0,5159,0,5159}}, {0,1,{0,5162,0,5162}}, {0,1,{0,5165,0,5165}},
+  {0,1,{0,5168,0,5168}}, {0,1,{0,5171,0,5171}}, {0,1,{0,5174,0,5174}}, {0,1,{0,5177,0,5177}},
+  {0,1,{0,5180,0,5180}}, {0,1,{0,5183,0,5183}}, {0,1,{0,5186,0,5186}}, {0,1,{0,5189,0,5189}},
+  {0,1,{0,5192,0,5192}}, {0,1,{0,5195,0,5195}}, {0,1,{0,5198,0,5198}}, {0,1,{0,5201,0,5201}},
+  {0,1,{0,5204,0,5204}}, {0,1,{0,5207,0,5207}}, {0,1,{0,5210,0,5210}}, {0,1,{0,5213,0,5213}},
+  {0,1,{0,5216,0,5216}}, {0,1,{0,5219,0,5219}}, {0,1,{0,5222,0,5222}}, {0,1,{0,5225,0,5225}},
+  {0,1,{0,5228,0,5228}}, {0,1,{0,5231,0,5231}}, {0,1,{0,5237,0,5237}}, {0,1,{0,5242,0,5242}},
+  {0,1,{0,5245,0,5245}}, {0,1,{0,5247,0,5247}}, {0,1,{0,5249,0,5249}}, {0,1,{0,5251,0,5251}},
+  {0,1,{0,5253,0,5253}}, {0,1,{0,5255,0,5255}}, {0,1,{0,5257,0,5257}}, {0,1,{0,5259,0,5259}},
+  {0,1,{0,5261,0,5261}}, {0,1,{0,5263,0,5263}}, {0,1,{0,5265,0,5265}}, {0,1,{0,5267,0,5267}},
+  {0,1,{0,5269,0,5269}}, {0,1,{0,5271,0,5271}}, {0,1,{0,5273,0,5273}}, {0,1,{0,5275,0,5275}},
+  {0,1,{0,5277,0,5277}}, {0,1,{0,5279,0,5279}}, {0,1,{0,5281,0,5281}}, {0,1,{0,5283,0,5283}},
+  {0,1,{0,5285,0,5285}}, {0,1,{0,5287,0,5287}}, {0,1,{0,5289,0,5289}}, {0,1,{0,5291,0,5291}},
+  {0,1,{0,5293,0,5293}}, {0,1,{0,5295,0,5295}}, {0,1,{0,5297,0,5297}}, {0,1,{0,5299,0,5299}},
+  {0,1,{0,5301,0,5301}}, {0,1,{0,5303,0,5303}}, {0,1,{0,5305,0,5305}}, {0,1,{0,5307,0,5307}},
+  {0,1,{0,5309,0,5309}}, {0,1,{0,5311,0,5311}}, {0,1,{0,5313,0,5313}}, {0,1,{0,5315,0,5315}},
+  {0,1,{0,5317,0,5317}}, {0,1,{0,5319,0,5319}}, {0,1,{0,5321,0,5321}}, {0,1,{0,5323,0,5323}},
+  {0,1,{0,5325,0,5325}}, {0,1,{0,5327,0,5327}}, {0,1,{0,5329,0,5329}}, {0,1,{0,5331,0,5331}},
+  {0,1,{0,5333,0,5333}}, {0,1,{0,5335,0,5335}}, {0,1,{0,5337,0,5337}}, {0,1,{0,5339,0,5339}},
+  {0,1,{0,5341,0,5341}}, {0,1,{0,5344,0,5344}}, {0,1,{0,5347,0,5347}}, {0,1,{0,5350,0,5350}},
+  {0,1,{0,5353,0,5353}}, {0,1,{0,5356,0,5356}}, {0,1,{0,5359,0,5359}}, {0,1,{0,5362,0,5362}},
+  {0,1,{0,5365,0,5365}}, {0,1,{0,5368,0,5368}}, {0,1,{0,5371,0,5371}}, {0,1,{0,5374,0,5374}},
+  {0,1,{0,5377,0,5377}}, {0,1,{0,5380,0,5380}}, {0,1,{0,5383,0,5383}}, {0,1,{0,5386,0,5386}},
+  {0,1,{0,5389,0,5389}}, {0,1,{0,5392,0,5392}}, {0,1,{0,5395,0,5395}}, {0,1,{0,5398,0,5398}},
+  {0,1,{0,5401,0,5401}}, {0,1,{0,5404,0,5404}}, {0,1,{0,5407,0,5407}}, {0,1,{0,5410,0,5410}},
+  {0,1,{0,5413,0,5413}}, {0,1,{0,5417,0,5417}}, {0,1,{0,5421,0,5421}}, {0,1,{0,5425,0,5425}},
+  {0,1,{0,5428,0,5428}}, {0,1,{0,5432,0,5432}}, {0,1,{0,5435,0,5435}}, {0,1,{0,5439,0,5439}},
+  {0,1,{0,5441,0,5441}}, {0,1,{0,5443,0,5443}}, {0,1,{0,5445,0,5445}}, {0,1,{0,5447,0,5447}},
+  {0,1,{0,5449,0,5449}}, {0,1,{0,5451,0,5451}}, {0,1,{0,5453,0,5453}}, {0,1,{0,5455,0,5455}},
+  {0,1,{0,5457,0,5457}}, {0,1,{0,5459,0,5459}}, {0,1,{0,5461,0,5461}}, {0,1,{0,5463,0,5463}},
+  {0,1,{0,5465,0,5465}}, {0,1,{0,5467,0,5467}}, {0,1,{0,5469,0,5469}}, {0,1,{0,5471,0,5471}},
+  {0,1,{0,5473,0,5473}}, {0,1,{0,5475,0,5475}}, {0,1,{0,5477,0,5477}}, {0,1,{0,5479,0,5479}},
+  {0,1,{0,5481,0,5481}}, {0,1,{0,5483,0,5483}}, {0,1,{0,5485,0,5485}}, {0,1,{0,5487,0,5487}},
+  {0,1,{0,5489,0,5489}}, {0,1,{0,5491,0,5491}}, {0,1,{0,5493,0,5493}}, {0,1,{0,5495,0,5495}},
+  {0,1,{0,5497,0,5497}}, {0,1,{0,5499,0,5499}}, {0,1,{0,5501,0,5501}}, {0,1,{0,5503,0,5503}},
+  {0,1,{0,5505,0,5505}}, {0,1,{0,5507,0,5507}}, {0,1,{0,5509,0,5509}}, {0,1,{0,5511,0,5511}},
+  {0,1,{0,5513,0,5513}}, {0,1,{0,5515,0,5515}}, {0,1,{0,5517,0,5517}}, {0,1,{0,5519,0,5519}},
+  {0,1,{0,5521,0,5521}}, {0,1,{0,5523,0,5523}}, {0,1,{0,5525,0,5525}}, {0,1,{0,5527,0,5527}},
+  {0,1,{0,5529,0,5529}}, {0,1,{0,5531,0,5531}}, {0,1,{0,5533,0,5533}}, {0,1,{0,5536,0,5536}},
+  {0,1,{0,5542,0,5542}}, {0,1,{0,5547,0,5547}}, {0,1,{0,5553,0,5553}}, {0,1,{0,5557,0,5557}},
+  {0,1,{0,5563,0,5563}}, {0,1,{0,5567,0,5567}}, {0,1,{0,5571,0,5571}}, {0,1,{0,5578,0,5578}},
+  {0,1,{0,5583,0,5583}}, {0,1,{0,5587,0,5587}}, {0,1,{0,5591,0,5591}}, {0,1,{0,5595,0,5595}},
+  {0,1,{0,5600,0,5600}}, {0,1,{0,5605,0,5605}}, {0,1,{0,5610,0,5610}}, {0,1,{0,5615,0,5615}},
+  {0,1,{0,5620,0,5620}}, {0,1,{0,5625,0,5625}}, {0,1,{0,5630,0,5630}}, {0,1,{0,5637,0,5637}},
+  {0,1,{0,5640,0,5640}}, {0,1,{0,5647,0,5647}}, {0,1,{0,5654,0,5654}}, {0,1,{0,5660,0,5660}},
+  {0,1,{0,5665,0,5665}}, {0,1,{0,5672,0,5672}}, {0,1,{0,5679,0,5679}}, {0,1,{0,5684,0,5684}},
+  {0,1,{0,5688,0,5688}}, {0,1,{0,5692,0,5692}}, {0,1,{0,5697,0,5697}}, {0,1,{0,5702,0,5702}},
+  {0,1,{0,5708,0,5708}}, {0,1,{0,5714,0,5714}}, {0,1,{0,5718,0,5718}}, {0,1,{0,5722,0,5722}},
+  {0,1,{0,5727,0,5727}}, {0,1,{0,5731,0,5731}}, {0,1,{0,5735,0,5735}}, {0,1,{0,5738,0,5738}},
+  {0,1,{0,5741,0,5741}}, {0,1,{0,5745,0,5745}}, {0,1,{0,5749,0,5749}}, {0,1,{0,5756,0,5756}},
+  {0,1,{0,5761,0,5761}}, {0,1,{0,5767,0,5767}}, {0,1,{0,5774,0,5774}}, {0,1,{0,5779,0,5779}},
+  {0,1,{0,5783,0,5783}}, {0,1,{0,5787,0,5787}}, {0,1,{0,5794,0,5794}}, {0,1,{0,5799,0,5799}},
+  {0,1,{0,5806,0,5806}}, {0,1,{0,5810,0,5810}}, {0,1,{0,5816,0,5816}}, {0,1,{0,5820,0,5820}},
+  {0,1,{0,5825,0,5825}}, {0,1,{0,5829,0,5829}}, {0,1,{0,5834,0,5834}}, {0,1,{0,5840,0,5840}},
+  {0,1,{0,5845,0,5845}}, {0,1,{0,5851,0,5851}}, {0,1,{0,5856,0,5856}}, {0,1,{0,5859,0,5859}},
+  {0,1,{0,5865,0,5865}}, {0,1,{0,5869,0,5869}}, {0,1,{0,5873,0,5873}}, {0,1,{0,5878,0,5878}},
+  {0,1,{0,5882,0,5882}}, {0,1,{0,5886,0,5886}}, {0,1,{0,5890,0,5890}}, {0,1,{0,5896,0,5896}},
+  {0,1,{0,5901,0,5901}}, {0,1,{0,5904,0,5904}}, {0,1,{0,5911,0,5911}}, {0,1,{0,5915,0,5915}},
+  {0,1,{0,5921,0,5921}}, {0,1,{0,5926,0,5926}}, {0,1,{0,5931,0,5931}}, {0,1,{0,5935,0,5935}},
+  {0,1,{0,5939,0,5939}}, {0,1,{0,5944,0,5944}}, {0,1,{0,5947,0,5947}}, {0,1,{0,5952,0,5952}},
+  {0,1,{0,5958,0,5958}}, {0,1,{0,5961,0,5961}}, {0,1,{0,5968,0,5968}}, {0,1,{0,5972,0,5972}},
+  {0,1,{0,5975,0,5975}}, {0,1,{0,5978,0,5978}}, {0,1,{0,5981,0,5981}}, {0,1,{0,5984,0,5984}},
+  {0,1,{0,5987,0,5987}}, {0,1,{0,5990,0,5990}}, {0,1,{0,5993,0,5993}}, {0,1,{0,5996,0,5996}},
+  {0,1,{0,5999,0,5999}}, {0,1,{0,6002,0,6002}}, {0,1,{0,6006,0,6006}}, {0,1,{0,6010,0,6010}},
+  {0,1,{0,6014,0,6014}}, {0,1,{0,6018,0,6018}}, {0,1,{0,6022,0,6022}}, {0,1,{0,6026,0,6026}},
+  {0,1,{0,6030,0,6030}}, {0,1,{0,6034,0,6034}}, {0,1,{0,6038,0,6038}}, {0,1,{0,6042,0,6042}},
+  {0,1,{0,6046,0,6046}}, {0,1,{0,6050,0,6050}}, {0,1,{0,6054,0,6054}}, {0,1,{0,6058,0,6058}},
+  {0,1,{0,6062,0,6062}}, {0,1,{0,6066,0,6066}}, {0,1,{0,6069,0,6069}}, {0,1,{0,6072,0,6072}},
+  {0,1,{0,6076,0,6076}}, {0,1,{0,6079,0,6079}}, {0,1,{0,6082,0,6082}}, {0,1,{0,6085,0,6085}},
+  {0,1,{0,6089,0,6089}}, {0,1,{0,6093,0,6093}}, {0,1,{0,6096,0,6096}}, {0,1,{0,6099,0,6099}},
+  {0,1,{0,6102,0,6102}}, {0,1,{0,6105,0,6105}}, {0,1,{0,6108,0,6108}}, {0,1,{0,6113,0,6113}},
+  {0,1,{0,6116,0,6116}}, {0,1,{0,6119,0,6119}}, {0,1,{0,6122,0,6122}}, {0,1,{0,6125,0,6125}},
+  {0,1,{0,6128,0,6128}}, {0,1,{0,6131,0,6131}}, {0,1,{0,6134,0,6134}}, {0,1,{0,6137,0,6137}},
+  {0,1,{0,6141,0,6141}}, {0,1,{0,6146,0,6146}}, {0,1,{0,6149,0,6149}}, {0,1,{0,6152,0,6152}},
+  {0,1,{0,6155,0,6155}}, {0,1,{0,6158,0,6158}}, {0,1,{0,6161,0,6161}}, {0,1,{0,6164,0,6164}},
+  {0,1,{0,6167,0,6167}}, {0,1,{0,6171,0,6171}}, {0,1,{0,6175,0,6175}}, {0,1,{0,6179,0,6179}},
+  {0,1,{0,6183,0,6183}}, {0,1,{0,6186,0,6186}}, {0,1,{0,6189,0,6189}}, {0,1,{0,6192,0,6192}},
+  {0,1,{0,6195,0,6195}}, {0,1,{0,6198,0,6198}}, {0,1,{0,6201,0,6201}}, {0,1,{0,6204,0,6204}},
+  {0,1,{0,6207,0,6207}}, {0,1,{0,6210,0,6210}}, {0,1,{0,6213,0,6213}}, {0,1,{0,6217,0,6217}},
+  {0,1,{0,6221,0,6221}}, {0,1,{0,6224,0,6224}}, {0,1,{0,6228,0,6228}}, {0,1,{0,6232,0,6232}},
+  {0,1,{0,6236,0,6236}}, {0,1,{0,6239,0,6239}}, {0,1,{0,6243,0,6243}}, {0,1,{0,6247,0,6247}},
+  {0,1,{0,6252,0,6252}}, {0,1,{0,6255,0,6255}}, {0,1,{0,6259,0,6259}}, {0,1,{0,6263,0,6263}},
+  {0,1,{0,6267,0,6267}}, {0,1,{0,6271,0,6271}}, {0,1,{0,6277,0,6277}}, {0,1,{0,6284,0,6284}},
+  {0,1,{0,6287,0,6287}}, {0,1,{0,6290,0,6290}}, {0,1,{0,6293,0,6293}}, {0,1,{0,6296,0,6296}},
+  {0,1,{0,6299,0,6299}}, {0,1,{0,6302,0,6302}}, {0,1,{0,6305,0,6305}}, {0,1,{0,6308,0,6308}},
+  {0,1,{0,6311,0,6311}}, {0,1,{0,6314,0,6314}}, {0,1,{0,6317,0,6317}}, {0,1,{0,6320,0,6320}},
+  {0,1,{0,6323,0,6323}}, {0,1,{0,6326,0,6326}}, {0,1,{0,6329,0,6329}}, {0,1,{0,6332,0,6332}},
+  {0,1,{0,6335,0,6335}}, {0,1,{0,6338,0,6338}}, {0,1,{0,6343,0,6343}}, {0,1,{0,6346,0,6346}},
+  {0,1,{0,6349,0,6349}}, {0,1,{0,6352,0,6352}}, {0,1,{0,6357,0,6357}}, {0,1,{0,6361,0,6361}},
+  {0,1,{0,6364,0,6364}}, {0,1,{0,6367,0,6367}}, {0,1,{0,6370,0,6370}}, {0,1,{0,6373,0,6373}},
+  {0,1,{0,6376,0,6376}}, {0,1,{0,6379,0,6379}}, {0,1,{0,6382,0,6382}}, {0,1,{0,6385,0,6385}},
+  {0,1,{0,6388,0,6388}}, {0,1,{0,6391,0,6391}}, {0,1,{0,6395,0,6395}}, {0,1,{0,6398,0,6398}},
+  {0,1,{0,6401,0,6401}}, {0,1,{0,6405,0,6405}}, {0,1,{0,6409,0,6409}}, {0,1,{0,6412,0,6412}},
+  {0,1,{0,6417,0,6417}}, {0,1,{0,6421,0,6421}}, {0,1,{0,6424,0,6424}}, {0,1,{0,6427,0,6427}},
+  {0,1,{0,6430,0,6430}}, {0,1,{0,6433,0,6433}}, {0,1,{0,6437,0,6437}}, {0,1,{0,6441,0,6441}},
+  {0,1,{0,6444,0,6444}}, {0,1,{0,6447,0,6447}}, {0,1,{0,6450,0,6450}}, {0,1,{0,6453,0,6453}},
+  {0,1,{0,6456,0,6456}}, {0,1,{0,6459,0,6459}}, {0,1,{0,6462,0,6462}}, {0,1,{0,6465,0,6465}},
+  {0,1,{0,6468,0,6468}}, {0,1,{0,6472,0,6472}}, {0,1,{0,6476,0,6476}}, {0,1,{0,6480,0,6480}},
+  {0,1,{0,6484,0,6484}}, {0,1,{0,6488,0,6488}}, {0,1,{0,6492,0,6492}}, {0,1,{0,6496,0,6496}},
+  {0,1,{0,6500,0,6500}}, {0,1,{0,6504,0,6504}}, {0,1,{0,6508,0,6508}}, {0,1,{0,6512,0,6512}},
+  {0,1,{0,6516,0,6516}}, {0,1,{0,6520,0,6520}}, {0,1,{0,6524,0,6524}}, {0,1,{0,6528,0,6528}},
+  {0,1,{0,6532,0,6532}}, {0,1,{0,6536,0,6536}}, {0,1,{0,6540,0,6540}}, {0,1,{0,6544,0,6544}},
+  {0,1,{0,6548,0,6548}}, {0,1,{0,6552,0,6552}}, {0,1,{0,6556,0,6556}}, {0,1,{0,0,6560,6560}},
+  {0,1,{0,0,6562,6562}}, {0,1,{0,0,6564,6564}}, {0,1,{0,0,6566,6566}}, {0,1,{0,0,6568,6568}},
+  {0,1,{0,0,6570,6570}}, {0,1,{0,0,6572,6572}}, {0,1,{0,0,6574,6574}}, {0,1,{0,0,6576,6576}},
+  {0,1,{0,0,6578,6578}}, {0,1,{0,0,6580,6580}}, {0,1,{0,0,6582,6582}}, {0,1,{0,0,6584,6584}},
+  {0,1,{0,0,6586,6586}}, {0,1,{0,0,6588,6588}}, {0,1,{0,0,6590,6590}}, {0,1,{0,0,6592,6592}},
+  {0,1,{0,0,6594,6594}}, {0,1,{0,0,6596,6596}}, {0,1,{0,0,6598,6598}}, {0,1,{0,0,6600,6600}},
+  {0,1,{0,0,6602,6602}}, {230,1,{0,0,0,0}}, {0,1,{0,0,6604,6604}}, {0,1,{0,0,6606,6606}},
+  {0,1,{0,0,6608,6608}}, {0,1,{0,0,6610,6610}}, {0,1,{0,0,6612,6612}}, {0,1,{0,0,6614,6614}},
+  {0,1,{0,0,6616,6616}}, {0,1,{0,0,6618,6618}}, {0,1,{0,0,6620,6620}}, {0,1,{0,0,6622,6622}},
+  {0,1,{0,0,6624,6624}}, {0,1,{0,0,6626,6626}}, {0,1,{0,0,6628,6628}}, {0,1,{0,0,6630,6630}},
+  {0,1,{0,1402,0,1402}}, {0,1,{0,1406,0,1406}}, {0,1,{0,0,6632,6632}}, {0,1,{0,0,6634,6634}},
+  {0,1,{0,0,6636,6636}}, {0,1,{0,0,6638,6638}}, {0,1,{0,0,6640,6640}}, {0,1,{0,0,6642,6642}},
+  {0,1,{0,0,6644,6644}}, {0,1,{0,0,6646,6646}}, {0,1,{0,0,6648,6648}}, {0,1,{0,0,6650,6650}},
+  {0,1,{0,0,6652,6652}}, {0,1,{0,0,6654,6654}}, {0,1,{0,0,6656,6656}}, {0,1,{0,0,6658,6658}},
+  {0,1,{0,0,6660,6660}}, {0,1,{0,0,6662,6662}}, {0,1,{0,0,6664,6664}}, {0,1,{0,0,6666,6666}},
+  {0,1,{0,0,6668,6668}}, {0,1,{0,0,6670,6670}}, {0,1,{0,0,6672,6672}}, {0,1,{0,0,6674,6674}},
+  {0,1,{0,0,6676,6676}}, {0,1,{0,0,6678,6678}}, {0,1,{0,0,6680,6680}}, {0,1,{0,0,6682,6682}},
+  {0,1,{0,0,6684,6684}}, {0,1,{0,0,6686,6686}}, {0,1,{0,0,6688,6688}}, {0,1,{0,0,6690,6690}},
+  {0,1,{0,0,6692,6692}}, {0,1,{0,0,6694,6694}}, {0,1,{0,0,6696,6696}}, {0,1,{0,0,6698,6698}},
+  {0,1,{0,0,6700,6700}}, {0,1,{0,0,6702,6702}}, {0,1,{0,0,6704,6704}}, {0,1,{0,0,6706,6706}},
+  {0,1,{0,6706,0,6706}}, {0,1,{0,0,6708,6708}}, {0,1,{0,0,6710,6710}}, {0,1,{0,0,6712,6712}},
+  {0,1,{0,0,6714,6714}}, {0,1,{0,0,6716,6716}}, {0,1,{0,0,6718,6718}}, {0,1,{0,0,6720,6720}},
+  {0,1,{0,0,6722,6722}}, {0,1,{0,0,6724,6724}}, {0,1,{0,0,1754,1754}}, {0,1,{0,0,6726,6726}},
+  {0,1,{0,0,6728,6728}}, {0,1,{0,0,6730,6730}}, {0,1,{0,0,6732,6732}}, {0,1,{0,0,6734,6734}},
+  {0,1,{0,0,6736,6736}}, {0,1,{0,0,6738,6738}}, {0,1,{0,0,6740,6740}}, {0,1,{0,0,6742,6742}},
+  {0,1,{0,0,6744,6744}}, {0,1,{0,0,6746,6746}}, {0,1,{0,0,6748,6748}}, {0,1,{0,0,1065,1065}},
+  {0,1,{0,0,1736,1736}}, {0,1,{0,0,1752,1752}}, {0,1,{0,0,6750,6750}}, {0,1,{0,0,1756,1756}},
+  {0,1,{0,0,6752,6752}}, {0,1,{0,0,6754,6754}}, {0,1,{0,0,1760,1760}}, {0,1,{0,0,6756,6756}},
+  {0,1,{0,0,6758,6758}}, {0,1,{0,0,6760,6760}}, {0,1,{0,0,6762,6762}}, {0,1,{0,0,6764,6764}},
+  {0,1,{0,0,6766,6766}}, {0,1,{0,0,6768,6768}}, {0,1,{0,0,6770,6770}}, {0,1,{0,0,6772,6772}},
+  {0,1,{0,0,6774,6774}}, {0,1,{0,0,1778,1778}}, {0,1,{0,0,6776,6776}}, {0,1,{0,0,6778,6778}},
+  {0,1,{0,0,6780,6780}}, {0,1,{0,0,6782,6782}}, {0,1,{0,0,6784,6784}}, {0,1,{0,0,6786,6786}},
+  {0,1,{0,0,6788,6788}}, {0,1,{0,6790,0,6790}}, {0,1,{0,488,0,488}}, {0,1,{0,6636,0,6636}},
+  {0,1,{0,6792,0,6792}}, {0,1,{0,4440,0,4440}}, {0,1,{0,6794,0,6794}}, {0,1,{0,6796,0,6796}},
+  {0,5,{0,0,0,0}}, {0,1,{6798,6798,6798,6798}}, {0,1,{6800,6800,6800,6800}}, {0,1,{6802,6802,6802,6802}},
+  {0,1,{6804,6804,6804,6804}}, {0,1,{6806,6806,6806,6806}}, {0,1,{6808,6808,6808,6808}}, {0,1,{6810,6810,6810,6810}},
+  {0,1,{6812,6812,6812,6812}}, {0,1,{6814,6814,6814,6814}}, {0,1,{5271,5271,5271,5271}}, {0,1,{6816,6816,6816,6816}},
+  {0,1,{6818,6818,6818,6818}}, {0,1,{6820,6820,6820,6820}}, {0,1,{6822,6822,6822,6822}}, {0,1,{6824,6824,6824,6824}},
+  {0,1,{6826,6826,6826,6826}}, {0,1,{6828,6828,6828,6828}}, {0,1,{6830,6830,6830,6830}}, {0,1,{6832,6832,6832,6832}},
+  {0,1,{6834,6834,6834,6834}}, {0,1,{6836,6836,6836,6836}}, {0,1,{6838,6838,6838,6838}}, {0,1,{6840,6840,6840,6840}},
+  {0,1,{6842,6842,6842,6842}}, {0,1,{6844,6844,6844,6844}}, {0,1,{6846,6846,6846,6846}}, {0,1,{6848,6848,6848,6848}},
+  {0,1,{6850,6850,6850,6850}}, {0,1,{6852,6852,6852,6852}}, {0,1,{6854,6854,6854,6854}}, {0,1,{6856,6856,6856,6856}},
+  {0,1,{6858,6858,6858,6858}}, {0,1,{6860,6860,6860,6860}}, {0,1,{6862,6862,6862,6862}}, {0,1,{6864,6864,6864,6864}},
+  {0,1,{6866,6866,6866,6866}}, {0,1,{6868,6868,6868,6868}}, {0,1,{6870,6870,6870,6870}}, {0,1,{6872,6872,6872,6872}},
+  {0,1,{6874,6874,6874,6874}}, {0,1,{6876,6876,6876,6876}}, {0,1,{6878,6878,6878,6878}}, {0,1,{6880,6880,6880,6880}},
+  {0,1,{6882,6882,6882,6882}}, {0,1,{6884,6884,6884,6884}}, {0,1,{6886,6886,6886,6886}}, {0,1,{6888,6888,6888,6888}},
+  {0,1,{6890,6890,6890,6890}}, {0,1,{6892,6892,6892,6892}}, {0,1,{6894,6894,6894,6894}}, {0,1,{6896,6896,6896,6896}},
+  {0,1,{6898,6898,6898,6898}}, {0,1,{6900,6900,6900,6900}}, {0,1,{6902,6902,6902,6902}}, {0,1,{6904,6904,6904,6904}},
+  {0,1,{6906,6906,6906,6906}}, {0,1,{6908,6908,6908,6908}}, {0,1,{6910,6910,6910,6910}}, {0,1,{6912,6912,6912,6912}},
+  {0,1,{6914,6914,6914,6914}}, {0,1,{6916,6916,6916,6916}}, {0,1,{6918,6918,6918,6918}}, {0,1,{6920,6920,6920,6920}},
+  {0,1,{6922,6922,6922,6922}}, {0,1,{6924,6924,6924,6924}}, {0,1,{6926,6926,6926,6926}}, {0,1,{6928,6928,6928,6928}},
+  {0,1,{6930,6930,6930,6930}}, {0,1,{6932,6932,6932,6932}}, {0,1,{6934,6934,6934,6934}}, {0,1,{6936,6936,6936,6936}},
+  {0,1,{6938,6938,6938,6938}}, {0,1,{6940,6940,6940,6940}}, {0,1,{6942,6942,6942,6942}}, {0,1,{6944,6944,6944,6944}},
+  {0,1,{6946,6946,6946,6946}}, {0,1,{6948,6948,6948,6948}}, {0,1,{6950,6950,6950,6950}}, {0,1,{6952,6952,6952,6952}},
+  {0,1,{6954,6954,6954,6954}}, {0,1,{6956,6956,6956,6956}}, {0,1,{6958,6958,6958,6958}}, {0,1,{6960,6960,6960,6960}},
+  {0,1,{6962,6962,6962,6962}}, {0,1,{6964,6964,6964,6964}}, {0,1,{6966,6966,6966,6966}}, {0,1,{6968,6968,6968,6968}},
+  {0,1,{6970,6970,6970,6970}}, {0,1,{6972,6972,6972,6972}}, {0,1,{6974,6974,6974,6974}}, {0,1,{6976,6976,6976,6976}},
+  {0,1,{6978,6978,6978,6978}}, {0,1,{6980,6980,6980,6980}}, {0,1,{6982,6982,6982,6982}}, {0,1,{6984,6984,6984,6984}},
+  {0,1,{6986,6986,6986,6986}}, {0,1,{6988,6988,6988,6988}}, {0,1,{6990,6990,6990,6990}}, {0,1,{6992,6992,6992,6992}},
+  {0,1,{6994,6994,6994,6994}}, {0,1,{6996,6996,6996,6996}}, {0,1,{6998,6998,6998,6998}}, {0,1,{7000,7000,7000,7000}},
+  {0,1,{7002,7002,7002,7002}}, {0,1,{7004,7004,7004,7004}}, {0,1,{7006,7006,7006,7006}}, {0,1,{7008,7008,7008,7008}},
+  {0,1,{7010,7010,7010,7010}}, {0,1,{7012,7012,7012,7012}}, {0,1,{7014,7014,7014,7014}}, {0,1,{7016,7016,7016,7016}},
+  {0,1,{7018,7018,7018,7018}}, {0,1,{7020,7020,7020,7020}}, {0,1,{7022,7022,7022,7022}}, {0,1,{7024,7024,7024,7024}},
+  {0,1,{7026,7026,7026,7026}}, {0,1,{7028,7028,7028,7028}}, {0,1,{7030,7030,7030,7030}}, {0,1,{7032,7032,7032,7032}},
+  {0,1,{7034,7034,7034,7034}}, {0,1,{7036,7036,7036,7036}}, {0,1,{7038,7038,7038,7038}}, {0,1,{7040,7040,7040,7040}},
+  {0,1,{7042,7042,7042,7042}}, {0,1,{7044,7044,7044,7044}}, {0,1,{7046,7046,7046,7046}}, {0,1,{7048,7048,7048,7048}},
+  {0,1,{5297,5297,5297,5297}}, {0,1,{7050,7050,7050,7050}}, {0,1,{7052,7052,7052,7052}}, {0,1,{7054,7054,7054,7054}},
+  {0,1,{7056,7056,7056,7056}}, {0,1,{7058,7058,7058,7058}}, {0,1,{7060,7060,7060,7060}}, {0,1,{7062,7062,7062,7062}},
+  {0,1,{7064,7064,7064,7064}}, {0,1,{7066,7066,7066,7066}}, {0,1,{7068,7068,7068,7068}}, {0,1,{7070,7070,7070,7070}},
+  {0,1,{7072,7072,7072,7072}}, {0,1,{7074,7074,7074,7074}}, {0,1,{7076,7076,7076,7076}}, {0,1,{7078,7078,7078,7078}},
+  {0,1,{7080,7080,7080,7080}}, {0,1,{7082,7082,7082,7082}}, {0,1,{7084,7084,7084,7084}}, {0,1,{7086,7086,7086,7086}},
+  {0,1,{7088,7088,7088,7088}}, {0,1,{7090,7090,7090,7090}}, {0,1,{7092,7092,7092,7092}}, {0,1,{7094,7094,7094,7094}},
+  {0,1,{7096,7096,7096,7096}}, {0,1,{7098,7098,7098,7098}}, {0,1,{7100,7100,7100,7100}}, {0,1,{7102,7102,7102,7102}},
+  {0,1,{7104,7104,7104,7104}}, {0,1,{7106,7106,7106,7106}}, {0,1,{7108,7108,7108,7108}}, {0,1,{7110,7110,7110,7110}},
+  {0,1,{7112,7112,7112,7112}}, {0,1,{7114,7114,7114,7114}}, {0,1,{7116,7116,7116,7116}}, {0,1,{7118,7118,7118,7118}},
+  {0,1,{7120,7120,7120,7120}}, {0,1,{7122,7122,7122,7122}}, {0,1,{7124,7124,7124,7124}}, {0,1,{7126,7126,7126,7126}},
+  {0,1,{7128,7128,7128,7128}}, {0,1,{7130,7130,7130,7130}}, {0,1,{7132,7132,7132,7132}}, {0,1,{7134,7134,7134,7134}},
+  {0,1,{7136,7136,7136,7136}}, {0,1,{7138,7138,7138,7138}}, {0,1,{7140,7140,7140,7140}}, {0,1,{7142,7142,7142,7142}},
+  {0,1,{7144,7144,7144,7144}}, {0,1,{7146,7146,7146,7146}}, {0,1,{7148,7148,7148,7148}}, {0,1,{7150,7150,7150,7150}},
+  {0,1,{7152,7152,7152,7152}}, {0,1,{7154,7154,7154,7154}}, {0,1,{7156,7156,7156,7156}}, {0,1,{7158,7158,7158,7158}},
+  {0,1,{7160,7160,7160,7160}}, {0,1,{7162,7162,7162,7162}}, {0,1,{7164,7164,7164,7164}}, {0,1,{7166,7166,7166,7166}},
+  {0,1,{7168,7168,7168,7168}}, {0,1,{7170,7170,7170,7170}}, {0,1,{7172,7172,7172,7172}}, {0,1,{7174,7174,7174,7174}},
+  {0,1,{7176,7176,7176,7176}}, {0,1,{7178,7178,7178,7178}}, {0,1,{7180,7180,7180,7180}}, {0,1,{7182,7182,7182,7182}},
+  {0,1,{7184,7184,7184,7184}}, {0,1,{7186,7186,7186,7186}}, {0,1,{7188,7188,7188,7188}}, {0,1,{7190,7190,7190,7190}},
+  {0,1,{7192,7192,7192,7192}}, {0,1,{7194,7194,7194,7194}}, {0,1,{7196,7196,7196,7196}}, {0,1,{7198,7198,7198,7198}},
+  {0,1,{7200,7200,7200,7200}}, {0,1,{5255,5255,5255,5255}}, {0,1,{7202,7202,7202,7202}}, {0,1,{7204,7204,7204,7204}},
+  {0,1,{7206,7206,7206,7206}}, {0,1,{7208,7208,7208,7208}}, {0,1,{7210,7210,7210,7210}}, {0,1,{7212,7212,7212,7212}},
+  {0,1,{7214,7214,7214,7214}}, {0,1,{7216,7216,7216,7216}}, {0,1,{7218,7218,7218,7218}}, {0,1,{7220,7220,7220,7220}},
+  {0,1,{7222,7222,7222,7222}}, {0,1,{7224,7224,7224,7224}}, {0,1,{7226,7226,7226,7226}}, {0,1,{7228,7228,7228,7228}},
+  {0,1,{7230,7230,7230,7230}}, {0,1,{7232,7232,7232,7232}}, {0,1,{7234,7234,7234,7234}}, {0,1,{7236,7236,7236,7236}},
+  {0,1,{7238,7238,7238,7238}}, {0,1,{7240,7240,7240,7240}}, {0,1,{7242,7242,7242,7242}}, {0,1,{7244,7244,7244,7244}},
+  {0,1,{7246,7246,7246,7246}}, {0,1,{7248,7248,7248,7248}}, {0,1,{7250,7250,7250,7250}}, {0,1,{7252,7252,7252,7252}},
+  {0,1,{7254,7254,7254,7254}}, {0,1,{7256,7256,7256,7256}}, {0,1,{7258,7258,7258,7258}}, {0,1,{7260,7260,7260,7260}},
+  {0,1,{7262,7262,7262,7262}}, {0,1,{7264,7264,7264,7264}}, {0,1,{7266,7266,7266,7266}}, {0,1,{7268,7268,7268,7268}},
+  {0,1,{7270,7270,7270,7270}}, {0,1,{7272,7272,7272,7272}}, {0,1,{7274,7274,7274,7274}}, {0,1,{7276,7276,7276,7276}},
+  {0,1,{7278,7278,7278,7278}}, {0,1,{7280,7280,7280,7280}}, {0,1,{7282,7282,7282,7282}}, {0,1,{7284,7284,7284,7284}},
+  {0,1,{7286,7286,7286,7286}}, {0,1,{7288,7288,7288,7288}}, {0,1,{7290,7290,7290,7290}}, {0,1,{7292,7292,7292,7292}},
+  {0,1,{7294,7294,7294,7294}}, {0,1,{7296,7296,7296,7296}}, {0,1,{7298,7298,7298,7298}}, {0,1,{7300,7300,7300,7300}},
+  {0,1,{7302,7302,7302,7302}}, {0,1,{7304,7304,7304,7304}}, {0,1,{7306,7306,7306,7306}}, {0,1,{7308,7308,7308,7308}},
+  {0,1,{7310,7310,7310,7310}}, {0,1,{7312,7312,7312,7312}}, {0,1,{7314,7314,7314,7314}}, {0,1,{7316,7316,7316,7316}},
+  {0,1,{7318,7318,7318,7318}}, {0,1,{7320,7320,7320,7320}}, {0,1,{7322,7322,7322,7322}}, {0,1,{7324,7324,7324,7324}},
+  {0,1,{7326,7326,7326,7326}}, {0,1,{7328,7328,7328,7328}}, {0,1,{7330,7330,7330,7330}}, {0,1,{7332,7332,7332,7332}},
+  {0,1,{7334,7334,7334,7334}}, {0,1,{7336,7336,7336,7336}}, {0,1,{7338,7338,7338,7338}}, {0,1,{7340,7340,7340,7340}},
+  {0,1,{7342,7342,7342,7342}}, {0,1,{7344,7344,7344,7344}}, {0,1,{7346,7346,7346,7346}}, {0,1,{7348,7348,7348,7348}},
+  {0,1,{7350,7350,7350,7350}}, {0,1,{7352,7352,7352,7352}}, {0,1,{7354,7354,7354,7354}}, {0,1,{7356,7356,7356,7356}},
+  {0,1,{7358,7358,7358,7358}}, {0,1,{7360,7360,7360,7360}}, {0,1,{7362,7362,7362,7362}}, {0,1,{7364,7364,7364,7364}},
+  {0,1,{7366,7366,7366,7366}}, {0,1,{7368,7368,7368,7368}}, {0,1,{7370,7370,7370,7370}}, {0,1,{7372,7372,7372,7372}},
+  {0,1,{7374,7374,7374,7374}}, {0,1,{7376,7376,7376,7376}}, {0,1,{7378,7378,7378,7378}}, {0,1,{7380,7380,7380,7380}},
+  {0,1,{7382,7382,7382,7382}}, {0,1,{7384,7384,7384,7384}}, {0,1,{7386,7386,7386,7386}}, {0,1,{7388,7388,7388,7388}},
+  {0,1,{7390,7390,7390,7390}}, {0,1,{7392,7392,7392,7392}}, {0,1,{7394,7394,7394,7394}}, {0,1,{7396,7396,7396,7396}},
+  {0,1,{7398,7398,7398,7398}}, {0,1,{7400,7400,7400,7400}}, {0,1,{7402,7402,7402,7402}}, {0,1,{7404,7404,7404,7404}},
+  {0,1,{7406,7406,7406,7406}}, {0,1,{7408,7408,7408,7408}}, {0,1,{7410,7410,7410,7410}}, {0,1,{7412,7412,7412,7412}},
+  {0,1,{7414,7414,7414,7414}}, {0,1,{7416,7416,7416,7416}}, {0,1,{7418,7418,7418,7418}}, {0,1,{5281,5281,5281,5281}},
+  {0,1,{7420,7420,7420,7420}}, {0,1,{7422,7422,7422,7422}}, {0,1,{7424,7424,7424,7424}}, {0,1,{7426,7426,7426,7426}},
+  {0,1,{5289,5289,5289,5289}}, {0,1,{7428,7428,7428,7428}}, {0,1,{7430,7430,7430,7430}}, {0,1,{7432,7432,7432,7432}},
+  {0,1,{7434,7434,7434,7434}}, {0,1,{7436,7436,7436,7436}}, {0,1,{7438,7438,7438,7438}}, {0,1,{7440,7440,7440,7440}},
+  {0,1,{7442,7442,7442,7442}}, {0,1,{7444,7444,7444,7444}}, {0,1,{7446,7446,7446,7446}}, {0,1,{7448,7448,7448,7448}},
+  {0,1,{7450,7450,7450,7450}}, {0,1,{7452,7452,7452,7452}}, {0,1,{7454,7454,7454,7454}}, {0,1,{7456,7456,7456,7456}},
+  {0,1,{7458,7458,7458,7458}}, {0,1,{7460,7460,7460,7460}}, {0,1,{7462,7462,7462,7462}}, {0,1,{7464,7464,7464,7464}},
+  {0,1,{7466,7466,7466,7466}}, {0,1,{7468,7468,7468,7468}}, {0,1,{7470,7470,7470,7470}}, {0,1,{7472,7472,7472,7472}},
+  {0,1,{7474,7474,7474,7474}}, {0,1,{7476,7476,7476,7476}}, {0,1,{7478,7478,7478,7478}}, {0,1,{7480,7480,7480,7480}},
+  {0,1,{7482,7482,7482,7482}}, {0,1,{7484,7484,7484,7484}}, {0,1,{7486,7486,7486,7486}}, {0,1,{7488,7488,7488,7488}},
+  {0,1,{7490,7490,7490,7490}}, {0,1,{7492,7492,7492,7492}}, {0,1,{7494,7494,7494,7494}}, {0,1,{7496,7496,7496,7496}},
+  {0,1,{7498,7498,7498,7498}}, {0,1,{7500,7500,7500,7500}}, {0,1,{7502,7502,7502,7502}}, {0,1,{7504,7504,7504,7504}},
+  {0,1,{7506,7506,7506,7506}}, {0,1,{7508,7508,7508,7508}}, {0,1,{7510,7510,7510,7510}}, {0,1,{7512,7512,7512,7512}},
+  {0,1,{7514,7514,7514,7514}}, {0,1,{7516,7516,7516,7516}}, {0,1,{7518,7518,7518,7518}}, {0,1,{7520,7520,7520,7520}},
+  {0,1,{7522,7522,7522,7522}}, {0,1,{7524,7524,7524,7524}}, {0,1,{7526,7526,7526,7526}}, {0,1,{7528,7528,7528,7528}},
+  {0,1,{7530,7530,7530,7530}}, {0,1,{7532,7532,7532,7532}}, {0,1,{7534,7534,7534,7534}}, {0,1,{7536,7536,7536,7536}},
+  {0,1,{7538,7538,7538,7538}}, {0,1,{7540,7540,7540,7540}}, {0,1,{7542,7542,7542,7542}}, {0,1,{7544,7544,7544,7544}},
+  {0,1,{7546,7546,7546,7546}}, {0,1,{7548,7548,7548,7548}}, {0,1,{7550,7550,7550,7550}}, {0,1,{7552,7552,7552,7552}},
+  {0,1,{7554,7554,7554,7554}}, {0,1,{7556,7556,7556,7556}}, {0,1,{7558,7558,7558,7558}}, {0,1,{7560,7560,7560,7560}},
+  {0,1,{7562,7562,7562,7562}}, {0,1,{7564,7564,7564,7564}}, {0,1,{7566,7566,7566,7566}}, {0,1,{7568,7568,7568,7568}},
+  {0,1,{7570,7570,7570,7570}}, {0,1,{7572,7572,7572,7572}}, {0,1,{7574,7574,7574,7574}}, {0,1,{7576,7576,7576,7576}},
+  {0,1,{7578,7578,7578,7578}}, {0,1,{7580,7580,7580,7580}}, {0,1,{7582,7582,7582,7582}}, {0,1,{7584,7584,7584,7584}},
+  {0,1,{7586,7586,7586,7586}}, {0,1,{7588,7588,7588,7588}}, {0,1,{7590,7590,7590,7590}}, {0,1,{7592,7592,7592,7592}},
+  {0,1,{7594,7594,7594,7594}}, {0,1,{7596,7596,7596,7596}}, {0,1,{7598,7598,7598,7598}}, {0,1,{7600,7600,7600,7600}},
+  {0,1,{7602,7602,7602,7602}}, {0,1,{7604,7604,7604,7604}}, {0,1,{7606,7606,7606,7606}}, {0,1,{7608,7608,7608,7608}},
+  {0,1,{7610,7610,7610,7610}}, {0,1,{7612,7612,7612,7612}}, {0,1,{7614,7614,7614,7614}}, {0,1,{7616,7616,7616,7616}},
+  {0,1,{7618,7618,7618,7618}}, {0,1,{7620,7620,7620,7620}}, {0,1,{7622,7622,7622,7622}}, {0,1,{0,7624,7624,7624}},
+  {0,1,{0,7627,7627,7627}}, {0,1,{0,7630,7630,7630}}, {0,1,{0,7633,7633,7633}}, {0,1,{0,7637,7637,7637}},
+  {0,1,{0,7641,7641,7641}}, {26,0,{0,0,0,0}}, {0,1,{0,7644,0,7644}}, {0,1,{0,7646,0,7646}},
+  {0,1,{0,7648,0,7648}}, {0,1,{0,7650,0,7650}}, {0,1,{0,7652,0,7652}}, {0,1,{0,7654,0,7654}},
+  {0,1,{0,7656,0,7656}}, {0,1,{0,7658,0,7658}}, {0,1,{0,7660,0,7660}}, {0,1,{0,7662,0,7662}},
+  {0,1,{0,7664,0,7664}}, {0,1,{0,4079,0,4079}}, {0,1,{0,4081,0,4081}}, {0,1,{0,7666,0,7666}},
+  {0,1,{0,7668,0,7668}}, {0,1,{0,7670,0,7670}}, {0,1,{0,7672,0,7672}}, {0,1,{0,7674,0,7674}},
+  {0,1,{0,7676,0,7676}}, {0,1,{0,7678,0,7678}}, {0,1,{0,7680,0,7680}}, {0,1,{0,7682,0,7682}},
+  {0,1,{0,7684,0,7684}}, {0,1,{0,7686,0,7686}}, {0,1,{0,7688,0,7688}}, {0,1,{0,7690,0,7690}},
+  {0,1,{0,7692,0,7692}}, {0,1,{0,7694,0,7694}}, {0,1,{0,7696,0,7696}}, {0,1,{0,7698,0,7698}},
+  {0,1,{0,7700,0,7700}}, {0,1,{0,1115,0,1115}}, {0,1,{0,7702,0,7702}}, {0,1,{0,7704,0,7704}},
+  {0,1,{0,7706,0,7706}}, {0,1,{0,7708,0,7708}}, {0,1,{0,1688,7710,1}}, {0,1,{0,1692,7712,3}},
+  {0,1,{0,3712,7714,5}}, {0,1,{0,1694,7716,7}}, {0,1,{0,1696,7718,9}}, {0,1,{0,3749,7720,11}},
+  {0,1,{0,1700,7722,13}}, {0,1,{0,1702,7724,15}}, {0,1,{0,1704,7726,17}}, {0,1,{0,1706,7728,19}},
+  {0,1,{0,1708,7730,21}}, {0,1,{0,1710,7732,23}}, {0,1,{0,1712,7734,25}}, {0,1,{0,1714,7736,27}},
+  {0,1,{0,1716,7738,29}}, {0,1,{0,1720,7740,31}}, {0,1,{0,3733,7742,33}}, {0,1,{0,1722,7744,35}},
+  {0,1,{0,4418,7746,37}}, {0,1,{0,1724,7748,39}}, {0,1,{0,1726,7750,41}}, {0,1,{0,3855,7752,43}},
+  {0,1,{0,1728,7754,45}}, {0,1,{0,3897,7756,47}}, {0,1,{0,4432,7758,49}}, {0,1,{0,3745,7760,51}},
+  {0,1,{0,7762,0,7762}}, {0,1,{0,7764,0,7764}}, {0,1,{0,3576,0,3576}}, {0,1,{0,7766,0,7766}},
+  {0,1,{0,7768,0,7768}}, {0,1,{0,7770,0,7770}}, {0,1,{0,7772,0,7772}}, {0,1,{0,7774,0,7774}},
+  {0,1,{0,7776,0,7776}}, {0,1,{0,7778,0,7778}}, {0,1,{0,7780,0,7780}}, {0,1,{0,7782,0,7782}},
+  {0,1,{0,7784,0,7784}}, {0,1,{0,7786,0,7786}}, {0,1,{0,7788,0,7788}}, {0,1,{0,7790,0,7790}},
+  {0,1,{0,7792,0,7792}}, {0,1,{0,7794,0,7794}}, {0,1,{0,7796,0,7796}}, {0,1,{0,7798,0,7798}},
+  {0,1,{0,7800,0,7800}}, {0,1,{0,7802,0,7802}}, {0,1,{0,7804,0,7804}}, {0,1,{0,7806,0,7806}},
+  {0,1,{0,7808,0,7808}}, {0,1,{0,7810,0,7810}}, {0,1,{0,7812,0,7812}}, {0,1,{0,7814,0,7814}},
+  {0,1,{0,7816,0,7816}}, {0,1,{0,7818,0,7818}}, {0,1,{0,7820,0,7820}}
+};
+
+static const unsigned short ftnormtab_maps[7822] = {
+  0x0000, 0x0001, 0x0061, 0x0001, 0x0062, 0x0001, 0x0063, 0x0001, 0x0064, 0x0001, 0x0065, 0x0001,
+  0x0066, 0x0001, 0x0067, 0x0001, 0x0068, 0x0001, 0x0069, 0x0001, 0x006A, 0x0001, 0x006B, 0x0001,
+  0x006C, 0x0001, 0x006D, 0x0001, 0x006E, 0x0001, 0x006F, 0x0001, 0x0070, 0x0001, 0x0071, 0x0001,
+  0x0072, 0x0001, 0x0073, 0x0001, 0x0074, 0x0001, 0x0075, 0x0001, 0x0076, 0x0001, 0x0077, 0x0001,
+  0x0078, 0x0001, 0x0079, 0x0001, 0x007A, 0x0001, 0x0020, 0x0002, 0x0020, 0x0308, 0x0002, 0x0020,
+  0x0304, 0x0001, 0x0032, 0x0001, 0x0033, 0x0002, 0x0020, 0x0301, 0x0001, 0x03BC, 0x0002, 0x0020,
+  0x0327, 0x0001, 0x0031, 0x0003, 0x0031, 0x2044, 0x0034, 0x0003, 0x0031, 0x2044, 0x0032, 0x0003,
+  0x0033, 0x2044, 0x0034, 0x0002, 0x0041, 0x0300, 0x0002, 0x0061, 0x0300, 0x0002, 0x0041, 0x0301,
+  0x0002, 0x0061, 0x0301, 0x0002, 0x0041, 0x0302, 0x0002, 0x0061, 0x0302, 0x0002, 0x0041, 0x0303,
+  0x0002, 0x0061, 0x0303, 0x0002, 0x0041, 0x0308, 0x0002, 0x0061, 0x0308, 0x0002, 0x0041, 0x030A,
+  0x0002, 0x0061, 0x030A, 0x0001, 0x00E6, 0x0002, 0x0043, 0x0327, 0x0002, 0x0063, 0x0327, 0x0002,
+  0x0045, 0x0300, 0x0002, 0x0065, 0x0300, 0x0002, 0x0045, 0x0301, 0x0002, 0x0065, 0x0301, 0x0002,
+  0x0045, 0x0302, 0x0002, 0x0065, 0x0302, 0x0002, 0x0045, 0x0308, 0x0002, 0x0065, 0x0308, 0x0002,
+  0x0049, 0x0300, 0x0002, 0x0069, 0x0300, 0x0002, 0x0049, 0x0301, 0x0002, 0x0069, 0x0301, 0x0002,
+  0x0049, 0x0302, 0x0002, 0x0069, 0x0302, 0x0002, 0x0049, 0x0308, 0x0002, 0x0069, 0x0308, 0x0001,
+  0x00F0, 0x0002, 0x004E, 0x0303, 0x0002, 0x006E, 0x0303, 0x0002, 0x004F, 0x0300, 0x0002, 0x006F,
+  0x0300, 0x0002, 0x004F, 0x0301, 0x0002, 0x006F, 0x0301, 0x0002, 0x004F, 0x0302, 0x0002, 0x006F,
+  0x0302, 0x0002, 0x004F, 0x0303, 0x0002, 0x006F, 0x0303, 0x0002, 0x004F, 0x0308, 0x0002, 0x006F,
+  0x0308, 0x0001, 0x00F8, 0x0002, 0x0055, 0x0300, 0x0002, 0x0075, 0x0300, 0x0002, 0x0055, 0x0301,
+  0x0002, 0x0075, 0x0301, 0x0002, 0x0055, 0x0302, 0x0002, 0x0075, 0x0302, 0x0002, 0x0055, 0x0308,
+  0x0002, 0x0075, 0x0308, 0x0002, 0x0059, 0x0301, 0x0002, 0x0079, 0x0301, 0x0001, 0x00FE, 0x0002,
+  0x0073, 0x0073, 0x0002, 0x0079, 0x0308, 0x0002, 0x0041, 0x0304, 0x0002, 0x0061, 0x0304, 0x0002,
+  0x0041, 0x0306, 0x0002, 0x0061, 0x0306, 0x0002, 0x0041, 0x0328, 0x0002, 0x0061, 0x0328, 0x0002,
+  0x0043, 0x0301, 0x0002, 0x0063, 0x0301, 0x0002, 0x0043, 0x0302, 0x0002, 0x0063, 0x0302, 0x0002,
+  0x0043, 0x0307, 0x0002, 0x0063, 0x0307, 0x0002, 0x0043, 0x030C, 0x0002, 0x0063, 0x030C, 0x0002,
+  0x0044, 0x030C, 0x0002, 0x0064, 0x030C, 0x0001, 0x0111, 0x0002, 0x0045, 0x0304, 0x0002, 0x0065,
+  0x0304, 0x0002, 0x0045, 0x0306, 0x0002, 0x0065, 0x0306, 0x0002, 0x0045, 0x0307, 0x0002, 0x0065,
+  0x0307, 0x0002, 0x0045, 0x0328, 0x0002, 0x0065, 0x0328, 0x0002, 0x0045, 0x030C, 0x0002, 0x0065,
+  0x030C, 0x0002, 0x0047, 0x0302, 0x0002, 0x0067, 0x0302, 0x0002, 0x0047, 0x0306, 0x0002, 0x0067,
+  0x0306, 0x0002, 0x0047, 0x0307, 0x0002, 0x0067, 0x0307, 0x0002, 0x0047, 0x0327, 0x0002, 0x0067,
+  0x0327, 0x0002, 0x0048, 0x0302, 0x0002, 0x0068, 0x0302, 0x0001, 0x0127, 0x0002, 0x0049, 0x0303,
+  0x0002, 0x0069, 0x0303, 0x0002, 0x0049, 0x0304, 0x0002, 0x0069, 0x0304, 0x0002, 0x0049, 0x0306,
+  0x0002, 0x0069, 0x0306, 0x0002, 0x0049, 0x0328, 0x0002, 0x0069, 0x0328, 0x0002, 0x0049, 0x0307,
+  0x0002, 0x0069, 0x0307, 0x0002, 0x0049, 0x004A, 0x0001, 0x0133, 0x0002, 0x0069, 0x006A, 0x0002,
+  0x004A, 0x0302, 0x0002, 0x006A, 0x0302, 0x0002, 0x004B, 0x0327, 0x0002, 0x006B, 0x0327, 0x0002,
+  0x004C, 0x0301, 0x0002, 0x006C, 0x0301, 0x0002, 0x004C, 0x0327, 0x0002, 0x006C, 0x0327, 0x0002,
+  0x004C, 0x030C, 0x0002, 0x006C, 0x030C, 0x0002, 0x004C, 0x00B7, 0x0001, 0x0140, 0x0002, 0x006C,
+  0x00B7, 0x0001, 0x0142, 0x0002, 0x004E, 0x0301, 0x0002, 0x006E, 0x0301, 0x0002, 0x004E, 0x0327,
+  0x0002, 0x006E, 0x0327, 0x0002, 0x004E, 0x030C, 0x0002, 0x006E, 0x030C, 0x0002, 0x02BC, 0x006E,
+  0x0001, 0x014B, 0x0002, 0x004F, 0x0304, 0x0002, 0x006F, 0x0304, 0x0002, 0x004F, 0x0306, 0x0002,
+  0x006F, 0x0306, 0x0002, 0x004F, 0x030B, 0x0002, 0x006F, 0x030B, 0x0001, 0x0153, 0x0002, 0x0052,
+  0x0301, 0x0002, 0x0072, 0x0301, 0x0002, 0x0052, 0x0327, 0x0002, 0x0072, 0x0327, 0x0002, 0x0052,
+  0x030C, 0x0002, 0x0072, 0x030C, 0x0002, 0x0053, 0x0301, 0x0002, 0x0073, 0x0301, 0x0002, 0x0053,
+  0x0302, 0x0002, 0x0073, 0x0302, 0x0002, 0x0053, 0x0327, 0x0002, 0x0073, 0x0327, 0x0002, 0x0053,
+  0x030C, 0x0002, 0x0073, 0x030C, 0x0002, 0x0054, 0x0327, 0x0002, 0x0074, 0x0327, 0x0002, 0x0054,
+  0x030C, 0x0002, 0x0074, 0x030C, 0x0001, 0x0167, 0x0002, 0x0055, 0x0303, 0x0002, 0x0075, 0x0303,
+  0x0002, 0x0055, 0x0304, 0x0002, 0x0075, 0x0304, 0x0002, 0x0055, 0x0306, 0x0002, 0x0075, 0x0306,
+  0x0002, 0x0055, 0x030A, 0x0002, 0x0075, 0x030A, 0x0002, 0x0055, 0x030B, 0x0002, 0x0075, 0x030B,
+  0x0002, 0x0055, 0x0328, 0x0002, 0x0075, 0x0328, 0x0002, 0x0057, 0x0302, 0x0002, 0x0077, 0x0302,
+  0x0002, 0x0059, 0x0302, 0x0002, 0x0079, 0x0302, 0x0002, 0x0059, 0x0308, 0x0002, 0x005A, 0x0301,
+  0x0002, 0x007A, 0x0301, 0x0002, 0x005A, 0x0307, 0x0002, 0x007A, 0x0307, 0x0002, 0x005A, 0x030C,
+  0x0002, 0x007A, 0x030C, 0x0001, 0x0253, 0x0001, 0x0183, 0x0001, 0x0185, 0x0001, 0x0254, 0x0001,
+  0x0188, 0x0001, 0x0256, 0x0001, 0x0257, 0x0001, 0x018C, 0x0001, 0x01DD, 0x0001, 0x0259, 0x0001,
+  0x025B, 0x0001, 0x0192, 0x0001, 0x0260, 0x0001, 0x0263, 0x0001, 0x0269, 0x0001, 0x0268, 0x0001,
+  0x0199, 0x0001, 0x026F, 0x0001, 0x0272, 0x0001, 0x0275, 0x0002, 0x004F, 0x031B, 0x0002, 0x006F,
+  0x031B, 0x0001, 0x01A3, 0x0001, 0x01A5, 0x0001, 0x0280, 0x0001, 0x01A8, 0x0001, 0x0283, 0x0001,
+  0x01AD, 0x0001, 0x0288, 0x0002, 0x0055, 0x031B, 0x0002, 0x0075, 0x031B, 0x0001, 0x028A, 0x0001,
+  0x028B, 0x0001, 0x01B4, 0x0001, 0x01B6, 0x0001, 0x0292, 0x0001, 0x01B9, 0x0001, 0x01BD, 0x0003,
+  0x0044, 0x005A, 0x030C, 0x0001, 0x01C6, 0x0003, 0x0064, 0x007A, 0x030C, 0x0003, 0x0044, 0x007A,
+  0x030C, 0x0002, 0x004C, 0x004A, 0x0001, 0x01C9, 0x0002, 0x006C, 0x006A, 0x0002, 0x004C, 0x006A,
+  0x0002, 0x004E, 0x004A, 0x0001, 0x01CC, 0x0002, 0x006E, 0x006A, 0x0002, 0x004E, 0x006A, 0x0002,
+  0x0041, 0x030C, 0x0002, 0x0061, 0x030C, 0x0002, 0x0049, 0x030C, 0x0002, 0x0069, 0x030C, 0x0002,
+  0x004F, 0x030C, 0x0002, 0x006F, 0x030C, 0x0002, 0x0055, 0x030C, 0x0002, 0x0075, 0x030C, 0x0003,
+  0x0055, 0x0308, 0x0304, 0x0003, 0x0075, 0x0308, 0x0304, 0x0003, 0x0055, 0x0308, 0x0301, 0x0003,
+  0x0075, 0x0308, 0x0301, 0x0003, 0x0055, 0x0308, 0x030C, 0x0003, 0x0075, 0x0308, 0x030C, 0x0003,
+  0x0055, 0x0308, 0x0300, 0x0003, 0x0075, 0x0308, 0x0300, 0x0003, 0x0041, 0x0308, 0x0304, 0x0003,
+  0x0061, 0x0308, 0x0304, 0x0003, 0x0041, 0x0307, 0x0304, 0x0003, 0x0061, 0x0307, 0x0304, 0x0002,
+  0x00C6, 0x0304, 0x0002, 0x00E6, 0x0304, 0x0001, 0x01E5, 0x0002, 0x0047, 0x030C, 0x0002, 0x0067,
+  0x030C, 0x0002, 0x004B, 0x030C, 0x0002, 0x006B, 0x030C, 0x0002, 0x004F, 0x0328, 0x0002, 0x006F,
+  0x0328, 0x0003, 0x004F, 0x0328, 0x0304, 0x0003, 0x006F, 0x0328, 0x0304, 0x0002, 0x01B7, 0x030C,
+  0x0002, 0x0292, 0x030C, 0x0002, 0x006A, 0x030C, 0x0002, 0x0044, 0x005A, 0x0001, 0x01F3, 0x0002,
+  0x0064, 0x007A, 0x0002, 0x0044, 0x007A, 0x0002, 0x0047, 0x0301, 0x0002, 0x0067, 0x0301, 0x0001,
+  0x0195, 0x0001, 0x01BF, 0x0002, 0x004E, 0x0300, 0x0002, 0x006E, 0x0300, 0x0003, 0x0041, 0x030A,
+  0x0301, 0x0003, 0x0061, 0x030A, 0x0301, 0x0002, 0x00C6, 0x0301, 0x0002, 0x00E6, 0x0301, 0x0002,
+  0x00D8, 0x0301, 0x0002, 0x00F8, 0x0301, 0x0002, 0x0041, 0x030F, 0x0002, 0x0061, 0x030F, 0x0002,
+  0x0041, 0x0311, 0x0002, 0x0061, 0x0311, 0x0002, 0x0045, 0x030F, 0x0002, 0x0065, 0x030F, 0x0002,
+  0x0045, 0x0311, 0x0002, 0x0065, 0x0311, 0x0002, 0x0049, 0x030F, 0x0002, 0x0069, 0x030F, 0x0002,
+  0x0049, 0x0311, 0x0002, 0x0069, 0x0311, 0x0002, 0x004F, 0x030F, 0x0002, 0x006F, 0x030F, 0x0002,
+  0x004F, 0x0311, 0x0002, 0x006F, 0x0311, 0x0002, 0x0052, 0x030F, 0x0002, 0x0072, 0x030F, 0x0002,
+  0x0052, 0x0311, 0x0002, 0x0072, 0x0311, 0x0002, 0x0055, 0x030F, 0x0002, 0x0075, 0x030F, 0x0002,
+  0x0055, 0x0311, 0x0002, 0x0075, 0x0311, 0x0002, 0x0053, 0x0326, 0x0002, 0x0073, 0x0326, 0x0002,
+  0x0054, 0x0326, 0x0002, 0x0074, 0x0326, 0x0001, 0x021D, 0x0002, 0x0048, 0x030C, 0x0002, 0x0068,
+  0x030C, 0x0001, 0x019E, 0x0001, 0x0223, 0x0001, 0x0225, 0x0002, 0x0041, 0x0307, 0x0002, 0x0061,
+  0x0307, 0x0002, 0x0045, 0x0327, 0x0002, 0x0065, 0x0327, 0x0003, 0x004F, 0x0308, 0x0304, 0x0003,
+  0x006F, 0x0308, 0x0304, 0x0003, 0x004F, 0x0303, 0x0304, 0x0003, 0x006F, 0x0303, 0x0304, 0x0002,
+  0x004F, 0x0307, 0x0002, 0x006F, 0x0307, 0x0003, 0x004F, 0x0307, 0x0304, 0x0003, 0x006F, 0x0307,
+  0x0304, 0x0002, 0x0059, 0x0304, 0x0002, 0x0079, 0x0304, 0x0001, 0x2C65, 0x0001, 0x023C, 0x0001,
+  0x019A, 0x0001, 0x2C66, 0x0001, 0x0242, 0x0001, 0x0180, 0x0001, 0x0289, 0x0001, 0x028C, 0x0001,
+  0x0247, 0x0001, 0x0249, 0x0001, 0x024B, 0x0001, 0x024D, 0x0001, 0x024F, 0x0001, 0x0266, 0x0001,
+  0x0279, 0x0001, 0x027B, 0x0001, 0x0281, 0x0002, 0x0020, 0x0306, 0x0002, 0x0020, 0x0307, 0x0002,
+  0x0020, 0x030A, 0x0002, 0x0020, 0x0328, 0x0002, 0x0020, 0x0303, 0x0002, 0x0020, 0x030B, 0x0001,
+  0x0295, 0x0001, 0x0300, 0x0001, 0x0301, 0x0001, 0x0313, 0x0002, 0x0308, 0x0301, 0x0001, 0x03B9,
+  0x0001, 0x0371, 0x0001, 0x0373, 0x0001, 0x02B9, 0x0001, 0x0377, 0x0002, 0x0020, 0x0345, 0x0001,
+  0x003B, 0x0001, 0x03F3, 0x0002, 0x00A8, 0x0301, 0x0003, 0x0020, 0x0308, 0x0301, 0x0002, 0x0391,
+  0x0301, 0x0002, 0x03B1, 0x0301, 0x0001, 0x00B7, 0x0002, 0x0395, 0x0301, 0x0002, 0x03B5, 0x0301,
+  0x0002, 0x0397, 0x0301, 0x0002, 0x03B7, 0x0301, 0x0002, 0x0399, 0x0301, 0x0002, 0x03B9, 0x0301,
+  0x0002, 0x039F, 0x0301, 0x0002, 0x03BF, 0x0301, 0x0002, 0x03A5, 0x0301, 0x0002, 0x03C5, 0x0301,
+  0x0002, 0x03A9, 0x0301, 0x0002, 0x03C9, 0x0301, 0x0003, 0x03B9, 0x0308, 0x0301, 0x0001, 0x03B1,
+  0x0001, 0x03B2, 0x0001, 0x03B3, 0x0001, 0x03B4, 0x0001, 0x03B5, 0x0001, 0x03B6, 0x0001, 0x03B7,
+  0x0001, 0x03B8, 0x0001, 0x03BA, 0x0001, 0x03BB, 0x0001, 0x03BD, 0x0001, 0x03BE, 0x0001, 0x03BF,
+  0x0001, 0x03C0, 0x0001, 0x03C1, 0x0001, 0x03C3, 0x0001, 0x03C4, 0x0001, 0x03C5, 0x0001, 0x03C6,
+  0x0001, 0x03C7, 0x0001, 0x03C8, 0x0001, 0x03C9, 0x0002, 0x0399, 0x0308, 0x0002, 0x03B9, 0x0308,
+  0x0002, 0x03A5, 0x0308, 0x0002, 0x03C5, 0x0308, 0x0003, 0x03C5, 0x0308, 0x0301, 0x0001, 0x03D7,
+  0x0001, 0x03A5, 0x0002, 0x03D2, 0x0301, 0x0002, 0x03D2, 0x0308, 0x0001, 0x03D9, 0x0001, 0x03DB,
+  0x0001, 0x03DD, 0x0001, 0x03DF, 0x0001, 0x03E1, 0x0001, 0x03E3, 0x0001, 0x03E5, 0x0001, 0x03E7,
+  0x0001, 0x03E9, 0x0001, 0x03EB, 0x0001, 0x03ED, 0x0001, 0x03EF, 0x0001, 0x03C2, 0x0001, 0x0398,
+  0x0001, 0x03F8, 0x0001, 0x03A3, 0x0001, 0x03F2, 0x0001, 0x03FB, 0x0001, 0x037B, 0x0001, 0x037C,
+  0x0001, 0x037D, 0x0002, 0x0415, 0x0300, 0x0002, 0x0435, 0x0300, 0x0002, 0x0415, 0x0308, 0x0002,
+  0x0435, 0x0308, 0x0001, 0x0452, 0x0002, 0x0413, 0x0301, 0x0002, 0x0433, 0x0301, 0x0001, 0x0454,
+  0x0001, 0x0455, 0x0001, 0x0456, 0x0002, 0x0406, 0x0308, 0x0002, 0x0456, 0x0308, 0x0001, 0x0458,
+  0x0001, 0x0459, 0x0001, 0x045A, 0x0001, 0x045B, 0x0002, 0x041A, 0x0301, 0x0002, 0x043A, 0x0301,
+  0x0002, 0x0418, 0x0300, 0x0002, 0x0438, 0x0300, 0x0002, 0x0423, 0x0306, 0x0002, 0x0443, 0x0306,
+  0x0001, 0x045F, 0x0001, 0x0430, 0x0001, 0x0431, 0x0001, 0x0432, 0x0001, 0x0433, 0x0001, 0x0434,
+  0x0001, 0x0435, 0x0001, 0x0436, 0x0001, 0x0437, 0x0001, 0x0438, 0x0002, 0x0418, 0x0306, 0x0002,
+  0x0438, 0x0306, 0x0001, 0x043A, 0x0001, 0x043B, 0x0001, 0x043C, 0x0001, 0x043D, 0x0001, 0x043E,
+  0x0001, 0x043F, 0x0001, 0x0440, 0x0001, 0x0441, 0x0001, 0x0442, 0x0001, 0x0443, 0x0001, 0x0444,
+  0x0001, 0x0445, 0x0001, 0x0446, 0x0001, 0x0447, 0x0001, 0x0448, 0x0001, 0x0449, 0x0001, 0x044A,
+  0x0001, 0x044B, 0x0001, 0x044C, 0x0001, 0x044D, 0x0001, 0x044E, 0x0001, 0x044F, 0x0001, 0x0461,
+  0x0001, 0x0463, 0x0001, 0x0465, 0x0001, 0x0467, 0x0001, 0x0469, 0x0001, 0x046B, 0x0001, 0x046D,
+  0x0001, 0x046F, 0x0001, 0x0471, 0x0001, 0x0473, 0x0001, 0x0475, 0x0002, 0x0474, 0x030F, 0x0002,
+  0x0475, 0x030F, 0x0001, 0x0479, 0x0001, 0x047B, 0x0001, 0x047D, 0x0001, 0x047F, 0x0001, 0x0481,
+  0x0001, 0x048B, 0x0001, 0x048D, 0x0001, 0x048F, 0x0001, 0x0491, 0x0001, 0x0493, 0x0001, 0x0495,
+  0x0001, 0x0497, 0x0001, 0x0499, 0x0001, 0x049B, 0x0001, 0x049D, 0x0001, 0x049F, 0x0001, 0x04A1,
+  0x0001, 0x04A3, 0x0001, 0x04A5, 0x0001, 0x04A7, 0x0001, 0x04A9, 0x0001, 0x04AB, 0x0001, 0x04AD,
+  0x0001, 0x04AF, 0x0001, 0x04B1, 0x0001, 0x04B3, 0x0001, 0x04B5, 0x0001, 0x04B7, 0x0001, 0x04B9,
+  0x0001, 0x04BB, 0x0001, 0x04BD, 0x0001, 0x04BF, 0x0001, 0x04CF, 0x0002, 0x0416, 0x0306, 0x0002,
+  0x0436, 0x0306, 0x0001, 0x04C4, 0x0001, 0x04C6, 0x0001, 0x04C8, 0x0001, 0x04CA, 0x0001, 0x04CC,
+  0x0001, 0x04CE, 0x0002, 0x0410, 0x0306, 0x0002, 0x0430, 0x0306, 0x0002, 0x0410, 0x0308, 0x0002,
+  0x0430, 0x0308, 0x0001, 0x04D5, 0x0002, 0x0415, 0x0306, 0x0002, 0x0435, 0x0306, 0x0001, 0x04D9,
+  0x0002, 0x04D8, 0x0308, 0x0002, 0x04D9, 0x0308, 0x0002, 0x0416, 0x0308, 0x0002, 0x0436, 0x0308,
+  0x0002, 0x0417, 0x0308, 0x0002, 0x0437, 0x0308, 0x0001, 0x04E1, 0x0002, 0x0418, 0x0304, 0x0002,
+  0x0438, 0x0304, 0x0002, 0x0418, 0x0308, 0x0002, 0x0438, 0x0308, 0x0002, 0x041E, 0x0308, 0x0002,
+  0x043E, 0x0308, 0x0001, 0x04E9, 0x0002, 0x04E8, 0x0308, 0x0002, 0x04E9, 0x0308, 0x0002, 0x042D,
+  0x0308, 0x0002, 0x044D, 0x0308, 0x0002, 0x0423, 0x0304, 0x0002, 0x0443, 0x0304, 0x0002, 0x0423,
+  0x0308, 0x0002, 0x0443, 0x0308, 0x0002, 0x0423, 0x030B, 0x0002, 0x0443, 0x030B, 0x0002, 0x0427,
+  0x0308, 0x0002, 0x0447, 0x0308, 0x0001, 0x04F7, 0x0002, 0x042B, 0x0308, 0x0002, 0x044B, 0x0308,
+  0x0001, 0x04FB, 0x0001, 0x04FD, 0x0001, 0x04FF, 0x0001, 0x0501, 0x0001, 0x0503, 0x0001, 0x0505,
+  0x0001, 0x0507, 0x0001, 0x0509, 0x0001, 0x050B, 0x0001, 0x050D, 0x0001, 0x050F, 0x0001, 0x0511,
+  0x0001, 0x0513, 0x0001, 0x0515, 0x0001, 0x0517, 0x0001, 0x0519, 0x0001, 0x051B, 0x0001, 0x051D,
+  0x0001, 0x051F, 0x0001, 0x0521, 0x0001, 0x0523, 0x0001, 0x0525, 0x0001, 0x0527, 0x0001, 0x0529,
+  0x0001, 0x052B, 0x0001, 0x052D, 0x0001, 0x052F, 0x0001, 0xA64B, 0x0001, 0x0041, 0x0001, 0x00C6,
+  0x0001, 0x0042, 0x0001, 0x0044, 0x0001, 0x0045, 0x0001, 0x018E, 0x0001, 0x0047, 0x0001, 0x0048,
+  0x0001, 0x0049, 0x0001, 0x004A, 0x0001, 0x004B, 0x0001, 0x004C, 0x0001, 0x004D, 0x0001, 0x004E,
+  0x0001, 0x004F, 0x0001, 0x0222, 0x0001, 0x0050, 0x0001, 0x0052, 0x0001, 0x0054, 0x0001, 0x0055,
+  0x0001, 0x0057, 0x0001, 0x0250, 0x0001, 0x0251, 0x0001, 0x1D02, 0x0001, 0x025C, 0x0001, 0x1D16,
+  0x0001, 0x1D17, 0x0001, 0x1D1D, 0x0001, 0x1D25, 0x0001, 0x0252, 0x0001, 0x0255, 0x0001, 0x025F,
+  0x0001, 0x0261, 0x0001, 0x0265, 0x0001, 0x026A, 0x0001, 0x1D7B, 0x0001, 0x029D, 0x0001, 0x026D,
+  0x0001, 0x1D85, 0x0001, 0x029F, 0x0001, 0x0271, 0x0001, 0x0270, 0x0001, 0x0273, 0x0001, 0x0274,
+  0x0001, 0x0278, 0x0001, 0x0282, 0x0001, 0x01AB, 0x0001, 0x1D1C, 0x0001, 0x0290, 0x0001, 0x0291,
+  0x0002, 0x0041, 0x0325, 0x0002, 0x0061, 0x0325, 0x0002, 0x0042, 0x0307, 0x0002, 0x0062, 0x0307,
+  0x0002, 0x0042, 0x0323, 0x0002, 0x0062, 0x0323, 0x0002, 0x0042, 0x0331, 0x0002, 0x0062, 0x0331,
+  0x0003, 0x0043, 0x0327, 0x0301, 0x0003, 0x0063, 0x0327, 0x0301, 0x0002, 0x0044, 0x0307, 0x0002,
+  0x0064, 0x0307, 0x0002, 0x0044, 0x0323, 0x0002, 0x0064, 0x0323, 0x0002, 0x0044, 0x0331, 0x0002,
+  0x0064, 0x0331, 0x0002, 0x0044, 0x0327, 0x0002, 0x0064, 0x0327, 0x0002, 0x0044, 0x032D, 0x0002,
+  0x0064, 0x032D, 0x0003, 0x0045, 0x0304, 0x0300, 0x0003, 0x0065, 0x0304, 0x0300, 0x0003, 0x0045,
+  0x0304, 0x0301, 0x0003, 0x0065, 0x0304, 0x0301, 0x0002, 0x0045, 0x032D, 0x0002, 0x0065, 0x032D,
+  0x0002, 0x0045, 0x0330, 0x0002, 0x0065, 0x0330, 0x0003, 0x0045, 0x0327, 0x0306, 0x0003, 0x0065,
+  0x0327, 0x0306, 0x0002, 0x0046, 0x0307, 0x0002, 0x0066, 0x0307, 0x0002, 0x0047, 0x0304, 0x0002,
+  0x0067, 0x0304, 0x0002, 0x0048, 0x0307, 0x0002, 0x0068, 0x0307, 0x0002, 0x0048, 0x0323, 0x0002,
+  0x0068, 0x0323, 0x0002, 0x0048, 0x0308, 0x0002, 0x0068, 0x0308, 0x0002, 0x0048, 0x0327, 0x0002,
+  0x0068, 0x0327, 0x0002, 0x0048, 0x032E, 0x0002, 0x0068, 0x032E, 0x0002, 0x0049, 0x0330, 0x0002,
+  0x0069, 0x0330, 0x0003, 0x0049, 0x0308, 0x0301, 0x0003, 0x0069, 0x0308, 0x0301, 0x0002, 0x004B,
+  0x0301, 0x0002, 0x006B, 0x0301, 0x0002, 0x004B, 0x0323, 0x0002, 0x006B, 0x0323, 0x0002, 0x004B,
+  0x0331, 0x0002, 0x006B, 0x0331, 0x0002, 0x004C, 0x0323, 0x0002, 0x006C, 0x0323, 0x0003, 0x004C,
+  0x0323, 0x0304, 0x0003, 0x006C, 0x0323, 0x0304, 0x0002, 0x004C, 0x0331, 0x0002, 0x006C, 0x0331,
+  0x0002, 0x004C, 0x032D, 0x0002, 0x006C, 0x032D, 0x0002, 0x004D, 0x0301, 0x0002, 0x006D, 0x0301,
+  0x0002, 0x004D, 0x0307, 0x0002, 0x006D, 0x0307, 0x0002, 0x004D, 0x0323, 0x0002, 0x006D, 0x0323,
+  0x0002, 0x004E, 0x0307, 0x0002, 0x006E, 0x0307, 0x0002, 0x004E, 0x0323, 0x0002, 0x006E, 0x0323,
+  0x0002, 0x004E, 0x0331, 0x0002, 0x006E, 0x0331, 0x0002, 0x004E, 0x032D, 0x0002, 0x006E, 0x032D,
+  0x0003, 0x004F, 0x0303, 0x0301, 0x0003, 0x006F, 0x0303, 0x0301, 0x0003, 0x004F, 0x0303, 0x0308,
+  0x0003, 0x006F, 0x0303, 0x0308, 0x0003, 0x004F, 0x0304, 0x0300, 0x0003, 0x006F, 0x0304, 0x0300,
+  0x0003, 0x004F, 0x0304, 0x0301, 0x0003, 0x006F, 0x0304, 0x0301, 0x0002, 0x0050, 0x0301, 0x0002,
+  0x0070, 0x0301, 0x0002, 0x0050, 0x0307, 0x0002, 0x0070, 0x0307, 0x0002, 0x0052, 0x0307, 0x0002,
+  0x0072, 0x0307, 0x0002, 0x0052, 0x0323, 0x0002, 0x0072, 0x0323, 0x0003, 0x0052, 0x0323, 0x0304,
+  0x0003, 0x0072, 0x0323, 0x0304, 0x0002, 0x0052, 0x0331, 0x0002, 0x0072, 0x0331, 0x0002, 0x0053,
+  0x0307, 0x0002, 0x0073, 0x0307, 0x0002, 0x0053, 0x0323, 0x0002, 0x0073, 0x0323, 0x0003, 0x0053,
+  0x0301, 0x0307, 0x0003, 0x0073, 0x0301, 0x0307, 0x0003, 0x0053, 0x030C, 0x0307, 0x0003, 0x0073,
+  0x030C, 0x0307, 0x0003, 0x0053, 0x0323, 0x0307, 0x0003, 0x0073, 0x0323, 0x0307, 0x0002, 0x0054,
+  0x0307, 0x0002, 0x0074, 0x0307, 0x0002, 0x0054, 0x0323, 0x0002, 0x0074, 0x0323, 0x0002, 0x0054,
+  0x0331, 0x0002, 0x0074, 0x0331, 0x0002, 0x0054, 0x032D, 0x0002, 0x0074, 0x032D, 0x0002, 0x0055,
+  0x0324, 0x0002, 0x0075, 0x0324, 0x0002, 0x0055, 0x0330, 0x0002, 0x0075, 0x0330, 0x0002, 0x0055,
+  0x032D, 0x0002, 0x0075, 0x032D, 0x0003, 0x0055, 0x0303, 0x0301, 0x0003, 0x0075, 0x0303, 0x0301,
+  0x0003, 0x0055, 0x0304, 0x0308, 0x0003, 0x0075, 0x0304, 0x0308, 0x0002, 0x0056, 0x0303, 0x0002,
+  0x0076, 0x0303, 0x0002, 0x0056, 0x0323, 0x0002, 0x0076, 0x0323, 0x0002, 0x0057, 0x0300, 0x0002,
+  0x0077, 0x0300, 0x0002, 0x0057, 0x0301, 0x0002, 0x0077, 0x0301, 0x0002, 0x0057, 0x0308, 0x0002,
+  0x0077, 0x0308, 0x0002, 0x0057, 0x0307, 0x0002, 0x0077, 0x0307, 0x0002, 0x0057, 0x0323, 0x0002,
+  0x0077, 0x0323, 0x0002, 0x0058, 0x0307, 0x0002, 0x0078, 0x0307, 0x0002, 0x0058, 0x0308, 0x0002,
+  0x0078, 0x0308, 0x0002, 0x0059, 0x0307, 0x0002, 0x0079, 0x0307, 0x0002, 0x005A, 0x0302, 0x0002,
+  0x007A, 0x0302, 0x0002, 0x005A, 0x0323, 0x0002, 0x007A, 0x0323, 0x0002, 0x005A, 0x0331, 0x0002,
+  0x007A, 0x0331, 0x0002, 0x0068, 0x0331, 0x0002, 0x0074, 0x0308, 0x0002, 0x0077, 0x030A, 0x0002,
+  0x0079, 0x030A, 0x0002, 0x0061, 0x02BE, 0x0002, 0x017F, 0x0307, 0x0002, 0x0041, 0x0323, 0x0002,
+  0x0061, 0x0323, 0x0002, 0x0041, 0x0309, 0x0002, 0x0061, 0x0309, 0x0003, 0x0041, 0x0302, 0x0301,
+  0x0003, 0x0061, 0x0302, 0x0301, 0x0003, 0x0041, 0x0302, 0x0300, 0x0003, 0x0061, 0x0302, 0x0300,
+  0x0003, 0x0041, 0x0302, 0x0309, 0x0003, 0x0061, 0x0302, 0x0309, 0x0003, 0x0041, 0x0302, 0x0303,
+  0x0003, 0x0061, 0x0302, 0x0303, 0x0003, 0x0041, 0x0323, 0x0302, 0x0003, 0x0061, 0x0323, 0x0302,
+  0x0003, 0x0041, 0x0306, 0x0301, 0x0003, 0x0061, 0x0306, 0x0301, 0x0003, 0x0041, 0x0306, 0x0300,
+  0x0003, 0x0061, 0x0306, 0x0300, 0x0003, 0x0041, 0x0306, 0x0309, 0x0003, 0x0061, 0x0306, 0x0309,
+  0x0003, 0x0041, 0x0306, 0x0303, 0x0003, 0x0061, 0x0306, 0x0303, 0x0003, 0x0041, 0x0323, 0x0306,
+  0x0003, 0x0061, 0x0323, 0x0306, 0x0002, 0x0045, 0x0323, 0x0002, 0x0065, 0x0323, 0x0002, 0x0045,
+  0x0309, 0x0002, 0x0065, 0x0309, 0x0002, 0x0045, 0x0303, 0x0002, 0x0065, 0x0303, 0x0003, 0x0045,
+  0x0302, 0x0301, 0x0003, 0x0065, 0x0302, 0x0301, 0x0003, 0x0045, 0x0302, 0x0300, 0x0003, 0x0065,
+  0x0302, 0x0300, 0x0003, 0x0045, 0x0302, 0x0309, 0x0003, 0x0065, 0x0302, 0x0309, 0x0003, 0x0045,
+  0x0302, 0x0303, 0x0003, 0x0065, 0x0302, 0x0303, 0x0003, 0x0045, 0x0323, 0x0302, 0x0003, 0x0065,
+  0x0323, 0x0302, 0x0002, 0x0049, 0x0309, 0x0002, 0x0069, 0x0309, 0x0002, 0x0049, 0x0323, 0x0002,
+  0x0069, 0x0323, 0x0002, 0x004F, 0x0323, 0x0002, 0x006F, 0x0323, 0x0002, 0x004F, 0x0309, 0x0002,
+  0x006F, 0x0309, 0x0003, 0x004F, 0x0302, 0x0301, 0x0003, 0x006F, 0x0302, 0x0301, 0x0003, 0x004F,
+  0x0302, 0x0300, 0x0003, 0x006F, 0x0302, 0x0300, 0x0003, 0x004F, 0x0302, 0x0309, 0x0003, 0x006F,
+  0x0302, 0x0309, 0x0003, 0x004F, 0x0302, 0x0303, 0x0003, 0x006F, 0x0302, 0x0303, 0x0003, 0x004F,
+  0x0323, 0x0302, 0x0003, 0x006F, 0x0323, 0x0302, 0x0003, 0x004F, 0x031B, 0x0301, 0x0003, 0x006F,
+  0x031B, 0x0301, 0x0003, 0x004F, 0x031B, 0x0300, 0x0003, 0x006F, 0x031B, 0x0300, 0x0003, 0x004F,
+  0x031B, 0x0309, 0x0003, 0x006F, 0x031B, 0x0309, 0x0003, 0x004F, 0x031B, 0x0303, 0x0003, 0x006F,
+  0x031B, 0x0303, 0x0003, 0x004F, 0x031B, 0x0323, 0x0003, 0x006F, 0x031B, 0x0323, 0x0002, 0x0055,
+  0x0323, 0x0002, 0x0075, 0x0323, 0x0002, 0x0055, 0x0309, 0x0002, 0x0075, 0x0309, 0x0003, 0x0055,
+  0x031B, 0x0301, 0x0003, 0x0075, 0x031B, 0x0301, 0x0003, 0x0055, 0x031B, 0x0300, 0x0003, 0x0075,
+  0x031B, 0x0300, 0x0003, 0x0055, 0x031B, 0x0309, 0x0003, 0x0075, 0x031B, 0x0309, 0x0003, 0x0055,
+  0x031B, 0x0303, 0x0003, 0x0075, 0x031B, 0x0303, 0x0003, 0x0055, 0x031B, 0x0323, 0x0003, 0x0075,
+  0x031B, 0x0323, 0x0002, 0x0059, 0x0300, 0x0002, 0x0079, 0x0300, 0x0002, 0x0059, 0x0323, 0x0002,
+  0x0079, 0x0323, 0x0002, 0x0059, 0x0309, 0x0002, 0x0079, 0x0309, 0x0002, 0x0059, 0x0303, 0x0002,
+  0x0079, 0x0303, 0x0001, 0x1EFB, 0x0001, 0x1EFD, 0x0001, 0x1EFF, 0x0002, 0x03B1, 0x0313, 0x0002,
+  0x03B1, 0x0314, 0x0003, 0x03B1, 0x0313, 0x0300, 0x0003, 0x03B1, 0x0314, 0x0300, 0x0003, 0x03B1,
+  0x0313, 0x0301, 0x0003, 0x03B1, 0x0314, 0x0301, 0x0003, 0x03B1, 0x0313, 0x0342, 0x0003, 0x03B1,
+  0x0314, 0x0342, 0x0002, 0x0391, 0x0313, 0x0002, 0x0391, 0x0314, 0x0003, 0x0391, 0x0313, 0x0300,
+  0x0003, 0x0391, 0x0314, 0x0300, 0x0003, 0x0391, 0x0313, 0x0301, 0x0003, 0x0391, 0x0314, 0x0301,
+  0x0003, 0x0391, 0x0313, 0x0342, 0x0003, 0x0391, 0x0314, 0x0342, 0x0002, 0x03B5, 0x0313, 0x0002,
+  0x03B5, 0x0314, 0x0003, 0x03B5, 0x0313, 0x0300, 0x0003, 0x03B5, 0x0314, 0x0300, 0x0003, 0x03B5,
+  0x0313, 0x0301, 0x0003, 0x03B5, 0x0314, 0x0301, 0x0002, 0x0395, 0x0313, 0x0002, 0x0395, 0x0314,
+  0x0003, 0x0395, 0x0313, 0x0300, 0x0003, 0x0395, 0x0314, 0x0300, 0x0003, 0x0395, 0x0313, 0x0301,
+  0x0003, 0x0395, 0x0314, 0x0301, 0x0002, 0x03B7, 0x0313, 0x0002, 0x03B7, 0x0314, 0x0003, 0x03B7,
+  0x0313, 0x0300, 0x0003, 0x03B7, 0x0314, 0x0300, 0x0003, 0x03B7, 0x0313, 0x0301, 0x0003, 0x03B7,
+  0x0314, 0x0301, 0x0003, 0x03B7, 0x0313, 0x0342, 0x0003, 0x03B7, 0x0314, 0x0342, 0x0002, 0x0397,
+  0x0313, 0x0002, 0x0397, 0x0314, 0x0003, 0x0397, 0x0313, 0x0300, 0x0003, 0x0397, 0x0314, 0x0300,
+  0x0003, 0x0397, 0x0313, 0x0301, 0x0003, 0x0397, 0x0314, 0x0301, 0x0003, 0x0397, 0x0313, 0x0342,
+  0x0003, 0x0397, 0x0314, 0x0342, 0x0002, 0x03B9, 0x0313, 0x0002, 0x03B9, 0x0314, 0x0003, 0x03B9,
+  0x0313, 0x0300, 0x0003, 0x03B9, 0x0314, 0x0300, 0x0003, 0x03B9, 0x0313, 0x0301, 0x0003, 0x03B9,
+  0x0314, 0x0301, 0x0003, 0x03B9, 0x0313, 0x0342, 0x0003, 0x03B9, 0x0314, 0x0342, 0x0002, 0x0399,
+  0x0313, 0x0002, 0x0399, 0x0314, 0x0003, 0x0399, 0x0313, 0x0300, 0x0003, 0x0399, 0x0314, 0x0300,
+  0x0003, 0x0399, 0x0313, 0x0301, 0x0003, 0x0399, 0x0314, 0x0301, 0x0003, 0x0399, 0x0313, 0x0342,
+  0x0003, 0x0399, 0x0314, 0x0342, 0x0002, 0x03BF, 0x0313, 0x0002, 0x03BF, 0x0314, 0x0003, 0x03BF,
+  0x0313, 0x0300, 0x0003, 0x03BF, 0x0314, 0x0300, 0x0003, 0x03BF, 0x0313, 0x0301, 0x0003, 0x03BF,
+  0x0314, 0x0301, 0x0002, 0x039F, 0x0313, 0x0002, 0x039F, 0x0314, 0x0003, 0x039F, 0x0313, 0x0300,
+  0x0003, 0x039F, 0x0314, 0x0300, 0x0003, 0x039F, 0x0313, 0x0301, 0x0003, 0x039F, 0x0314, 0x0301,
+  0x0002, 0x03C5, 0x0313, 0x0002, 0x03C5, 0x0314, 0x0003, 0x03C5, 0x0313, 0x0300, 0x0003, 0x03C5,
+  0x0314, 0x0300, 0x0003, 0x03C5, 0x0313, 0x0301, 0x0003, 0x03C5, 0x0314, 0x0301, 0x0003, 0x03C5,
+  0x0313, 0x0342, 0x0003, 0x03C5, 0x0314, 0x0342, 0x0002, 0x03A5, 0x0314, 0x0003, 0x03A5, 0x0314,
+  0x0300, 0x0003, 0x03A5, 0x0314, 0x0301, 0x0003, 0x03A5, 0x0314, 0x0342, 0x0002, 0x03C9, 0x0313,
+  0x0002, 0x03C9, 0x0314, 0x0003, 0x03C9, 0x0313, 0x0300, 0x0003, 0x03C9, 0x0314, 0x0300, 0x0003,
+  0x03C9, 0x0313, 0x0301, 0x0003, 0x03C9, 0x0314, 0x0301, 0x0003, 0x03C9, 0x0313, 0x0342, 0x0003,
+  0x03C9, 0x0314, 0x0342, 0x0002, 0x03A9, 0x0313, 0x0002, 0x03A9, 0x0314, 0x0003, 0x03A9, 0x0313,
+  0x0300, 0x0003, 0x03A9, 0x0314, 0x0300, 0x0003, 0x03A9, 0x0313, 0x0301, 0x0003, 0x03A9, 0x0314,
+  0x0301, 0x0003, 0x03A9, 0x0313, 0x0342, 0x0003, 0x03A9, 0x0314, 0x0342, 0x0002, 0x03B1, 0x0300,
+  0x0002, 0x03B5, 0x0300, 0x0002, 0x03B7, 0x0300, 0x0002, 0x03B9, 0x0300, 0x0002, 0x03BF, 0x0300,
+  0x0002, 0x03C5, 0x0300, 0x0002, 0x03C9, 0x0300, 0x0003, 0x03B1, 0x0313, 0x0345, 0x0003, 0x03B1,
+  0x0313, 0x03B9, 0x0003, 0x03B1, 0x0314, 0x0345, 0x0003, 0x03B1, 0x0314, 0x03B9, 0x0004, 0x03B1,
+  0x0313, 0x0300, 0x0345, 0x0004, 0x03B1, 0x0313, 0x0300, 0x03B9, 0x0004, 0x03B1, 0x0314, 0x0300,
+  0x0345, 0x0004, 0x03B1, 0x0314, 0x0300, 0x03B9, 0x0004, 0x03B1, 0x0313, 0x0301, 0x0345, 0x0004,
+  0x03B1, 0x0313, 0x0301, 0x03B9, 0x0004, 0x03B1, 0x0314, 0x0301, 0x0345, 0x0004, 0x03B1, 0x0314,
+  0x0301, 0x03B9, 0x0004, 0x03B1, 0x0313, 0x0342, 0x0345, 0x0004, 0x03B1, 0x0313, 0x0342, 0x03B9,
+  0x0004, 0x03B1, 0x0314, 0x0342, 0x0345, 0x0004, 0x03B1, 0x0314, 0x0342, 0x03B9, 0x0003, 0x0391,
+  0x0313, 0x0345, 0x0003, 0x0391, 0x0314, 0x0345, 0x0004, 0x0391, 0x0313, 0x0300, 0x0345, 0x0004,
+  0x0391, 0x0314, 0x0300, 0x0345, 0x0004, 0x0391, 0x0313, 0x0301, 0x0345, 0x0004, 0x0391, 0x0314,
+  0x0301, 0x0345, 0x0004, 0x0391, 0x0313, 0x0342, 0x0345, 0x0004, 0x0391, 0x0314, 0x0342, 0x0345,
+  0x0003, 0x03B7, 0x0313, 0x0345, 0x0003, 0x03B7, 0x0313, 0x03B9, 0x0003, 0x03B7, 0x0314, 0x0345,
+  0x0003, 0x03B7, 0x0314, 0x03B9, 0x0004, 0x03B7, 0x0313, 0x0300, 0x0345, 0x0004, 0x03B7, 0x0313,
+  0x0300, 0x03B9, 0x0004, 0x03B7, 0x0314, 0x0300, 0x0345, 0x0004, 0x03B7, 0x0314, 0x0300, 0x03B9,
+  0x0004, 0x03B7, 0x0313, 0x0301, 0x0345, 0x0004, 0x03B7, 0x0313, 0x0301, 0x03B9, 0x0004, 0x03B7,
+  0x0314, 0x0301, 0x0345, 0x0004, 0x03B7, 0x0314, 0x0301, 0x03B9, 0x0004, 0x03B7, 0x0313, 0x0342,
+  0x0345, 0x0004, 0x03B7, 0x0313, 0x0342, 0x03B9, 0x0004, 0x03B7, 0x0314, 0x0342, 0x0345, 0x0004,
+  0x03B7, 0x0314, 0x0342, 0x03B9, 0x0003, 0x0397, 0x0313, 0x0345, 0x0003, 0x0397, 0x0314, 0x0345,
+  0x0004, 0x0397, 0x0313, 0x0300, 0x0345, 0x0004, 0x0397, 0x0314, 0x0300, 0x0345, 0x0004, 0x0397,
+  0x0313, 0x0301, 0x0345, 0x0004, 0x0397, 0x0314, 0x0301, 0x0345, 0x0004, 0x0397, 0x0313, 0x0342,
+  0x0345, 0x0004, 0x0397, 0x0314, 0x0342, 0x0345, 0x0003, 0x03C9, 0x0313, 0x0345, 0x0003, 0x03C9,
+  0x0313, 0x03B9, 0x0003, 0x03C9, 0x0314, 0x0345, 0x0003, 0x03C9, 0x0314, 0x03B9, 0x0004, 0x03C9,
+  0x0313, 0x0300, 0x0345, 0x0004, 0x03C9, 0x0313, 0x0300, 0x03B9, 0x0004, 0x03C9, 0x0314, 0x0300,
+  0x0345, 0x0004, 0x03C9, 0x0314, 0x0300, 0x03B9, 0x0004, 0x03C9, 0x0313, 0x0301, 0x0345, 0x0004,
+  0x03C9, 0x0313, 0x0301, 0x03B9, 0x0004, 0x03C9, 0x0314, 0x0301, 0x0345, 0x0004, 0x03C9, 0x0314,
+  0x0301, 0x03B9, 0x0004, 0x03C9, 0x0313, 0x0342, 0x0345, 0x0004, 0x03C9, 0x0313, 0x0342, 0x03B9,
+  0x0004, 0x03C9, 0x0314, 0x0342, 0x0345, 0x0004, 0x03C9, 0x0314, 0x0342, 0x03B9, 0x0003, 0x03A9,
+  0x0313, 0x0345, 0x0003, 0x03A9, 0x0314, 0x0345, 0x0004, 0x03A9, 0x0313, 0x0300, 0x0345, 0x0004,
+  0x03A9, 0x0314, 0x0300, 0x0345, 0x0004, 0x03A9, 0x0313, 0x0301, 0x0345, 0x0004, 0x03A9, 0x0314,
+  0x0301, 0x0345, 0x0004, 0x03A9, 0x0313, 0x0342, 0x0345, 0x0004, 0x03A9, 0x0314, 0x0342, 0x0345,
+  0x0002, 0x03B1, 0x0306, 0x0002, 0x03B1, 0x0304, 0x0003, 0x03B1, 0x0300, 0x0345, 0x0003, 0x03B1,
+  0x0300, 0x03B9, 0x0002, 0x03B1, 0x0345, 0x0002, 0x03B1, 0x03B9, 0x0003, 0x03B1, 0x0301, 0x0345,
+  0x0003, 0x03B1, 0x0301, 0x03B9, 0x0002, 0x03B1, 0x0342, 0x0003, 0x03B1, 0x0342, 0x0345, 0x0003,
+  0x03B1, 0x0342, 0x03B9, 0x0002, 0x0391, 0x0306, 0x0002, 0x0391, 0x0304, 0x0002, 0x0391, 0x0300,
+  0x0002, 0x0391, 0x0345, 0x0002, 0x0020, 0x0313, 0x0002, 0x0020, 0x0342, 0x0002, 0x00A8, 0x0342,
+  0x0003, 0x0020, 0x0308, 0x0342, 0x0003, 0x03B7, 0x0300, 0x0345, 0x0003, 0x03B7, 0x0300, 0x03B9,
+  0x0002, 0x03B7, 0x0345, 0x0002, 0x03B7, 0x03B9, 0x0003, 0x03B7, 0x0301, 0x0345, 0x0003, 0x03B7,
+  0x0301, 0x03B9, 0x0002, 0x03B7, 0x0342, 0x0003, 0x03B7, 0x0342, 0x0345, 0x0003, 0x03B7, 0x0342,
+  0x03B9, 0x0002, 0x0395, 0x0300, 0x0002, 0x0397, 0x0300, 0x0002, 0x0397, 0x0345, 0x0002, 0x1FBF,
+  0x0300, 0x0003, 0x0020, 0x0313, 0x0300, 0x0002, 0x1FBF, 0x0301, 0x0003, 0x0020, 0x0313, 0x0301,
+  0x0002, 0x1FBF, 0x0342, 0x0003, 0x0020, 0x0313, 0x0342, 0x0002, 0x03B9, 0x0306, 0x0002, 0x03B9,
+  0x0304, 0x0003, 0x03B9, 0x0308, 0x0300, 0x0002, 0x03B9, 0x0342, 0x0003, 0x03B9, 0x0308, 0x0342,
+  0x0002, 0x0399, 0x0306, 0x0002, 0x0399, 0x0304, 0x0002, 0x0399, 0x0300, 0x0002, 0x1FFE, 0x0300,
+  0x0003, 0x0020, 0x0314, 0x0300, 0x0002, 0x1FFE, 0x0301, 0x0003, 0x0020, 0x0314, 0x0301, 0x0002,
+  0x1FFE, 0x0342, 0x0003, 0x0020, 0x0314, 0x0342, 0x0002, 0x03C5, 0x0306, 0x0002, 0x03C5, 0x0304,
+  0x0003, 0x03C5, 0x0308, 0x0300, 0x0002, 0x03C1, 0x0313, 0x0002, 0x03C1, 0x0314, 0x0002, 0x03C5,
+  0x0342, 0x0003, 0x03C5, 0x0308, 0x0342, 0x0002, 0x03A5, 0x0306, 0x0002, 0x03A5, 0x0304, 0x0002,
+  0x03A5, 0x0300, 0x0002, 0x03A1, 0x0314, 0x0002, 0x00A8, 0x0300, 0x0003, 0x0020, 0x0308, 0x0300,
+  0x0001, 0x0060, 0x0003, 0x03C9, 0x0300, 0x0345, 0x0003, 0x03C9, 0x0300, 0x03B9, 0x0002, 0x03C9,
+  0x0345, 0x0002, 0x03C9, 0x03B9, 0x0003, 0x03C9, 0x0301, 0x0345, 0x0003, 0x03C9, 0x0301, 0x03B9,
+  0x0002, 0x03C9, 0x0342, 0x0003, 0x03C9, 0x0342, 0x0345, 0x0003, 0x03C9, 0x0342, 0x03B9, 0x0002,
+  0x039F, 0x0300, 0x0002, 0x03A9, 0x0300, 0x0002, 0x03A9, 0x0345, 0x0001, 0x00B4, 0x0002, 0x0020,
+  0x0314, 0x0001, 0x2002, 0x0001, 0x2003, 0x0001, 0x2010, 0x0002, 0x0020, 0x0333, 0x0001, 0x002E,
+  0x0002, 0x002E, 0x002E, 0x0003, 0x002E, 0x002E, 0x002E, 0x0002, 0x2032, 0x2032, 0x0003, 0x2032,
+  0x2032, 0x2032, 0x0002, 0x2035, 0x2035, 0x0003, 0x2035, 0x2035, 0x2035, 0x0002, 0x0021, 0x0021,
+  0x0002, 0x0020, 0x0305, 0x0002, 0x003F, 0x003F, 0x0002, 0x003F, 0x0021, 0x0002, 0x0021, 0x003F,
+  0x0004, 0x2032, 0x2032, 0x2032, 0x2032, 0x0001, 0x0030, 0x0001, 0x0034, 0x0001, 0x0035, 0x0001,
+  0x0036, 0x0001, 0x0037, 0x0001, 0x0038, 0x0001, 0x0039, 0x0001, 0x002B, 0x0001, 0x2212, 0x0001,
+  0x003D, 0x0001, 0x0028, 0x0001, 0x0029, 0x0002, 0x0052, 0x0073, 0x0003, 0x0061, 0x002F, 0x0063,
+  0x0003, 0x0061, 0x002F, 0x0073, 0x0001, 0x0043, 0x0002, 0x00B0, 0x0043, 0x0003, 0x0063, 0x002F,
+  0x006F, 0x0003, 0x0063, 0x002F, 0x0075, 0x0001, 0x0190, 0x0002, 0x00B0, 0x0046, 0x0002, 0x004E,
+  0x006F, 0x0001, 0x0051, 0x0002, 0x0053, 0x004D, 0x0003, 0x0054, 0x0045, 0x004C, 0x0002, 0x0054,
+  0x004D, 0x0001, 0x005A, 0x0001, 0x03A9, 0x0001, 0x0046, 0x0001, 0x214E, 0x0003, 0x0046, 0x0041,
+  0x0058, 0x0001, 0x0393, 0x0001, 0x03A0, 0x0001, 0x2211, 0x0003, 0x0031, 0x2044, 0x0037, 0x0003,
+  0x0031, 0x2044, 0x0039, 0x0004, 0x0031, 0x2044, 0x0031, 0x0030, 0x0003, 0x0031, 0x2044, 0x0033,
+  0x0003, 0x0032, 0x2044, 0x0033, 0x0003, 0x0031, 0x2044, 0x0035, 0x0003, 0x0032, 0x2044, 0x0035,
+  0x0003, 0x0033, 0x2044, 0x0035, 0x0003, 0x0034, 0x2044, 0x0035, 0x0003, 0x0031, 0x2044, 0x0036,
+  0x0003, 0x0035, 0x2044, 0x0036, 0x0003, 0x0031, 0x2044, 0x0038, 0x0003, 0x0033, 0x2044, 0x0038,
+  0x0003, 0x0035, 0x2044, 0x0038, 0x0003, 0x0037, 0x2044, 0x0038, 0x0002, 0x0031, 0x2044, 0x0001,
+  0x2170, 0x0002, 0x0049, 0x0049, 0x0001, 0x2171, 0x0002, 0x0069, 0x0069, 0x0003, 0x0049, 0x0049,
+  0x0049, 0x0001, 0x2172, 0x0003, 0x0069, 0x0069, 0x0069, 0x0002, 0x0049, 0x0056, 0x0001, 0x2173,
+  0x0002, 0x0069, 0x0076, 0x0001, 0x0056, 0x0001, 0x2174, 0x0002, 0x0056, 0x0049, 0x0001, 0x2175,
+  0x0002, 0x0076, 0x0069, 0x0003, 0x0056, 0x0049, 0x0049, 0x0001, 0x2176, 0x0003, 0x0076, 0x0069,
+  0x0069, 0x0004, 0x0056, 0x0049, 0x0049, 0x0049, 0x0001, 0x2177, 0x0004, 0x0076, 0x0069, 0x0069,
+  0x0069, 0x0002, 0x0049, 0x0058, 0x0001, 0x2178, 0x0002, 0x0069, 0x0078, 0x0001, 0x0058, 0x0001,
+  0x2179, 0x0002, 0x0058, 0x0049, 0x0001, 0x217A, 0x0002, 0x0078, 0x0069, 0x0003, 0x0058, 0x0049,
+  0x0049, 0x0001, 0x217B, 0x0003, 0x0078, 0x0069, 0x0069, 0x0001, 0x217C, 0x0001, 0x217D, 0x0001,
+  0x217E, 0x0001, 0x217F, 0x0001, 0x2184, 0x0003, 0x0030, 0x2044, 0x0033, 0x0002, 0x2190, 0x0338,
+  0x0002, 0x2192, 0x0338, 0x0002, 0x2194, 0x0338, 0x0002, 0x21D0, 0x0338, 0x0002, 0x21D4, 0x0338,
+  0x0002, 0x21D2, 0x0338, 0x0002, 0x2203, 0x0338, 0x0002, 0x2208, 0x0338, 0x0002, 0x220B, 0x0338,
+  0x0002, 0x2223, 0x0338, 0x0002, 0x2225, 0x0338, 0x0002, 0x222B, 0x222B, 0x0003, 0x222B, 0x222B,
+  0x222B, 0x0002, 0x222E, 0x222E, 0x0003, 0x222E, 0x222E, 0x222E, 0x0002, 0x223C, 0x0338, 0x0002,
+  0x2243, 0x0338, 0x0002, 0x2245, 0x0338, 0x0002, 0x2248, 0x0338, 0x0002, 0x003D, 0x0338, 0x0002,
+  0x2261, 0x0338, 0x0002, 0x224D, 0x0338, 0x0002, 0x003C, 0x0338, 0x0002, 0x003E, 0x0338, 0x0002,
+  0x2264, 0x0338, 0x0002, 0x2265, 0x0338, 0x0002, 0x2272, 0x0338, 0x0002, 0x2273, 0x0338, 0x0002,
+  0x2276, 0x0338, 0x0002, 0x2277, 0x0338, 0x0002, 0x227A, 0x0338, 0x0002, 0x227B, 0x0338, 0x0002,
+  0x2282, 0x0338, 0x0002, 0x2283, 0x0338, 0x0002, 0x2286, 0x0338, 0x0002, 0x2287, 0x0338, 0x0002,
+  0x22A2, 0x0338, 0x0002, 0x22A8, 0x0338, 0x0002, 0x22A9, 0x0338, 0x0002, 0x22AB, 0x0338, 0x0002,
+  0x227C, 0x0338, 0x0002, 0x227D, 0x0338, 0x0002, 0x2291, 0x0338, 0x0002, 0x2292, 0x0338, 0x0002,
+  0x22B2, 0x0338, 0x0002, 0x22B3, 0x0338, 0x0002, 0x22B4, 0x0338, 0x0002, 0x22B5, 0x0338, 0x0001,
+  0x3008, 0x0001, 0x3009, 0x0002, 0x0031, 0x0030, 0x0002, 0x0031, 0x0031, 0x0002, 0x0031, 0x0032,
+  0x0002, 0x0031, 0x0033, 0x0002, 0x0031, 0x0034, 0x0002, 0x0031, 0x0035, 0x0002, 0x0031, 0x0036,
+  0x0002, 0x0031, 0x0037, 0x0002, 0x0031, 0x0038, 0x0002, 0x0031, 0x0039, 0x0002, 0x0032, 0x0030,
+  0x0003, 0x0028, 0x0031, 0x0029, 0x0003, 0x0028, 0x0032, 0x0029, 0x0003, 0x0028, 0x0033, 0x0029,
+  0x0003, 0x0028, 0x0034, 0x0029, 0x0003, 0x0028, 0x0035, 0x0029, 0x0003, 0x0028, 0x0036, 0x0029,
+  0x0003, 0x0028, 0x0037, 0x0029, 0x0003, 0x0028, 0x0038, 0x0029, 0x0003, 0x0028, 0x0039, 0x0029,
+  0x0004, 0x0028, 0x0031, 0x0030, 0x0029, 0x0004, 0x0028, 0x0031, 0x0031, 0x0029, 0x0004, 0x0028,
+  0x0031, 0x0032, 0x0029, 0x0004, 0x0028, 0x0031, 0x0033, 0x0029, 0x0004, 0x0028, 0x0031, 0x0034,
+  0x0029, 0x0004, 0x0028, 0x0031, 0x0035, 0x0029, 0x0004, 0x0028, 0x0031, 0x0036, 0x0029, 0x0004,
+  0x0028, 0x0031, 0x0037, 0x0029, 0x0004, 0x0028, 0x0031, 0x0038, 0x0029, 0x0004, 0x0028, 0x0031,
+  0x0039, 0x0029, 0x0004, 0x0028, 0x0032, 0x0030, 0x0029, 0x0002, 0x0031, 0x002E, 0x0002, 0x0032,
+  0x002E, 0x0002, 0x0033, 0x002E, 0x0002, 0x0034, 0x002E, 0x0002, 0x0035, 0x002E, 0x0002, 0x0036,
+  0x002E, 0x0002, 0x0037, 0x002E, 0x0002, 0x0038, 0x002E, 0x0002, 0x0039, 0x002E, 0x0003, 0x0031,
+  0x0030, 0x002E, 0x0003, 0x0031, 0x0031, 0x002E, 0x0003, 0x0031, 0x0032, 0x002E, 0x0003, 0x0031,
+  0x0033, 0x002E, 0x0003, 0x0031, 0x0034, 0x002E, 0x0003, 0x0031, 0x0035, 0x002E, 0x0003, 0x0031,
+  0x0036, 0x002E, 0x0003, 0x0031, 0x0037, 0x002E, 0x0003, 0x0031, 0x0038, 0x002E, 0x0003, 0x0031,
+  0x0039, 0x002E, 0x0003, 0x0032, 0x0030, 0x002E, 0x0003, 0x0028, 0x0061, 0x0029, 0x0003, 0x0028,
+  0x0062, 0x0029, 0x0003, 0x0028, 0x0063, 0x0029, 0x0003, 0x0028, 0x0064, 0x0029, 0x0003, 0x0028,
+  0x0065, 0x0029, 0x0003, 0x0028, 0x0066, 0x0029, 0x0003, 0x0028, 0x0067, 0x0029, 0x0003, 0x0028,
+  0x0068, 0x0029, 0x0003, 0x0028, 0x0069, 0x0029, 0x0003, 0x0028, 0x006A, 0x0029, 0x0003, 0x0028,
+  0x006B, 0x0029, 0x0003, 0x0028, 0x006C, 0x0029, 0x0003, 0x0028, 0x006D, 0x0029, 0x0003, 0x0028,
+  0x006E, 0x0029, 0x0003, 0x0028, 0x006F, 0x0029, 0x0003, 0x0028, 0x0070, 0x0029, 0x0003, 0x0028,
+  0x0071, 0x0029, 0x0003, 0x0028, 0x0072, 0x0029, 0x0003, 0x0028, 0x0073, 0x0029, 0x0003, 0x0028,
+  0x0074, 0x0029, 0x0003, 0x0028, 0x0075, 0x0029, 0x0003, 0x0028, 0x0076, 0x0029, 0x0003, 0x0028,
+  0x0077, 0x0029, 0x0003, 0x0028, 0x0078, 0x0029, 0x0003, 0x0028, 0x0079, 0x0029, 0x0003, 0x0028,
+  0x007A, 0x0029, 0x0001, 0x24D0, 0x0001, 0x24D1, 0x0001, 0x24D2, 0x0001, 0x24D3, 0x0001, 0x24D4,
+  0x0001, 0x24D5, 0x0001, 0x24D6, 0x0001, 0x24D7, 0x0001, 0x24D8, 0x0001, 0x24D9, 0x0001, 0x24DA,
+  0x0001, 0x24DB, 0x0001, 0x24DC, 0x0001, 0x24DD, 0x0001, 0x24DE, 0x0001, 0x24DF, 0x0001, 0x24E0,
+  0x0001, 0x24E1, 0x0001, 0x0053, 0x0001, 0x24E2, 0x0001, 0x24E3, 0x0001, 0x24E4, 0x0001, 0x24E5,
+  0x0001, 0x24E6, 0x0001, 0x24E7, 0x0001, 0x0059, 0x0001, 0x24E8, 0x0001, 0x24E9, 0x0001, 0x2C61,
+  0x0001, 0x026B, 0x0001, 0x1D7D, 0x0001, 0x027D, 0x0001, 0x2C68, 0x0001, 0x2C6A, 0x0001, 0x2C6C,
+  0x0001, 0x2C73, 0x0001, 0x2C76, 0x0001, 0x023F, 0x0001, 0x0240, 0x0001, 0x3012, 0x0001, 0x5341,
+  0x0001, 0x5344, 0x0001, 0x5345, 0x0002, 0x304B, 0x3099, 0x0002, 0x304D, 0x3099, 0x0002, 0x304F,
+  0x3099, 0x0002, 0x3051, 0x3099, 0x0002, 0x3053, 0x3099, 0x0002, 0x3055, 0x3099, 0x0002, 0x3057,
+  0x3099, 0x0002, 0x3059, 0x3099, 0x0002, 0x305B, 0x3099, 0x0002, 0x305D, 0x3099, 0x0002, 0x305F,
+  0x3099, 0x0002, 0x3061, 0x3099, 0x0002, 0x3064, 0x3099, 0x0002, 0x3066, 0x3099, 0x0002, 0x3068,
+  0x3099, 0x0002, 0x306F, 0x3099, 0x0002, 0x306F, 0x309A, 0x0002, 0x3072, 0x3099, 0x0002, 0x3072,
+  0x309A, 0x0002, 0x3075, 0x3099, 0x0002, 0x3075, 0x309A, 0x0002, 0x3078, 0x3099, 0x0002, 0x3078,
+  0x309A, 0x0002, 0x307B, 0x3099, 0x0002, 0x307B, 0x309A, 0x0002, 0x3046, 0x3099, 0x0002, 0x0020,
+  0x3099, 0x0002, 0x0020, 0x309A, 0x0002, 0x309D, 0x3099, 0x0002, 0x3088, 0x308A, 0x0002, 0x30AB,
+  0x3099, 0x0002, 0x30AD, 0x3099, 0x0002, 0x30AF, 0x3099, 0x0002, 0x30B1, 0x3099, 0x0002, 0x30B3,
+  0x3099, 0x0002, 0x30B5, 0x3099, 0x0002, 0x30B7, 0x3099, 0x0002, 0x30B9, 0x3099, 0x0002, 0x30BB,
+  0x3099, 0x0002, 0x30BD, 0x3099, 0x0002, 0x30BF, 0x3099, 0x0002, 0x30C1, 0x3099, 0x0002, 0x30C4,
+  0x3099, 0x0002, 0x30C6, 0x3099, 0x0002, 0x30C8, 0x3099, 0x0002, 0x30CF, 0x3099, 0x0002, 0x30CF,
+  0x309A, 0x0002, 0x30D2, 0x3099, 0x0002, 0x30D2, 0x309A, 0x0002, 0x30D5, 0x3099, 0x0002, 0x30D5,
+  0x309A, 0x0002, 0x30D8, 0x3099, 0x0002, 0x30D8, 0x309A, 0x0002, 0x30DB, 0x3099, 0x0002, 0x30DB,
+  0x309A, 0x0002, 0x30A6, 0x3099, 0x0002, 0x30EF, 0x3099, 0x0002, 0x30F0, 0x3099, 0x0002, 0x30F1,
+  0x3099, 0x0002, 0x30F2, 0x3099, 0x0002, 0x30FD, 0x3099, 0x0002, 0x30B3, 0x30C8, 0x0001, 0x1100,
+  0x0001, 0x1101, 0x0001, 0x11AA, 0x0001, 0x1102, 0x0001, 0x11AC, 0x0001, 0x11AD, 0x0001, 0x1103,
+  0x0001, 0x1104, 0x0001, 0x1105, 0x0001, 0x11B0, 0x0001, 0x11B1, 0x0001, 0x11B2, 0x0001, 0x11B3,
+  0x0001, 0x11B4, 0x0001, 0x11B5, 0x0001, 0x111A, 0x0001, 0x1106, 0x0001, 0x1107, 0x0001, 0x1108,
+  0x0001, 0x1121, 0x0001, 0x1109, 0x0001, 0x110A, 0x0001, 0x110B, 0x0001, 0x110C, 0x0001, 0x110D,
+  0x0001, 0x110E, 0x0001, 0x110F, 0x0001, 0x1110, 0x0001, 0x1111, 0x0001, 0x1112, 0x0001, 0x1161,
+  0x0001, 0x1162, 0x0001, 0x1163, 0x0001, 0x1164, 0x0001, 0x1165, 0x0001, 0x1166, 0x0001, 0x1167,
+  0x0001, 0x1168, 0x0001, 0x1169, 0x0001, 0x116A, 0x0001, 0x116B, 0x0001, 0x116C, 0x0001, 0x116D,
+  0x0001, 0x116E, 0x0001, 0x116F, 0x0001, 0x1170, 0x0001, 0x1171, 0x0001, 0x1172, 0x0001, 0x1173,
+  0x0001, 0x1174, 0x0001, 0x1175, 0x0001, 0x1160, 0x0001, 0x1114, 0x0001, 0x1115, 0x0001, 0x11C7,
+  0x0001, 0x11C8, 0x0001, 0x11CC, 0x0001, 0x11CE, 0x0001, 0x11D3, 0x0001, 0x11D7, 0x0001, 0x11D9,
+  0x0001, 0x111C, 0x0001, 0x11DD, 0x0001, 0x11DF, 0x0001, 0x111D, 0x0001, 0x111E, 0x0001, 0x1120,
+  0x0001, 0x1122, 0x0001, 0x1123, 0x0001, 0x1127, 0x0001, 0x1129, 0x0001, 0x112B, 0x0001, 0x112C,
+  0x0001, 0x112D, 0x0001, 0x112E, 0x0001, 0x112F, 0x0001, 0x1132, 0x0001, 0x1136, 0x0001, 0x1140,
+  0x0001, 0x1147, 0x0001, 0x114C, 0x0001, 0x11F1, 0x0001, 0x11F2, 0x0001, 0x1157, 0x0001, 0x1158,
+  0x0001, 0x1159, 0x0001, 0x1184, 0x0001, 0x1185, 0x0001, 0x1188, 0x0001, 0x1191, 0x0001, 0x1192,
+  0x0001, 0x1194, 0x0001, 0x119E, 0x0001, 0x11A1, 0x0003, 0x0028, 0x1100, 0x0029, 0x0003, 0x0028,
+  0x1102, 0x0029, 0x0003, 0x0028, 0x1103, 0x0029, 0x0003, 0x0028, 0x1105, 0x0029, 0x0003, 0x0028,
+  0x1106, 0x0029, 0x0003, 0x0028, 0x1107, 0x0029, 0x0003, 0x0028, 0x1109, 0x0029, 0x0003, 0x0028,
+  0x110B, 0x0029, 0x0003, 0x0028, 0x110C, 0x0029, 0x0003, 0x0028, 0x110E, 0x0029, 0x0003, 0x0028,
+  0x110F, 0x0029, 0x0003, 0x0028, 0x1110, 0x0029, 0x0003, 0x0028, 0x1111, 0x0029, 0x0003, 0x0028,
+  0x1112, 0x0029, 0x0004, 0x0028, 0x1100, 0x1161, 0x0029, 0x0004, 0x0028, 0x1102, 0x1161, 0x0029,
+  0x0004, 0x0028, 0x1103, 0x1161, 0x0029, 0x0004, 0x0028, 0x1105, 0x1161, 0x0029, 0x0004, 0x0028,
+  0x1106, 0x1161, 0x0029, 0x0004, 0x0028, 0x1107, 0x1161, 0x0029, 0x0004, 0x0028, 0x1109, 0x1161,
+  0x0029, 0x0004, 0x0028, 0x110B, 0x1161, 0x0029, 0x0004, 0x0028, 0x110C, 0x1161, 0x0029, 0x0004,
+  0x0028, 0x110E, 0x1161, 0x0029, 0x0004, 0x0028, 0x110F, 0x1161, 0x0029, 0x0004, 0x0028, 0x1110,
+  0x1161, 0x0029, 0x0004, 0x0028, 0x1111, 0x1161, 0x0029, 0x0004, 0x0028, 0x1112, 0x1161, 0x0029,
+  0x0004, 0x0028, 0x110C, 0x116E, 0x0029, 0x0007, 0x0028, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB,
+  0x0029, 0x0006, 0x0028, 0x110B, 0x1169, 0x1112, 0x116E, 0x0029, 0x0003, 0x0028, 0x4E00, 0x0029,
+  0x0003, 0x0028, 0x4E8C, 0x0029, 0x0003, 0x0028, 0x4E09, 0x0029, 0x0003, 0x0028, 0x56DB, 0x0029,
+  0x0003, 0x0028, 0x4E94, 0x0029, 0x0003, 0x0028, 0x516D, 0x0029, 0x0003, 0x0028, 0x4E03, 0x0029,
+  0x0003, 0x0028, 0x516B, 0x0029, 0x0003, 0x0028, 0x4E5D, 0x0029, 0x0003, 0x0028, 0x5341, 0x0029,
+  0x0003, 0x0028, 0x6708, 0x0029, 0x0003, 0x0028, 0x706B, 0x0029, 0x0003, 0x0028, 0x6C34, 0x0029,
+  0x0003, 0x0028, 0x6728, 0x0029, 0x0003, 0x0028, 0x91D1, 0x0029, 0x0003, 0x0028, 0x571F, 0x0029,
+  0x0003, 0x0028, 0x65E5, 0x0029, 0x0003, 0x0028, 0x682A, 0x0029, 0x0003, 0x0028, 0x6709, 0x0029,
+  0x0003, 0x0028, 0x793E, 0x0029, 0x0003, 0x0028, 0x540D, 0x0029, 0x0003, 0x0028, 0x7279, 0x0029,
+  0x0003, 0x0028, 0x8CA1, 0x0029, 0x0003, 0x0028, 0x795D, 0x0029, 0x0003, 0x0028, 0x52B4, 0x0029,
+  0x0003, 0x0028, 0x4EE3, 0x0029, 0x0003, 0x0028, 0x547C, 0x0029, 0x0003, 0x0028, 0x5B66, 0x0029,
+  0x0003, 0x0028, 0x76E3, 0x0029, 0x0003, 0x0028, 0x4F01, 0x0029, 0x0003, 0x0028, 0x8CC7, 0x0029,
+  0x0003, 0x0028, 0x5354, 0x0029, 0x0003, 0x0028, 0x796D, 0x0029, 0x0003, 0x0028, 0x4F11, 0x0029,
+  0x0003, 0x0028, 0x81EA, 0x0029, 0x0003, 0x0028, 0x81F3, 0x0029, 0x0001, 0x554F, 0x0001, 0x5E7C,
+  0x0001, 0x6587, 0x0001, 0x7B8F, 0x0003, 0x0050, 0x0054, 0x0045, 0x0002, 0x0032, 0x0031, 0x0002,
+  0x0032, 0x0032, 0x0002, 0x0032, 0x0033, 0x0002, 0x0032, 0x0034, 0x0002, 0x0032, 0x0035, 0x0002,
+  0x0032, 0x0036, 0x0002, 0x0032, 0x0037, 0x0002, 0x0032, 0x0038, 0x0002, 0x0032, 0x0039, 0x0002,
+  0x0033, 0x0030, 0x0002, 0x0033, 0x0031, 0x0002, 0x0033, 0x0032, 0x0002, 0x0033, 0x0033, 0x0002,
+  0x0033, 0x0034, 0x0002, 0x0033, 0x0035, 0x0002, 0x1100, 0x1161, 0x0002, 0x1102, 0x1161, 0x0002,
+  0x1103, 0x1161, 0x0002, 0x1105, 0x1161, 0x0002, 0x1106, 0x1161, 0x0002, 0x1107, 0x1161, 0x0002,
+  0x1109, 0x1161, 0x0002, 0x110B, 0x1161, 0x0002, 0x110C, 0x1161, 0x0002, 0x110E, 0x1161, 0x0002,
+  0x110F, 0x1161, 0x0002, 0x1110, 0x1161, 0x0002, 0x1111, 0x1161, 0x0002, 0x1112, 0x1161, 0x0005,
+  0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x0004, 0x110C, 0x116E, 0x110B, 0x1174, 0x0002, 0x110B,
+  0x116E, 0x0001, 0x4E00, 0x0001, 0x4E8C, 0x0001, 0x4E09, 0x0001, 0x56DB, 0x0001, 0x4E94, 0x0001,
+  0x516D, 0x0001, 0x4E03, 0x0001, 0x516B, 0x0001, 0x4E5D, 0x0001, 0x6708, 0x0001, 0x706B, 0x0001,
+  0x6C34, 0x0001, 0x6728, 0x0001, 0x91D1, 0x0001, 0x571F, 0x0001, 0x65E5, 0x0001, 0x682A, 0x0001,
+  0x6709, 0x0001, 0x793E, 0x0001, 0x540D, 0x0001, 0x7279, 0x0001, 0x8CA1, 0x0001, 0x795D, 0x0001,
+  0x52B4, 0x0001, 0x79D8, 0x0001, 0x7537, 0x0001, 0x5973, 0x0001, 0x9069, 0x0001, 0x512A, 0x0001,
+  0x5370, 0x0001, 0x6CE8, 0x0001, 0x9805, 0x0001, 0x4F11, 0x0001, 0x5199, 0x0001, 0x6B63, 0x0001,
+  0x4E0A, 0x0001, 0x4E2D, 0x0001, 0x4E0B, 0x0001, 0x5DE6, 0x0001, 0x53F3, 0x0001, 0x533B, 0x0001,
+  0x5B97, 0x0001, 0x5B66, 0x0001, 0x76E3, 0x0001, 0x4F01, 0x0001, 0x8CC7, 0x0001, 0x5354, 0x0001,
+  0x591C, 0x0002, 0x0033, 0x0036, 0x0002, 0x0033, 0x0037, 0x0002, 0x0033, 0x0038, 0x0002, 0x0033,
+  0x0039, 0x0002, 0x0034, 0x0030, 0x0002, 0x0034, 0x0031, 0x0002, 0x0034, 0x0032, 0x0002, 0x0034,
+  0x0033, 0x0002, 0x0034, 0x0034, 0x0002, 0x0034, 0x0035, 0x0002, 0x0034, 0x0036, 0x0002, 0x0034,
+  0x0037, 0x0002, 0x0034, 0x0038, 0x0002, 0x0034, 0x0039, 0x0002, 0x0035, 0x0030, 0x0002, 0x0031,
+  0x6708, 0x0002, 0x0032, 0x6708, 0x0002, 0x0033, 0x6708, 0x0002, 0x0034, 0x6708, 0x0002, 0x0035,
+  0x6708, 0x0002, 0x0036, 0x6708, 0x0002, 0x0037, 0x6708, 0x0002, 0x0038, 0x6708, 0x0002, 0x0039,
+  0x6708, 0x0003, 0x0031, 0x0030, 0x6708, 0x0003, 0x0031, 0x0031, 0x6708, 0x0003, 0x0031, 0x0032,
+  0x6708, 0x0002, 0x0048, 0x0067, 0x0003, 0x0065, 0x0072, 0x0067, 0x0002, 0x0065, 0x0056, 0x0003,
+  0x004C, 0x0054, 0x0044, 0x0001, 0x30A2, 0x0001, 0x30A4, 0x0001, 0x30A6, 0x0001, 0x30A8, 0x0001,
+  0x30AA, 0x0001, 0x30AB, 0x0001, 0x30AD, 0x0001, 0x30AF, 0x0001, 0x30B1, 0x0001, 0x30B3, 0x0001,
+  0x30B5, 0x0001, 0x30B7, 0x0001, 0x30B9, 0x0001, 0x30BB, 0x0001, 0x30BD, 0x0001, 0x30BF, 0x0001,
+  0x30C1, 0x0001, 0x30C4, 0x0001, 0x30C6, 0x0001, 0x30C8, 0x0001, 0x30CA, 0x0001, 0x30CB, 0x0001,
+  0x30CC, 0x0001, 0x30CD, 0x0001, 0x30CE, 0x0001, 0x30CF, 0x0001, 0x30D2, 0x0001, 0x30D5, 0x0001,
+  0x30D8, 0x0001, 0x30DB, 0x0001, 0x30DE, 0x0001, 0x30DF, 0x0001, 0x30E0, 0x0001, 0x30E1, 0x0001,
+  0x30E2, 0x0001, 0x30E4, 0x0001, 0x30E6, 0x0001, 0x30E8, 0x0001, 0x30E9, 0x0001, 0x30EA, 0x0001,
+  0x30EB, 0x0001, 0x30EC, 0x0001, 0x30ED, 0x0001, 0x30EF, 0x0001, 0x30F0, 0x0001, 0x30F1, 0x0001,
+  0x30F2, 0x0002, 0x4EE4, 0x548C, 0x0005, 0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8, 0x0004, 0x30A2,
+  0x30EB, 0x30D5, 0x30A1, 0x0005, 0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2, 0x0003, 0x30A2, 0x30FC,
+  0x30EB, 0x0005, 0x30A4, 0x30CB, 0x30F3, 0x30AF, 0x3099, 0x0003, 0x30A4, 0x30F3, 0x30C1, 0x0003,
+  0x30A6, 0x30A9, 0x30F3, 0x0006, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8, 0x3099, 0x0004, 0x30A8,
+  0x30FC, 0x30AB, 0x30FC, 0x0003, 0x30AA, 0x30F3, 0x30B9, 0x0003, 0x30AA, 0x30FC, 0x30E0, 0x0003,
+  0x30AB, 0x30A4, 0x30EA, 0x0004, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x0004, 0x30AB, 0x30ED, 0x30EA,
+  0x30FC, 0x0004, 0x30AB, 0x3099, 0x30ED, 0x30F3, 0x0004, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x0004,
+  0x30AD, 0x3099, 0x30AB, 0x3099, 0x0004, 0x30AD, 0x3099, 0x30CB, 0x30FC, 0x0004, 0x30AD, 0x30E5,
+  0x30EA, 0x30FC, 0x0006, 0x30AD, 0x3099, 0x30EB, 0x30BF, 0x3099, 0x30FC, 0x0002, 0x30AD, 0x30ED,
+  0x0006, 0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x0006, 0x30AD, 0x30ED, 0x30E1, 0x30FC,
+  0x30C8, 0x30EB, 0x0005, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x0004, 0x30AF, 0x3099, 0x30E9,
+  0x30E0, 0x0006, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x0006, 0x30AF, 0x30EB, 0x30BB,
+  0x3099, 0x30A4, 0x30ED, 0x0004, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x0003, 0x30B1, 0x30FC, 0x30B9,
+  0x0003, 0x30B3, 0x30EB, 0x30CA, 0x0004, 0x30B3, 0x30FC, 0x30DB, 0x309A, 0x0004, 0x30B5, 0x30A4,
+  0x30AF, 0x30EB, 0x0005, 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x0005, 0x30B7, 0x30EA, 0x30F3,
+  0x30AF, 0x3099, 0x0003, 0x30BB, 0x30F3, 0x30C1, 0x0003, 0x30BB, 0x30F3, 0x30C8, 0x0004, 0x30BF,
+  0x3099, 0x30FC, 0x30B9, 0x0003, 0x30C6, 0x3099, 0x30B7, 0x0003, 0x30C8, 0x3099, 0x30EB, 0x0002,
+  0x30C8, 0x30F3, 0x0002, 0x30CA, 0x30CE, 0x0003, 0x30CE, 0x30C3, 0x30C8, 0x0003, 0x30CF, 0x30A4,
+  0x30C4, 0x0006, 0x30CF, 0x309A, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x0004, 0x30CF, 0x309A, 0x30FC,
+  0x30C4, 0x0005, 0x30CF, 0x3099, 0x30FC, 0x30EC, 0x30EB, 0x0006, 0x30D2, 0x309A, 0x30A2, 0x30B9,
+  0x30C8, 0x30EB, 0x0004, 0x30D2, 0x309A, 0x30AF, 0x30EB, 0x0003, 0x30D2, 0x309A, 0x30B3, 0x0003,
+  0x30D2, 0x3099, 0x30EB, 0x0006, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x3099, 0x0004, 0x30D5,
+  0x30A3, 0x30FC, 0x30C8, 0x0006, 0x30D5, 0x3099, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x0003, 0x30D5,
+  0x30E9, 0x30F3, 0x0005, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x0003, 0x30D8, 0x309A, 0x30BD,
+  0x0004, 0x30D8, 0x309A, 0x30CB, 0x30D2, 0x0003, 0x30D8, 0x30EB, 0x30C4, 0x0004, 0x30D8, 0x309A,
+  0x30F3, 0x30B9, 0x0005, 0x30D8, 0x309A, 0x30FC, 0x30B7, 0x3099, 0x0004, 0x30D8, 0x3099, 0x30FC,
+  0x30BF, 0x0005, 0x30DB, 0x309A, 0x30A4, 0x30F3, 0x30C8, 0x0004, 0x30DB, 0x3099, 0x30EB, 0x30C8,
+  0x0002, 0x30DB, 0x30F3, 0x0005, 0x30DB, 0x309A, 0x30F3, 0x30C8, 0x3099, 0x0003, 0x30DB, 0x30FC,
+  0x30EB, 0x0003, 0x30DB, 0x30FC, 0x30F3, 0x0004, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x0003, 0x30DE,
+  0x30A4, 0x30EB, 0x0003, 0x30DE, 0x30C3, 0x30CF, 0x0003, 0x30DE, 0x30EB, 0x30AF, 0x0005, 0x30DE,
+  0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x0004, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x0002, 0x30DF, 0x30EA,
+  0x0006, 0x30DF, 0x30EA, 0x30CF, 0x3099, 0x30FC, 0x30EB, 0x0003, 0x30E1, 0x30AB, 0x3099, 0x0005,
+  0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3, 0x0004, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x0004, 0x30E4,
+  0x30FC, 0x30C8, 0x3099, 0x0003, 0x30E4, 0x30FC, 0x30EB, 0x0003, 0x30E6, 0x30A2, 0x30F3, 0x0004,
+  0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x0002, 0x30EA, 0x30E9, 0x0004, 0x30EB, 0x30D2, 0x309A, 0x30FC,
+  0x0005, 0x30EB, 0x30FC, 0x30D5, 0x3099, 0x30EB, 0x0002, 0x30EC, 0x30E0, 0x0006, 0x30EC, 0x30F3,
+  0x30C8, 0x30B1, 0x3099, 0x30F3, 0x0003, 0x30EF, 0x30C3, 0x30C8, 0x0002, 0x0030, 0x70B9, 0x0002,
+  0x0031, 0x70B9, 0x0002, 0x0032, 0x70B9, 0x0002, 0x0033, 0x70B9, 0x0002, 0x0034, 0x70B9, 0x0002,
+  0x0035, 0x70B9, 0x0002, 0x0036, 0x70B9, 0x0002, 0x0037, 0x70B9, 0x0002, 0x0038, 0x70B9, 0x0002,
+  0x0039, 0x70B9, 0x0003, 0x0031, 0x0030, 0x70B9, 0x0003, 0x0031, 0x0031, 0x70B9, 0x0003, 0x0031,
+  0x0032, 0x70B9, 0x0003, 0x0031, 0x0033, 0x70B9, 0x0003, 0x0031, 0x0034, 0x70B9, 0x0003, 0x0031,
+  0x0035, 0x70B9, 0x0003, 0x0031, 0x0036, 0x70B9, 0x0003, 0x0031, 0x0037, 0x70B9, 0x0003, 0x0031,
+  0x0038, 0x70B9, 0x0003, 0x0031, 0x0039, 0x70B9, 0x0003, 0x0032, 0x0030, 0x70B9, 0x0003, 0x0032,
+  0x0031, 0x70B9, 0x0003, 0x0032, 0x0032, 0x70B9, 0x0003, 0x0032, 0x0033, 0x70B9, 0x0003, 0x0032,
+  0x0034, 0x70B9, 0x0003, 0x0068, 0x0050, 0x0061, 0x0002, 0x0064, 0x0061, 0x0002, 0x0041, 0x0055,
+  0x0003, 0x0062, 0x0061, 0x0072, 0x0002, 0x006F, 0x0056, 0x0002, 0x0070, 0x0063, 0x0002, 0x0064,
+  0x006D, 0x0003, 0x0064, 0x006D, 0x0032, 0x0003, 0x0064, 0x006D, 0x0033, 0x0002, 0x0049, 0x0055,
+  0x0002, 0x5E73, 0x6210, 0x0002, 0x662D, 0x548C, 0x0002, 0x5927, 0x6B63, 0x0002, 0x660E, 0x6CBB,
+  0x0004, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x0002, 0x0070, 0x0041, 0x0002, 0x006E, 0x0041, 0x0002,
+  0x03BC, 0x0041, 0x0002, 0x006D, 0x0041, 0x0002, 0x006B, 0x0041, 0x0002, 0x004B, 0x0042, 0x0002,
+  0x004D, 0x0042, 0x0002, 0x0047, 0x0042, 0x0003, 0x0063, 0x0061, 0x006C, 0x0004, 0x006B, 0x0063,
+  0x0061, 0x006C, 0x0002, 0x0070, 0x0046, 0x0002, 0x006E, 0x0046, 0x0002, 0x03BC, 0x0046, 0x0002,
+  0x03BC, 0x0067, 0x0002, 0x006D, 0x0067, 0x0002, 0x006B, 0x0067, 0x0002, 0x0048, 0x007A, 0x0003,
+  0x006B, 0x0048, 0x007A, 0x0003, 0x004D, 0x0048, 0x007A, 0x0003, 0x0047, 0x0048, 0x007A, 0x0003,
+  0x0054, 0x0048, 0x007A, 0x0002, 0x03BC, 0x006C, 0x0002, 0x006D, 0x006C, 0x0002, 0x0064, 0x006C,
+  0x0002, 0x006B, 0x006C, 0x0002, 0x0066, 0x006D, 0x0002, 0x006E, 0x006D, 0x0002, 0x03BC, 0x006D,
+  0x0002, 0x006D, 0x006D, 0x0002, 0x0063, 0x006D, 0x0002, 0x006B, 0x006D, 0x0003, 0x006D, 0x006D,
+  0x0032, 0x0003, 0x0063, 0x006D, 0x0032, 0x0002, 0x006D, 0x0032, 0x0003, 0x006B, 0x006D, 0x0032,
+  0x0003, 0x006D, 0x006D, 0x0033, 0x0003, 0x0063, 0x006D, 0x0033, 0x0002, 0x006D, 0x0033, 0x0003,
+  0x006B, 0x006D, 0x0033, 0x0003, 0x006D, 0x2215, 0x0073, 0x0004, 0x006D, 0x2215, 0x0073, 0x0032,
+  0x0002, 0x0050, 0x0061, 0x0003, 0x006B, 0x0050, 0x0061, 0x0003, 0x004D, 0x0050, 0x0061, 0x0003,
+  0x0047, 0x0050, 0x0061, 0x0003, 0x0072, 0x0061, 0x0064, 0x0005, 0x0072, 0x0061, 0x0064, 0x2215,
+  0x0073, 0x0006, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0032, 0x0002, 0x0070, 0x0073, 0x0002,
+  0x006E, 0x0073, 0x0002, 0x03BC, 0x0073, 0x0002, 0x006D, 0x0073, 0x0002, 0x0070, 0x0056, 0x0002,
+  0x006E, 0x0056, 0x0002, 0x03BC, 0x0056, 0x0002, 0x006D, 0x0056, 0x0002, 0x006B, 0x0056, 0x0002,
+  0x004D, 0x0056, 0x0002, 0x0070, 0x0057, 0x0002, 0x006E, 0x0057, 0x0002, 0x03BC, 0x0057, 0x0002,
+  0x006D, 0x0057, 0x0002, 0x006B, 0x0057, 0x0002, 0x004D, 0x0057, 0x0002, 0x006B, 0x03A9, 0x0002,
+  0x004D, 0x03A9, 0x0004, 0x0061, 0x002E, 0x006D, 0x002E, 0x0002, 0x0042, 0x0071, 0x0002, 0x0063,
+  0x0063, 0x0002, 0x0063, 0x0064, 0x0004, 0x0043, 0x2215, 0x006B, 0x0067, 0x0003, 0x0043, 0x006F,
+  0x002E, 0x0002, 0x0064, 0x0042, 0x0002, 0x0047, 0x0079, 0x0002, 0x0068, 0x0061, 0x0002, 0x0048,
+  0x0050, 0x0002, 0x0069, 0x006E, 0x0002, 0x004B, 0x004B, 0x0002, 0x004B, 0x004D, 0x0002, 0x006B,
+  0x0074, 0x0002, 0x006C, 0x006D, 0x0002, 0x006C, 0x006E, 0x0003, 0x006C, 0x006F, 0x0067, 0x0002,
+  0x006C, 0x0078, 0x0002, 0x006D, 0x0062, 0x0003, 0x006D, 0x0069, 0x006C, 0x0003, 0x006D, 0x006F,
+  0x006C, 0x0002, 0x0050, 0x0048, 0x0004, 0x0070, 0x002E, 0x006D, 0x002E, 0x0003, 0x0050, 0x0050,
+  0x004D, 0x0002, 0x0050, 0x0052, 0x0002, 0x0073, 0x0072, 0x0002, 0x0053, 0x0076, 0x0002, 0x0057,
+  0x0062, 0x0003, 0x0056, 0x2215, 0x006D, 0x0003, 0x0041, 0x2215, 0x006D, 0x0002, 0x0031, 0x65E5,
+  0x0002, 0x0032, 0x65E5, 0x0002, 0x0033, 0x65E5, 0x0002, 0x0034, 0x65E5, 0x0002, 0x0035, 0x65E5,
+  0x0002, 0x0036, 0x65E5, 0x0002, 0x0037, 0x65E5, 0x0002, 0x0038, 0x65E5, 0x0002, 0x0039, 0x65E5,
+  0x0003, 0x0031, 0x0030, 0x65E5, 0x0003, 0x0031, 0x0031, 0x65E5, 0x0003, 0x0031, 0x0032, 0x65E5,
+  0x0003, 0x0031, 0x0033, 0x65E5, 0x0003, 0x0031, 0x0034, 0x65E5, 0x0003, 0x0031, 0x0035, 0x65E5,
+  0x0003, 0x0031, 0x0036, 0x65E5, 0x0003, 0x0031, 0x0037, 0x65E5, 0x0003, 0x0031, 0x0038, 0x65E5,
+  0x0003, 0x0031, 0x0039, 0x65E5, 0x0003, 0x0032, 0x0030, 0x65E5, 0x0003, 0x0032, 0x0031, 0x65E5,
+  0x0003, 0x0032, 0x0032, 0x65E5, 0x0003, 0x0032, 0x0033, 0x65E5, 0x0003, 0x0032, 0x0034, 0x65E5,
+  0x0003, 0x0032, 0x0035, 0x65E5, 0x0003, 0x0032, 0x0036, 0x65E5, 0x0003, 0x0032, 0x0037, 0x65E5,
+  0x0003, 0x0032, 0x0038, 0x65E5, 0x0003, 0x0032, 0x0039, 0x65E5, 0x0003, 0x0033, 0x0030, 0x65E5,
+  0x0003, 0x0033, 0x0031, 0x65E5, 0x0003, 0x0067, 0x0061, 0x006C, 0x0001, 0xA641, 0x0001, 0xA643,
+  0x0001, 0xA645, 0x0001, 0xA647, 0x0001, 0xA649, 0x0001, 0xA64D, 0x0001, 0xA64F, 0x0001, 0xA651,
+  0x0001, 0xA653, 0x0001, 0xA655, 0x0001, 0xA657, 0x0001, 0xA659, 0x0001, 0xA65B, 0x0001, 0xA65D,
+  0x0001, 0xA65F, 0x0001, 0xA661, 0x0001, 0xA663, 0x0001, 0xA665, 0x0001, 0xA667, 0x0001, 0xA669,
+  0x0001, 0xA66B, 0x0001, 0xA66D, 0x0001, 0xA681, 0x0001, 0xA683, 0x0001, 0xA685, 0x0001, 0xA687,
+  0x0001, 0xA689, 0x0001, 0xA68B, 0x0001, 0xA68D, 0x0001, 0xA68F, 0x0001, 0xA691, 0x0001, 0xA693,
+  0x0001, 0xA695, 0x0001, 0xA697, 0x0001, 0xA699, 0x0001, 0xA69B, 0x0001, 0xA723, 0x0001, 0xA725,
+  0x0001, 0xA727, 0x0001, 0xA729, 0x0001, 0xA72B, 0x0001, 0xA72D, 0x0001, 0xA72F, 0x0001, 0xA733,
+  0x0001, 0xA735, 0x0001, 0xA737, 0x0001, 0xA739, 0x0001, 0xA73B, 0x0001, 0xA73D, 0x0001, 0xA73F,
+  0x0001, 0xA741, 0x0001, 0xA743, 0x0001, 0xA745, 0x0001, 0xA747, 0x0001, 0xA749, 0x0001, 0xA74B,
+  0x0001, 0xA74D, 0x0001, 0xA74F, 0x0001, 0xA751, 0x0001, 0xA753, 0x0001, 0xA755, 0x0001, 0xA757,
+  0x0001, 0xA759, 0x0001, 0xA75B, 0x0001, 0xA75D, 0x0001, 0xA75F, 0x0001, 0xA761, 0x0001, 0xA763,
+  0x0001, 0xA765, 0x0001, 0xA767, 0x0001, 0xA769, 0x0001, 0xA76B, 0x0001, 0xA76D, 0x0001, 0xA76F,
+  0x0001, 0xA77A, 0x0001, 0xA77C, 0x0001, 0x1D79, 0x0001, 0xA77F, 0x0001, 0xA781, 0x0001, 0xA783,
+  0x0001, 0xA785, 0x0001, 0xA787, 0x0001, 0xA78C, 0x0001, 0xA791, 0x0001, 0xA793, 0x0001, 0xA797,
+  0x0001, 0xA799, 0x0001, 0xA79B, 0x0001, 0xA79D, 0x0001, 0xA79F, 0x0001, 0xA7A1, 0x0001, 0xA7A3,
+  0x0001, 0xA7A5, 0x0001, 0xA7A7, 0x0001, 0xA7A9, 0x0001, 0x026C, 0x0001, 0x029E, 0x0001, 0x0287,
+  0x0001, 0xAB53, 0x0001, 0xA7B5, 0x0001, 0xA7B7, 0x0001, 0xA7B9, 0x0001, 0xA7BB, 0x0001, 0xA7BD,
+  0x0001, 0xA7BF, 0x0001, 0xA7C1, 0x0001, 0xA7C3, 0x0001, 0xA794, 0x0001, 0x1D8E, 0x0001, 0xA7C8,
+  0x0001, 0xA7CA, 0x0001, 0xA7D1, 0x0001, 0xA7D7, 0x0001, 0xA7D9, 0x0001, 0xA7F6, 0x0001, 0x0126,
+  0x0001, 0xAB37, 0x0001, 0xAB52, 0x0001, 0x028D, 0x0001, 0x8C48, 0x0001, 0x66F4, 0x0001, 0x8ECA,
+  0x0001, 0x8CC8, 0x0001, 0x6ED1, 0x0001, 0x4E32, 0x0001, 0x53E5, 0x0001, 0x9F9C, 0x0001, 0x5951,
+  0x0001, 0x5587, 0x0001, 0x5948, 0x0001, 0x61F6, 0x0001, 0x7669, 0x0001, 0x7F85, 0x0001, 0x863F,
+  0x0001, 0x87BA, 0x0001, 0x88F8, 0x0001, 0x908F, 0x0001, 0x6A02, 0x0001, 0x6D1B, 0x0001, 0x70D9,
+  0x0001, 0x73DE, 0x0001, 0x843D, 0x0001, 0x916A, 0x0001, 0x99F1, 0x0001, 0x4E82, 0x0001, 0x5375,
+  0x0001, 0x6B04, 0x0001, 0x721B, 0x0001, 0x862D, 0x0001, 0x9E1E, 0x0001, 0x5D50, 0x0001, 0x6FEB,
+  0x0001, 0x85CD, 0x0001, 0x8964, 0x0001, 0x62C9, 0x0001, 0x81D8, 0x0001, 0x881F, 0x0001, 0x5ECA,
+  0x0001, 0x6717, 0x0001, 0x6D6A, 0x0001, 0x72FC, 0x0001, 0x90CE, 0x0001, 0x4F86, 0x0001, 0x51B7,
+  0x0001, 0x52DE, 0x0001, 0x64C4, 0x0001, 0x6AD3, 0x0001, 0x7210, 0x0001, 0x76E7, 0x0001, 0x8001,
+  0x0001, 0x8606, 0x0001, 0x865C, 0x0001, 0x8DEF, 0x0001, 0x9732, 0x0001, 0x9B6F, 0x0001, 0x9DFA,
+  0x0001, 0x788C, 0x0001, 0x797F, 0x0001, 0x7DA0, 0x0001, 0x83C9, 0x0001, 0x9304, 0x0001, 0x9E7F,
+  0x0001, 0x8AD6, 0x0001, 0x58DF, 0x0001, 0x5F04, 0x0001, 0x7C60, 0x0001, 0x807E, 0x0001, 0x7262,
+  0x0001, 0x78CA, 0x0001, 0x8CC2, 0x0001, 0x96F7, 0x0001, 0x58D8, 0x0001, 0x5C62, 0x0001, 0x6A13,
+  0x0001, 0x6DDA, 0x0001, 0x6F0F, 0x0001, 0x7D2F, 0x0001, 0x7E37, 0x0001, 0x964B, 0x0001, 0x52D2,
+  0x0001, 0x808B, 0x0001, 0x51DC, 0x0001, 0x51CC, 0x0001, 0x7A1C, 0x0001, 0x7DBE, 0x0001, 0x83F1,
+  0x0001, 0x9675, 0x0001, 0x8B80, 0x0001, 0x62CF, 0x0001, 0x8AFE, 0x0001, 0x4E39, 0x0001, 0x5BE7,
+  0x0001, 0x6012, 0x0001, 0x7387, 0x0001, 0x7570, 0x0001, 0x5317, 0x0001, 0x78FB, 0x0001, 0x4FBF,
+  0x0001, 0x5FA9, 0x0001, 0x4E0D, 0x0001, 0x6CCC, 0x0001, 0x6578, 0x0001, 0x7D22, 0x0001, 0x53C3,
+  0x0001, 0x585E, 0x0001, 0x7701, 0x0001, 0x8449, 0x0001, 0x8AAA, 0x0001, 0x6BBA, 0x0001, 0x8FB0,
+  0x0001, 0x6C88, 0x0001, 0x62FE, 0x0001, 0x82E5, 0x0001, 0x63A0, 0x0001, 0x7565, 0x0001, 0x4EAE,
+  0x0001, 0x5169, 0x0001, 0x51C9, 0x0001, 0x6881, 0x0001, 0x7CE7, 0x0001, 0x826F, 0x0001, 0x8AD2,
+  0x0001, 0x91CF, 0x0001, 0x52F5, 0x0001, 0x5442, 0x0001, 0x5EEC, 0x0001, 0x65C5, 0x0001, 0x6FFE,
+  0x0001, 0x792A, 0x0001, 0x95AD, 0x0001, 0x9A6A, 0x0001, 0x9E97, 0x0001, 0x9ECE, 0x0001, 0x529B,
+  0x0001, 0x66C6, 0x0001, 0x6B77, 0x0001, 0x8F62, 0x0001, 0x5E74, 0x0001, 0x6190, 0x0001, 0x6200,
+  0x0001, 0x649A, 0x0001, 0x6F23, 0x0001, 0x7149, 0x0001, 0x7489, 0x0001, 0x79CA, 0x0001, 0x7DF4,
+  0x0001, 0x806F, 0x0001, 0x8F26, 0x0001, 0x84EE, 0x0001, 0x9023, 0x0001, 0x934A, 0x0001, 0x5217,
+  0x0001, 0x52A3, 0x0001, 0x54BD, 0x0001, 0x70C8, 0x0001, 0x88C2, 0x0001, 0x5EC9, 0x0001, 0x5FF5,
+  0x0001, 0x637B, 0x0001, 0x6BAE, 0x0001, 0x7C3E, 0x0001, 0x7375, 0x0001, 0x4EE4, 0x0001, 0x56F9,
+  0x0001, 0x5DBA, 0x0001, 0x601C, 0x0001, 0x73B2, 0x0001, 0x7469, 0x0001, 0x7F9A, 0x0001, 0x8046,
+  0x0001, 0x9234, 0x0001, 0x96F6, 0x0001, 0x9748, 0x0001, 0x9818, 0x0001, 0x4F8B, 0x0001, 0x79AE,
+  0x0001, 0x91B4, 0x0001, 0x96B8, 0x0001, 0x60E1, 0x0001, 0x4E86, 0x0001, 0x50DA, 0x0001, 0x5BEE,
+  0x0001, 0x5C3F, 0x0001, 0x6599, 0x0001, 0x71CE, 0x0001, 0x7642, 0x0001, 0x84FC, 0x0001, 0x907C,
+  0x0001, 0x9F8D, 0x0001, 0x6688, 0x0001, 0x962E, 0x0001, 0x5289, 0x0001, 0x677B, 0x0001, 0x67F3,
+  0x0001, 0x6D41, 0x0001, 0x6E9C, 0x0001, 0x7409, 0x0001, 0x7559, 0x0001, 0x786B, 0x0001, 0x7D10,
+  0x0001, 0x985E, 0x0001, 0x622E, 0x0001, 0x9678, 0x0001, 0x502B, 0x0001, 0x5D19, 0x0001, 0x6DEA,
+  0x0001, 0x8F2A, 0x0001, 0x5F8B, 0x0001, 0x6144, 0x0001, 0x6817, 0x0001, 0x9686, 0x0001, 0x5229,
+  0x0001, 0x540F, 0x0001, 0x5C65, 0x0001, 0x6613, 0x0001, 0x674E, 0x0001, 0x68A8, 0x0001, 0x6CE5,
+  0x0001, 0x7406, 0x0001, 0x75E2, 0x0001, 0x7F79, 0x0001, 0x88CF, 0x0001, 0x88E1, 0x0001, 0x91CC,
+  0x0001, 0x96E2, 0x0001, 0x533F, 0x0001, 0x6EBA, 0x0001, 0x541D, 0x0001, 0x71D0, 0x0001, 0x7498,
+  0x0001, 0x85FA, 0x0001, 0x96A3, 0x0001, 0x9C57, 0x0001, 0x9E9F, 0x0001, 0x6797, 0x0001, 0x6DCB,
+  0x0001, 0x81E8, 0x0001, 0x7ACB, 0x0001, 0x7B20, 0x0001, 0x7C92, 0x0001, 0x72C0, 0x0001, 0x7099,
+  0x0001, 0x8B58, 0x0001, 0x4EC0, 0x0001, 0x8336, 0x0001, 0x523A, 0x0001, 0x5207, 0x0001, 0x5EA6,
+  0x0001, 0x62D3, 0x0001, 0x7CD6, 0x0001, 0x5B85, 0x0001, 0x6D1E, 0x0001, 0x66B4, 0x0001, 0x8F3B,
+  0x0001, 0x884C, 0x0001, 0x964D, 0x0001, 0x898B, 0x0001, 0x5ED3, 0x0001, 0x5140, 0x0001, 0x55C0,
+  0x0001, 0x585A, 0x0001, 0x6674, 0x0001, 0x51DE, 0x0001, 0x732A, 0x0001, 0x76CA, 0x0001, 0x793C,
+  0x0001, 0x795E, 0x0001, 0x7965, 0x0001, 0x798F, 0x0001, 0x9756, 0x0001, 0x7CBE, 0x0001, 0x7FBD,
+  0x0001, 0x8612, 0x0001, 0x8AF8, 0x0001, 0x9038, 0x0001, 0x90FD, 0x0001, 0x98EF, 0x0001, 0x98FC,
+  0x0001, 0x9928, 0x0001, 0x9DB4, 0x0001, 0x90DE, 0x0001, 0x96B7, 0x0001, 0x4FAE, 0x0001, 0x50E7,
+  0x0001, 0x514D, 0x0001, 0x52C9, 0x0001, 0x52E4, 0x0001, 0x5351, 0x0001, 0x559D, 0x0001, 0x5606,
+  0x0001, 0x5668, 0x0001, 0x5840, 0x0001, 0x58A8, 0x0001, 0x5C64, 0x0001, 0x5C6E, 0x0001, 0x6094,
+  0x0001, 0x6168, 0x0001, 0x618E, 0x0001, 0x61F2, 0x0001, 0x654F, 0x0001, 0x65E2, 0x0001, 0x6691,
+  0x0001, 0x6885, 0x0001, 0x6D77, 0x0001, 0x6E1A, 0x0001, 0x6F22, 0x0001, 0x716E, 0x0001, 0x722B,
+  0x0001, 0x7422, 0x0001, 0x7891, 0x0001, 0x7949, 0x0001, 0x7948, 0x0001, 0x7950, 0x0001, 0x7956,
+  0x0001, 0x798D, 0x0001, 0x798E, 0x0001, 0x7A40, 0x0001, 0x7A81, 0x0001, 0x7BC0, 0x0001, 0x7E09,
+  0x0001, 0x7E41, 0x0001, 0x7F72, 0x0001, 0x8005, 0x0001, 0x81ED, 0x0001, 0x8279, 0x0001, 0x8457,
+  0x0001, 0x8910, 0x0001, 0x8996, 0x0001, 0x8B01, 0x0001, 0x8B39, 0x0001, 0x8CD3, 0x0001, 0x8D08,
+  0x0001, 0x8FB6, 0x0001, 0x96E3, 0x0001, 0x97FF, 0x0001, 0x983B, 0x0001, 0x6075, 0x0001, 0x8218,
+  0x0001, 0x4E26, 0x0001, 0x51B5, 0x0001, 0x5168, 0x0001, 0x4F80, 0x0001, 0x5145, 0x0001, 0x5180,
+  0x0001, 0x52C7, 0x0001, 0x52FA, 0x0001, 0x5555, 0x0001, 0x5599, 0x0001, 0x55E2, 0x0001, 0x58B3,
+  0x0001, 0x5944, 0x0001, 0x5954, 0x0001, 0x5A62, 0x0001, 0x5B28, 0x0001, 0x5ED2, 0x0001, 0x5ED9,
+  0x0001, 0x5F69, 0x0001, 0x5FAD, 0x0001, 0x60D8, 0x0001, 0x614E, 0x0001, 0x6108, 0x0001, 0x6160,
+  0x0001, 0x6234, 0x0001, 0x63C4, 0x0001, 0x641C, 0x0001, 0x6452, 0x0001, 0x6556, 0x0001, 0x671B,
+  0x0001, 0x6756, 0x0001, 0x6B79, 0x0001, 0x6EDB, 0x0001, 0x6ECB, 0x0001, 0x701E, 0x0001, 0x77A7,
+  0x0001, 0x7235, 0x0001, 0x72AF, 0x0001, 0x7471, 0x0001, 0x7506, 0x0001, 0x753B, 0x0001, 0x761D,
+  0x0001, 0x761F, 0x0001, 0x76DB, 0x0001, 0x76F4, 0x0001, 0x774A, 0x0001, 0x7740, 0x0001, 0x78CC,
+  0x0001, 0x7AB1, 0x0001, 0x7C7B, 0x0001, 0x7D5B, 0x0001, 0x7F3E, 0x0001, 0x8352, 0x0001, 0x83EF,
+  0x0001, 0x8779, 0x0001, 0x8941, 0x0001, 0x8986, 0x0001, 0x8ABF, 0x0001, 0x8ACB, 0x0001, 0x8AED,
+  0x0001, 0x8B8A, 0x0001, 0x8F38, 0x0001, 0x9072, 0x0001, 0x9199, 0x0001, 0x9276, 0x0001, 0x967C,
+  0x0001, 0x97DB, 0x0001, 0x980B, 0x0001, 0x9B12, 0x0001, 0x3B9D, 0x0001, 0x4018, 0x0001, 0x4039,
+  0x0001, 0x9F43, 0x0001, 0x9F8E, 0x0002, 0x0066, 0x0066, 0x0002, 0x0066, 0x0069, 0x0002, 0x0066,
+  0x006C, 0x0003, 0x0066, 0x0066, 0x0069, 0x0003, 0x0066, 0x0066, 0x006C, 0x0002, 0x0073, 0x0074,
+  0x0001, 0x2014, 0x0001, 0x2013, 0x0001, 0x005F, 0x0001, 0x007B, 0x0001, 0x007D, 0x0001, 0x3014,
+  0x0001, 0x3015, 0x0001, 0x3010, 0x0001, 0x3011, 0x0001, 0x300A, 0x0001, 0x300B, 0x0001, 0x300C,
+  0x0001, 0x300D, 0x0001, 0x300E, 0x0001, 0x300F, 0x0001, 0x005B, 0x0001, 0x005D, 0x0001, 0x0021,
+  0x0001, 0x0022, 0x0001, 0x0023, 0x0001, 0x0024, 0x0001, 0x0025, 0x0001, 0x0026, 0x0001, 0x0027,
+  0x0001, 0x002A, 0x0001, 0x002C, 0x0001, 0x002D, 0x0001, 0x002F, 0x0001, 0x003A, 0x0001, 0x003C,
+  0x0001, 0x003E, 0x0001, 0x003F, 0x0001, 0x0040, 0x0001, 0xFF41, 0x0001, 0xFF42, 0x0001, 0xFF43,
+  0x0001, 0xFF44, 0x0001, 0xFF45, 0x0001, 0xFF46, 0x0001, 0xFF47, 0x0001, 0xFF48, 0x0001, 0xFF49,
+  0x0001, 0xFF4A, 0x0001, 0xFF4B, 0x0001, 0xFF4C, 0x0001, 0xFF4D, 0x0001, 0xFF4E, 0x0001, 0xFF4F,
+  0x0001, 0xFF50, 0x0001, 0xFF51, 0x0001, 0xFF52, 0x0001, 0xFF53, 0x0001, 0xFF54, 0x0001, 0xFF55,
+  0x0001, 0xFF56, 0x0001, 0xFF57, 0x0001, 0xFF58, 0x0001, 0xFF59, 0x0001, 0xFF5A, 0x0001, 0x005C,
+  0x0001, 0x005E, 0x0001, 0x007C, 0x0001, 0x007E, 0x0001, 0x3002, 0x0001, 0x3001, 0x0001, 0x30FB,
+  0x0001, 0x30A1, 0x0001, 0x30A3, 0x0001, 0x30A5, 0x0001, 0x30A7, 0x0001, 0x30A9, 0x0001, 0x30E3,
+  0x0001, 0x30E5, 0x0001, 0x30E7, 0x0001, 0x30C3, 0x0001, 0x30FC, 0x0001, 0x30F3, 0x0001, 0x3099,
+  0x0001, 0x309A, 0x0001, 0x00A2, 0x0001, 0x00A3, 0x0001, 0x00AC, 0x0001, 0x00A6, 0x0001, 0x00A5,
+  0x0001, 0x20A9, 0x0001, 0x2190, 0x0001, 0x2191, 0x0001, 0x2192, 0x0001, 0x2193
+};
+
+static const struct ftnormtab_pair ftnormtab_pairs[928] = {
+  {0x003C,0x0338,0x226E}, {0x003D,0x0338,0x2260}, {0x003E,0x0338,0x226F}, {0x0041,0x0300,0x00C0},
+  {0x0041,0x0301,0x00C1}, {0x0041,0x0302,0x00C2}, {0x0041,0x0303,0x00C3}, {0x0041,0x0304,0x0100},
+  {0x0041,0x0306,0x0102}, {0x0041,0x0307,0x0226}, {0x0041,0x0308,0x00C4}, {0x0041,0x0309,0x1EA2},
+  {0x0041,0x030A,0x00C5}, {0x0041,0x030C,0x01CD}, {0x0041,0x030F,0x0200}, {0x0041,0x0311,0x0202},
+  {0x0041,0x0323,0x1EA0}, {0x0041,0x0325,0x1E00}, {0x0041,0x0328,0x0104}, {0x0042,0x0307,0x1E02},
+  {0x0042,0x0323,0x1E04}, {0x0042,0x0331,0x1E06}, {0x0043,0x0301,0x0106}, {0x0043,0x0302,0x0108},
+  {0x0043,0x0307,0x010A}, {0x0043,0x030C,0x010C}, {0x0043,0x0327,0x00C7}, {0x0044,0x0307,0x1E0A},
+  {0x0044,0x030C,0x010E}, {0x0044,0x0323,0x1E0C}, {0x0044,0x0327,0x1E10}, {0x0044,0x032D,0x1E12},
+  {0x0044,0x0331,0x1E0E}, {0x0045,0x0300,0x00C8}, {0x0045,0x0301,0x00C9}, {0x0045,0x0302,0x00CA},
+  {0x0045,0x0303,0x1EBC}, {0x0045,0x0304,0x0112}, {0x0045,0x0306,0x0114}, {0x0045,0x0307,0x0116},
+  {0x0045,0x0308,0x00CB}, {0x0045,0x0309,0x1EBA}, {0x0045,0x030C,0x011A}, {0x0045,0x030F,0x0204},
+  {0x0045,0x0311,0x0206}, {0x0045,0x0323,0x1EB8}, {0x0045,0x0327,0x0228}, {0x0045,0x0328,0x0118},
+  {0x0045,0x032D,0x1E18}, {0x0045,0x0330,0x1E1A}, {0x0046,0x0307,0x1E1E}, {0x0047,0x0301,0x01F4},
+  {0x0047,0x0302,0x011C}, {0x0047,0x0304,0x1E20}, {0x0047,0x0306,0x011E}, {0x0047,0x0307,0x0120},
+  {0x0047,0x030C,0x01E6}, {0x0047,0x0327,0x0122}, {0x0048,0x0302,0x0124}, {0x0048,0x0307,0x1E22},
+  {0x0048,0x0308,0x1E26}, {0x0048,0x030C,0x021E}, {0x0048,0x0323,0x1E24}, {0x0048,0x0327,0x1E28},
+  {0x0048,0x032E,0x1E2A}, {0x0049,0x0300,0x00CC}, {0x0049,0x0301,0x00CD}, {0x0049,0x0302,0x00CE},
+  {0x0049,0x0303,0x0128}, {0x0049,0x0304,0x012A}, {0x0049,0x0306,0x012C}, {0x0049,0x0307,0x0130},
+  {0x0049,0x0308,0x00CF}, {0x0049,0x0309,0x1EC8}, {0x0049,0x030C,0x01CF}, {0x0049,0x030F,0x0208},
+  {0x0049,0x0311,0x020A}, {0x0049,0x0323,0x1ECA}, {0x0049,0x0328,0x012E}, {0x0049,0x0330,0x1E2C},
+  {0x004A,0x0302,0x0134}, {0x004B,0x0301,0x1E30}, {0x004B,0x030C,0x01E8}, {0x004B,0x0323,0x1E32},
+  {0x004B,0x0327,0x0136}, {0x004B,0x0331,0x1E34}, {0x004C,0x0301,0x0139}, {0x004C,0x030C,0x013D},
+  {0x004C,0x0323,0x1E36}, {0x004C,0x0327,0x013B}, {0x004C,0x032D,0x1E3C}, {0x004C,0x0331,0x1E3A},
+  {0x004D,0x0301,0x1E3E}, {0x004D,0x0307,0x1E40}, {0x004D,0x0323,0x1E42}, {0x004E,0x0300,0x01F8},
+  {0x004E,0x0301,0x0143}, {0x004E,0x0303,0x00D1}, {0x004E,0x0307,0x1E44}, {0x004E,0x030C,0x0147},
+  {0x004E,0x0323,0x1E46}, {0x004E,0x0327,0x0145}, {0x004E,0x032D,0x1E4A}, {0x004E,0x0331,0x1E48},
+  {0x004F,0x0300,0x00D2}, {0x004F,0x0301,0x00D3}, {0x004F,0x0302,0x00D4}, {0x004F,0x0303,0x00D5},
+  {0x004F,0x0304,0x014C}, {0x004F,0x0306,0x014E}, {0x004F,0x0307,0x022E}, {0x004F,0x0308,0x00D6},
+  {0x004F,0x0309,0x1ECE}, {0x004F,0x030B,0x0150}, {0x004F,0x030C,0x01D1}, {0x004F,0x030F,0x020C},
+  {0x004F,0x0311,0x020E}, {0x004F,0x031B,0x01A0}, {0x004F,0x0323,0x1ECC}, {0x004F,0x0328,0x01EA},
+  {0x0050,0x0301,0x1E54}, {0x0050,0x0307,0x1E56}, {0x0052,0x0301,0x0154}, {0x0052,0x0307,0x1E58},
+  {0x0052,0x030C,0x0158}, {0x0052,0x030F,0x0210}, {0x0052,0x0311,0x0212}, {0x0052,0x0323,0x1E5A},
+  {0x0052,0x0327,0x0156}, {0x0052,0x0331,0x1E5E}, {0x0053,0x0301,0x015A}, {0x0053,0x0302,0x015C},
+  {0x0053,0x0307,0x1E60}, {0x0053,0x030C,0x0160}, {0x0053,0x0323,0x1E62}, {0x0053,0x0326,0x0218},
+  {0x0053,0x0327,0x015E}, {0x0054,0x0307,0x1E6A}, {0x0054,0x030C,0x0164}, {0x0054,0x0323,0x1E6C},
+  {0x0054,0x0326,0x021A}, {0x0054,0x0327,0x0162}, {0x0054,0x032D,0x1E70}, {0x0054,0x0331,0x1E6E},
+  {0x0055,0x0300,0x00D9}, {0x0055,0x0301,0x00DA}, {0x0055,0x0302,0x00DB}, {0x0055,0x0303,0x0168},
+  {0x0055,0x0304,0x016A}, {0x0055,0x0306,0x016C}, {0x0055,0x0308,0x00DC}, {0x0055,0x0309,0x1EE6},
+  {0x0055,0x030A,0x016E}, {0x0055,0x030B,0x0170}, {0x0055,0x030C,0x01D3}, {0x0055,0x030F,0x0214},
+  {0x0055,0x0311,0x0216}, {0x0055,0x031B,0x01AF}, {0x0055,0x0323,0x1EE4}, {0x0055,0x0324,0x1E72},
+  {0x0055,0x0328,0x0172}, {0x0055,0x032D,0x1E76}, {0x0055,0x0330,0x1E74}, {0x0056,0x0303,0x1E7C},
+  {0x0056,0x0323,0x1E7E}, {0x0057,0x0300,0x1E80}, {0x0057,0x0301,0x1E82}, {0x0057,0x0302,0x0174},
+  {0x0057,0x0307,0x1E86}, {0x0057,0x0308,0x1E84}, {0x0057,0x0323,0x1E88}, {0x0058,0x0307,0x1E8A},
+  {0x0058,0x0308,0x1E8C}, {0x0059,0x0300,0x1EF2}, {0x0059,0x0301,0x00DD}, {0x0059,0x0302,0x0176},
+  {0x0059,0x0303,0x1EF8}, {0x0059,0x0304,0x0232}, {0x0059,0x0307,0x1E8E}, {0x0059,0x0308,0x0178},
+  {0x0059,0x0309,0x1EF6}, {0x0059,0x0323,0x1EF4}, {0x005A,0x0301,0x0179}, {0x005A,0x0302,0x1E90},
+  {0x005A,0x0307,0x017B}, {0x005A,0x030C,0x017D}, {0x005A,0x0323,0x1E92}, {0x005A,0x0331,0x1E94},
+  {0x0061,0x0300,0x00E0}, {0x0061,0x0301,0x00E1}, {0x0061,0x0302,0x00E2}, {0x0061,0x0303,0x00E3},
+  {0x0061,0x0304,0x0101}, {0x0061,0x0306,0x0103}, {0x0061,0x0307,0x0227}, {0x0061,0x0308,0x00E4},
+  {0x0061,0x0309,0x1EA3}, {0x0061,0x030A,0x00E5}, {0x0061,0x030C,0x01CE}, {0x0061,0x030F,0x0201},
+  {0x0061,0x0311,0x0203}, {0x0061,0x0323,0x1EA1}, {0x0061,0x0325,0x1E01}, {0x0061,0x0328,0x0105},
+  {0x0062,0x0307,0x1E03}, {0x0062,0x0323,0x1E05}, {0x0062,0x0331,0x1E07}, {0x0063,0x0301,0x0107},
+  {0x0063,0x0302,0x0109}, {0x0063,0x0307,0x010B}, {0x0063,0x030C,0x010D}, {0x0063,0x0327,0x00E7},
+  {0x0064,0x0307,0x1E0B}, {0x0064,0x030C,0x010F}, {0x0064,0x0323,0x1E0D}, {0x0064,0x0327,0x1E11},
+  {0x0064,0x032D,0x1E13}, {0x0064,0x0331,0x1E0F}, {0x0065,0x0300,0x00E8}, {0x0065,0x0301,0x00E9},
+  {0x0065,0x0302,0x00EA}, {0x0065,0x0303,0x1EBD}, {0x0065,0x0304,0x0113}, {0x0065,0x0306,0x0115},
+  {0x0065,0x0307,0x0117}, {0x0065,0x0308,0x00EB}, {0x0065,0x0309,0x1EBB}, {0x0065,0x030C,0x011B},
+  {0x0065,0x030F,0x0205}, {0x0065,0x0311,0x0207}, {0x0065,0x0323,0x1EB9}, {0x0065,0x0327,0x0229},
+  {0x0065,0x0328,0x0119}, {0x0065,0x032D,0x1E19}, {0x0065,0x0330,0x1E1B}, {0x0066,0x0307,0x1E1F},
+  {0x0067,0x0301,0x01F5}, {0x0067,0x0302,0x011D}, {0x0067,0x0304,0x1E21}, {0x0067,0x0306,0x011F},
+  {0x0067,0x0307,0x0121}, {0x0067,0x030C,0x01E7}, {0x0067,0x0327,0x0123}, {0x0068,0x0302,0x0125},
+  {0x0068,0x0307,0x1E23}, {0x0068,0x0308,0x1E27}, {0x0068,0x030C,0x021F}, {0x0068,0x0323,0x1E25},
+  {0x0068,0x0327,0x1E29}, {0x0068,0x032E,0x1E2B}, {0x0068,0x0331,0x1E96}, {0x0069,0x0300,0x00EC},
+  {0x0069,0x0301,0x00ED}, {0x0069,0x0302,0x00EE}, {0x0069,0x0303,0x0129}, {0x0069,0x0304,0x012B},
+  {0x0069,0x0306,0x012D}, {0x0069,0x0308,0x00EF}, {0x0069,0x0309,0x1EC9}, {0x0069,0x030C,0x01D0},
+  {0x0069,0x030F,0x0209}, {0x0069,0x0311,0x020B}, {0x0069,0x0323,0x1ECB}, {0x0069,0x0328,0x012F},
+  {0x0069,0x0330,0x1E2D}, {0x006A,0x0302,0x0135}, {0x006A,0x030C,0x01F0}, {0x006B,0x0301,0x1E31},
+  {0x006B,0x030C,0x01E9}, {0x006B,0x0323,0x1E33}, {0x006B,0x0327,0x0137}, {0x006B,0x0331,0x1E35},
+  {0x006C,0x0301,0x013A}, {0x006C,0x030C,0x013E}, {0x006C,0x0323,0x1E37}, {0x006C,0x0327,0x013C},
+  {0x006C,0x032D,0x1E3D}, {0x006C,0x0331,0x1E3B}, {0x006D,0x0301,0x1E3F}, {0x006D,0x0307,0x1E41},
+  {0x006D,0x0323,0x1E43}, {0x006E,0x0300,0x01F9}, {0x006E,0x0301,0x0144}, {0x006E,0x0303,0x00F1},
+  {0x006E,0x0307,0x1E45}, {0x006E,0x030C,0x0148}, {0x006E,0x0323,0x1E47}, {0x006E,0x0327,0x0146},
+  {0x006E,0x032D,0x1E4B}, {0x006E,0x0331,0x1E49}, {0x006F,0x0300,0x00F2}, {0x006F,0x0301,0x00F3},
+  {0x006F,0x0302,0x00F4}, {0x006F,0x0303,0x00F5}, {0x006F,0x0304,0x014D}, {0x006F,0x0306,0x014F},
+  {0x006F,0x0307,0x022F}, {0x006F,0x0308,0x00F6}, {0x006F,0x0309,0x1ECF}, {0x006F,0x030B,0x0151},
+  {0x006F,0x030C,0x01D2}, {0x006F,0x030F,0x020D}, {0x006F,0x0311,0x020F}, {0x006F,0x031B,0x01A1},
+  {0x006F,0x0323,0x1ECD}, {0x006F,0x0328,0x01EB}, {0x0070,0x0301,0x1E55}, {0x0070,0x0307,0x1E57},
+  {0x0072,0x0301,0x0155}, {0x0072,0x0307,0x1E59}, {0x0072,0x030C,0x0159}, {0x0072,0x030F,0x0211},
+  {0x0072,0x0311,0x0213}, {0x0072,0x0323,0x1E5B}, {0x0072,0x0327,0x0157}, {0x0072,0x0331,0x1E5F},
+  {0x0073,0x0301,0x015B}, {0x0073,0x0302,0x015D}, {0x0073,0x0307,0x1E61}, {0x0073,0x030C,0x0161},
+  {0x0073,0x0323,0x1E63}, {0x0073,0x0326,0x0219}, {0x0073,0x0327,0x015F}, {0x0074,0x0307,0x1E6B},
+  {0x0074,0x0308,0x1E97}, {0x0074,0x030C,0x0165}, {0x0074,0x0323,0x1E6D}, {0x0074,0x0326,0x021B},
+  {0x0074,0x0327,0x0163}, {0x0074,0x032D,0x1E71}, {0x0074,0x0331,0x1E6F}, {0x0075,0x0300,0x00F9},
+  {0x0075,0x0301,0x00FA}, {0x0075,0x0302,0x00FB}, {0x0075,0x0303,0x0169}, {0x0075,0x0304,0x016B},
+  {0x0075,0x0306,0x016D}, {0x0075,0x0308,0x00FC}, {0x0075,0x0309,0x1EE7}, {0x0075,0x030A,0x016F},
+  {0x0075,0x030B,0x0171}, {0x0075,0x030C,0x01D4}, {0x0075,0x030F,0x0215}, {0x0075,0x0311,0x0217},
+  {0x0075,0x031B,0x01B0}, {0x0075,0x0323,0x1EE5}, {0x0075,0x0324,0x1E73}, {0x0075,0x0328,0x0173},
+  {0x0075,0x032D,0x1E77}, {0x0075,0x0330,0x1E75}, {0x0076,0x0303,0x1E7D}, {0x0076,0x0323,0x1E7F},
+  {0x0077,0x0300,0x1E81}, {0x0077,0x0301,0x1E83}, {0x0077,0x0302,0x0175}, {0x0077,0x0307,0x1E87},
+  {0x0077,0x0308,0x1E85}, {0x0077,0x030A,0x1E98}, {0x0077,0x0323,0x1E89}, {0x0078,0x0307,0x1E8B},
+  {0x0078,0x0308,0x1E8D}, {0x0079,0x0300,0x1EF3}, {0x0079,0x0301,0x00FD}, {0x0079,0x0302,0x0177},
+  {0x0079,0x0303,0x1EF9}, {0x0079,0x0304,0x0233}, {0x0079,0x0307,0x1E8F}, {0x0079,0x0308,0x00FF},
+  {0x0079,0x0309,0x1EF7}, {0x0079,0x030A,0x1E99}, {0x0079,0x0323,0x1EF5}, {0x007A,0x0301,0x017A},
+  {0x007A,0x0302,0x1E91}, {0x007A,0x0307,0x017C}, {0x007A,0x030C,0x017E}, {0x007A,0x0323,0x1E93},
+  {0x007A,0x0331,0x1E95}, {0x00A8,0x0300,0x1FED}, {0x00A8,0x0301,0x0385}, {0x00A8,0x0342,0x1FC1},
+  {0x00C2,0x0300,0x1EA6}, {0x00C2,0x0301,0x1EA4}, {0x00C2,0x0303,0x1EAA}, {0x00C2,0x0309,0x1EA8},
+  {0x00C4,0x0304,0x01DE}, {0x00C5,0x0301,0x01FA}, {0x00C6,0x0301,0x01FC}, {0x00C6,0x0304,0x01E2},
+  {0x00C7,0x0301,0x1E08}, {0x00CA,0x0300,0x1EC0}, {0x00CA,0x0301,0x1EBE}, {0x00CA,0x0303,0x1EC4},
+  {0x00CA,0x0309,0x1EC2}, {0x00CF,0x0301,0x1E2E}, {0x00D4,0x0300,0x1ED2}, {0x00D4,0x0301,0x1ED0},
+  {0x00D4,0x0303,0x1ED6}, {0x00D4,0x0309,0x1ED4}, {0x00D5,0x0301,0x1E4C}, {0x00D5,0x0304,0x022C},
+  {0x00D5,0x0308,0x1E4E}, {0x00D6,0x0304,0x022A}, {0x00D8,0x0301,0x01FE}, {0x00DC,0x0300,0x01DB},
+  {0x00DC,0x0301,0x01D7}, {0x00DC,0x0304,0x01D5}, {0x00DC,0x030C,0x01D9}, {0x00E2,0x0300,0x1EA7},
+  {0x00E2,0x0301,0x1EA5}, {0x00E2,0x0303,0x1EAB}, {0x00E2,0x0309,0x1EA9}, {0x00E4,0x0304,0x01DF},
+  {0x00E5,0x0301,0x01FB}, {0x00E6,0x0301,0x01FD}, {0x00E6,0x0304,0x01E3}, {0x00E7,0x0301,0x1E09},
+  {0x00EA,0x0300,0x1EC1}, {0x00EA,0x0301,0x1EBF}, {0x00EA,0x0303,0x1EC5}, {0x00EA,0x0309,0x1EC3},
+  {0x00EF,0x0301,0x1E2F}, {0x00F4,0x0300,0x1ED3}, {0x00F4,0x0301,0x1ED1}, {0x00F4,0x0303,0x1ED7},
+  {0x00F4,0x0309,0x1ED5}, {0x00F5,0x0301,0x1E4D}, {0x00F5,0x0304,0x022D}, {0x00F5,0x0308,0x1E4F},
+  {0x00F6,0x0304,0x022B}, {0x00F8,0x0301,0x01FF}, {0x00FC,0x0300,0x01DC}, {0x00FC,0x0301,0x01D8},
+  {0x00FC,0x0304,0x01D6}, {0x00FC,0x030C,0x01DA}, {0x0102,0x0300,0x1EB0}, {0x0102,0x0301,0x1EAE},
+  {0x0102,0x0303,0x1EB4}, {0x0102,0x0309,0x1EB2}, {0x0103,0x0300,0x1EB1}, {0x0103,0x0301,0x1EAF},
+  {0x0103,0x0303,0x1EB5}, {0x0103,0x0309,0x1EB3}, {0x0112,0x0300,0x1E14}, {0x0112,0x0301,0x1E16},
+  {0x0113,0x0300,0x1E15}, {0x0113,0x0301,0x1E17}, {0x014C,0x0300,0x1E50}, {0x014C,0x0301,0x1E52},
+  {0x014D,0x0300,0x1E51}, {0x014D,0x0301,0x1E53}, {0x015A,0x0307,0x1E64}, {0x015B,0x0307,0x1E65},
+  {0x0160,0x0307,0x1E66}, {0x0161,0x0307,0x1E67}, {0x0168,0x0301,0x1E78}, {0x0169,0x0301,0x1E79},
+  {0x016A,0x0308,0x1E7A}, {0x016B,0x0308,0x1E7B}, {0x017F,0x0307,0x1E9B}, {0x01A0,0x0300,0x1EDC},
+  {0x01A0,0x0301,0x1EDA}, {0x01A0,0x0303,0x1EE0}, {0x01A0,0x0309,0x1EDE}, {0x01A0,0x0323,0x1EE2},
+  {0x01A1,0x0300,0x1EDD}, {0x01A1,0x0301,0x1EDB}, {0x01A1,0x0303,0x1EE1}, {0x01A1,0x0309,0x1EDF},
+  {0x01A1,0x0323,0x1EE3}, {0x01AF,0x0300,0x1EEA}, {0x01AF,0x0301,0x1EE8}, {0x01AF,0x0303,0x1EEE},
+  {0x01AF,0x0309,0x1EEC}, {0x01AF,0x0323,0x1EF0}, {0x01B0,0x0300,0x1EEB}, {0x01B0,0x0301,0x1EE9},
+  {0x01B0,0x0303,0x1EEF}, {0x01B0,0x0309,0x1EED}, {0x01B0,0x0323,0x1EF1}, {0x01B7,0x030C,0x01EE},
+  {0x01EA,0x0304,0x01EC}, {0x01EB,0x0304,0x01ED}, {0x0226,0x0304,0x01E0}, {0x0227,0x0304,0x01E1},
+  {0x0228,0x0306,0x1E1C}, {0x0229,0x0306,0x1E1D}, {0x022E,0x0304,0x0230}, {0x022F,0x0304,0x0231},
+  {0x0292,0x030C,0x01EF}, {0x0391,0x0300,0x1FBA}, {0x0391,0x0301,0x0386}, {0x0391,0x0304,0x1FB9},
+  {0x0391,0x0306,0x1FB8}, {0x0391,0x0313,0x1F08}, {0x0391,0x0314,0x1F09}, {0x0391,0x0345,0x1FBC},
+  {0x0395,0x0300,0x1FC8}, {0x0395,0x0301,0x0388}, {0x0395,0x0313,0x1F18}, {0x0395,0x0314,0x1F19},
+  {0x0397,0x0300,0x1FCA}, {0x0397,0x0301,0x0389}, {0x0397,0x0313,0x1F28}, {0x0397,0x0314,0x1F29},
+  {0x0397,0x0345,0x1FCC}, {0x0399,0x0300,0x1FDA}, {0x0399,0x0301,0x038A}, {0x0399,0x0304,0x1FD9},
+  {0x0399,0x0306,0x1FD8}, {0x0399,0x0308,0x03AA}, {0x0399,0x0313,0x1F38}, {0x0399,0x0314,0x1F39},
+  {0x039F,0x0300,0x1FF8}, {0x039F,0x0301,0x038C}, {0x039F,0x0313,0x1F48}, {0x039F,0x0314,0x1F49},
+  {0x03A1,0x0314,0x1FEC}, {0x03A5,0x0300,0x1FEA}, {0x03A5,0x0301,0x038E}, {0x03A5,0x0304,0x1FE9},
+  {0x03A5,0x0306,0x1FE8}, {0x03A5,0x0308,0x03AB}, {0x03A5,0x0314,0x1F59}, {0x03A9,0x0300,0x1FFA},
+  {0x03A9,0x0301,0x038F}, {0x03A9,0x0313,0x1F68}, {0x03A9,0x0314,0x1F69}, {0x03A9,0x0345,0x1FFC},
+  {0x03AC,0x0345,0x1FB4}, {0x03AE,0x0345,0x1FC4}, {0x03B1,0x0300,0x1F70}, {0x03B1,0x0301,0x03AC},
+  {0x03B1,0x0304,0x1FB1}, {0x03B1,0x0306,0x1FB0}, {0x03B1,0x0313,0x1F00}, {0x03B1,0x0314,0x1F01},
+  {0x03B1,0x0342,0x1FB6}, {0x03B1,0x0345,0x1FB3}, {0x03B5,0x0300,0x1F72}, {0x03B5,0x0301,0x03AD},
+  {0x03B5,0x0313,0x1F10}, {0x03B5,0x0314,0x1F11}, {0x03B7,0x0300,0x1F74}, {0x03B7,0x0301,0x03AE},
+  {0x03B7,0x0313,0x1F20}, {0x03B7,0x0314,0x1F21}, {0x03B7,0x0342,0x1FC6}, {0x03B7,0x0345,0x1FC3},
+  {0x03B9,0x0300,0x1F76}, {0x03B9,0x0301,0x03AF}, {0x03B9,0x0304,0x1FD1}, {0x03B9,0x0306,0x1FD0},
+  {0x03B9,0x0308,0x03CA}, {0x03B9,0x0313,0x1F30}, {0x03B9,0x0314,0x1F31}, {0x03B9,0x0342,0x1FD6},
+  {0x03BF,0x0300,0x1F78}, {0x03BF,0x0301,0x03CC}, {0x03BF,0x0313,0x1F40}, {0x03BF,0x0314,0x1F41},
+  {0x03C1,0x0313,0x1FE4}, {0x03C1,0x0314,0x1FE5}, {0x03C5,0x0300,0x1F7A}, {0x03C5,0x0301,0x03CD},
+  {0x03C5,0x0304,0x1FE1}, {0x03C5,0x0306,0x1FE0}, {0x03C5,0x0308,0x03CB}, {0x03C5,0x0313,0x1F50},
+  {0x03C5,0x0314,0x1F51}, {0x03C5,0x0342,0x1FE6}, {0x03C9,0x0300,0x1F7C}, {0x03C9,0x0301,0x03CE},
+  {0x03C9,0x0313,0x1F60}, {0x03C9,0x0314,0x1F61}, {0x03C9,0x0342,0x1FF6}, {0x03C9,0x0345,0x1FF3},
+  {0x03CA,0x0300,0x1FD2}, {0x03CA,0x0301,0x0390}, {0x03CA,0x0342,0x1FD7}, {0x03CB,0x0300,0x1FE2},
+  {0x03CB,0x0301,0x03B0}, {0x03CB,0x0342,0x1FE7}, {0x03CE,0x0345,0x1FF4}, {0x03D2,0x0301,0x03D3},
+  {0x03D2,0x0308,0x03D4}, {0x0406,0x0308,0x0407}, {0x0410,0x0306,0x04D0}, {0x0410,0x0308,0x04D2},
+  {0x0413,0x0301,0x0403}, {0x0415,0x0300,0x0400}, {0x0415,0x0306,0x04D6}, {0x0415,0x0308,0x0401},
+  {0x0416,0x0306,0x04C1}, {0x0416,0x0308,0x04DC}, {0x0417,0x0308,0x04DE}, {0x0418,0x0300,0x040D},
+  {0x0418,0x0304,0x04E2}, {0x0418,0x0306,0x0419}, {0x0418,0x0308,0x04E4}, {0x041A,0x0301,0x040C},
+  {0x041E,0x0308,0x04E6}, {0x0423,0x0304,0x04EE}, {0x0423,0x0306,0x040E}, {0x0423,0x0308,0x04F0},
+  {0x0423,0x030B,0x04F2}, {0x0427,0x0308,0x04F4}, {0x042B,0x0308,0x04F8}, {0x042D,0x0308,0x04EC},
+  {0x0430,0x0306,0x04D1}, {0x0430,0x0308,0x04D3}, {0x0433,0x0301,0x0453}, {0x0435,0x0300,0x0450},
+  {0x0435,0x0306,0x04D7}, {0x0435,0x0308,0x0451}, {0x0436,0x0306,0x04C2}, {0x0436,0x0308,0x04DD},
+  {0x0437,0x0308,0x04DF}, {0x0438,0x0300,0x045D}, {0x0438,0x0304,0x04E3}, {0x0438,0x0306,0x0439},
+  {0x0438,0x0308,0x04E5}, {0x043A,0x0301,0x045C}, {0x043E,0x0308,0x04E7}, {0x0443,0x0304,0x04EF},
+  {0x0443,0x0306,0x045E}, {0x0443,0x0308,0x04F1}, {0x0443,0x030B,0x04F3}, {0x0447,0x0308,0x04F5},
+  {0x044B,0x0308,0x04F9}, {0x044D,0x0308,0x04ED}, {0x0456,0x0308,0x0457}, {0x0474,0x030F,0x0476},
+  {0x0475,0x030F,0x0477}, {0x04D8,0x0308,0x04DA}, {0x04D9,0x0308,0x04DB}, {0x04E8,0x0308,0x04EA},
+  {0x04E9,0x0308,0x04EB}, {0x0627,0x0653,0x0622}, {0x0627,0x0654,0x0623}, {0x0627,0x0655,0x0625},
+  {0x0648,0x0654,0x0624}, {0x064A,0x0654,0x0626}, {0x06C1,0x0654,0x06C2}, {0x06D2,0x0654,0x06D3},
+  {0x06D5,0x0654,0x06C0}, {0x0928,0x093C,0x0929}, {0x0930,0x093C,0x0931}, {0x0933,0x093C,0x0934},
+  {0x09C7,0x09BE,0x09CB}, {0x09C7,0x09D7,0x09CC}, {0x0B47,0x0B3E,0x0B4B}, {0x0B47,0x0B56,0x0B48},
+  {0x0B47,0x0B57,0x0B4C}, {0x0B92,0x0BD7,0x0B94}, {0x0BC6,0x0BBE,0x0BCA}, {0x0BC6,0x0BD7,0x0BCC},
+  {0x0BC7,0x0BBE,0x0BCB}, {0x0C46,0x0C56,0x0C48}, {0x0CBF,0x0CD5,0x0CC0}, {0x0CC6,0x0CC2,0x0CCA},
+  {0x0CC6,0x0CD5,0x0CC7}, {0x0CC6,0x0CD6,0x0CC8}, {0x0CCA,0x0CD5,0x0CCB}, {0x0D46,0x0D3E,0x0D4A},
+  {0x0D46,0x0D57,0x0D4C}, {0x0D47,0x0D3E,0x0D4B}, {0x0DD9,0x0DCA,0x0DDA}, {0x0DD9,0x0DCF,0x0DDC},
+  {0x0DD9,0x0DDF,0x0DDE}, {0x0DDC,0x0DCA,0x0DDD}, {0x1025,0x102E,0x1026}, {0x1B05,0x1B35,0x1B06},
+  {0x1B07,0x1B35,0x1B08}, {0x1B09,0x1B35,0x1B0A}, {0x1B0B,0x1B35,0x1B0C}, {0x1B0D,0x1B35,0x1B0E},
+  {0x1B11,0x1B35,0x1B12}, {0x1B3A,0x1B35,0x1B3B}, {0x1B3C,0x1B35,0x1B3D}, {0x1B3E,0x1B35,0x1B40},
+  {0x1B3F,0x1B35,0x1B41}, {0x1B42,0x1B35,0x1B43}, {0x1E36,0x0304,0x1E38}, {0x1E37,0x0304,0x1E39},
+  {0x1E5A,0x0304,0x1E5C}, {0x1E5B,0x0304,0x1E5D}, {0x1E62,0x0307,0x1E68}, {0x1E63,0x0307,0x1E69},
+  {0x1EA0,0x0302,0x1EAC}, {0x1EA0,0x0306,0x1EB6}, {0x1EA1,0x0302,0x1EAD}, {0x1EA1,0x0306,0x1EB7},
+  {0x1EB8,0x0302,0x1EC6}, {0x1EB9,0x0302,0x1EC7}, {0x1ECC,0x0302,0x1ED8}, {0x1ECD,0x0302,0x1ED9},
+  {0x1F00,0x0300,0x1F02}, {0x1F00,0x0301,0x1F04}, {0x1F00,0x0342,0x1F06}, {0x1F00,0x0345,0x1F80},
+  {0x1F01,0x0300,0x1F03}, {0x1F01,0x0301,0x1F05}, {0x1F01,0x0342,0x1F07}, {0x1F01,0x0345,0x1F81},
+  {0x1F02,0x0345,0x1F82}, {0x1F03,0x0345,0x1F83}, {0x1F04,0x0345,0x1F84}, {0x1F05,0x0345,0x1F85},
+  {0x1F06,0x0345,0x1F86}, {0x1F07,0x0345,0x1F87}, {0x1F08,0x0300,0x1F0A}, {0x1F08,0x0301,0x1F0C},
+  {0x1F08,0x0342,0x1F0E}, {0x1F08,0x0345,0x1F88}, {0x1F09,0x0300,0x1F0B}, {0x1F09,0x0301,0x1F0D},
+  {0x1F09,0x0342,0x1F0F}, {0x1F09,0x0345,0x1F89}, {0x1F0A,0x0345,0x1F8A}, {0x1F0B,0x0345,0x1F8B},
+  {0x1F0C,0x0345,0x1F8C}, {0x1F0D,0x0345,0x1F8D}, {0x1F0E,0x0345,0x1F8E}, {0x1F0F,0x0345,0x1F8F},
+  {0x1F10,0x0300,0x1F12}, {0x1F10,0x0301,0x1F14}, {0x1F11,0x0300,0x1F13}, {0x1F11,0x0301,0x1F15},
+  {0x1F18,0x0300,0x1F1A}, {0x1F18,0x0301,0x1F1C}, {0x1F19,0x0300,0x1F1B}, {0x1F19,0x0301,0x1F1D},
+  {0x1F20,0x0300,0x1F22}, {0x1F20,0x0301,0x1F24}, {0x1F20,0x0342,0x1F26}, {0x1F20,0x0345,0x1F90},
+  {0x1F21,0x0300,0x1F23}, {0x1F21,0x0301,0x1F25}, {0x1F21,0x0342,0x1F27}, {0x1F21,0x0345,0x1F91},
+  {0x1F22,0x0345,0x1F92}, {0x1F23,0x0345,0x1F93}, {0x1F24,0x0345,0x1F94}, {0x1F25,0x0345,0x1F95},
+  {0x1F26,0x0345,0x1F96}, {0x1F27,0x0345,0x1F97}, {0x1F28,0x0300,0x1F2A}, {0x1F28,0x0301,0x1F2C},
+  {0x1F28,0x0342,0x1F2E}, {0x1F28,0x0345,0x1F98}, {0x1F29,0x0300,0x1F2B}, {0x1F29,0x0301,0x1F2D},
+  {0x1F29,0x0342,0x1F2F}, {0x1F29,0x0345,0x1F99}, {0x1F2A,0x0345,0x1F9A}, {0x1F2B,0x0345,0x1F9B},
+  {0x1F2C,0x0345,0x1F9C}, {0x1F2D,0x0345,0x1F9D}, {0x1F2E,0x0345,0x1F9E}, {0x1F2F,0x0345,0x1F9F},
+  {0x1F30,0x0300,0x1F32}, {0x1F30,0x0301,0x1F34}, {0x1F30,0x0342,0x1F36}, {0x1F31,0x0300,0x1F33},
+  {0x1F31,0x0301,0x1F35}, {0x1F31,0x0342,0x1F37}, {0x1F38,0x0300,0x1F3A}, {0x1F38,0x0301,0x1F3C},
+  {0x1F38,0x0342,0x1F3E}, {0x1F39,0x0300,0x1F3B}, {0x1F39,0x0301,0x1F3D}, {0x1F39,0x0342,0x1F3F},
+  {0x1F40,0x0300,0x1F42}, {0x1F40,0x0301,0x1F44}, {0x1F41,0x0300,0x1F43}, {0x1F41,0x0301,0x1F45},
+  {0x1F48,0x0300,0x1F4A}, {0x1F48,0x0301,0x1F4C}, {0x1F49,0x0300,0x1F4B}, {0x1F49,0x0301,0x1F4D},
+  {0x1F50,0x0300,0x1F52}, {0x1F50,0x0301,0x1F54}, {0x1F50,0x0342,0x1F56}, {0x1F51,0x0300,0x1F53},
+  {0x1F51,0x0301,0x1F55}, {0x1F51,0x0342,0x1F57}, {0x1F59,0x0300,0x1F5B}, {0x1F59,0x0301,0x1F5D},
+  {0x1F59,0x0342,0x1F5F}, {0x1F60,0x0300,0x1F62}, {0x1F60,0x0301,0x1F64}, {0x1F60,0x0342,0x1F66},
+  {0x1F60,0x0345,0x1FA0}, {0x1F61,0x0300,0x1F63}, {0x1F61,0x0301,0x1F65}, {0x1F61,0x0342,0x1F67},
+  {0x1F61,0x0345,0x1FA1}, {0x1F62,0x0345,0x1FA2}, {0x1F63,0x0345,0x1FA3}, {0x1F64,0x0345,0x1FA4},
+  {0x1F65,0x0345,0x1FA5}, {0x1F66,0x0345,0x1FA6}, {0x1F67,0x0345,0x1FA7}, {0x1F68,0x0300,0x1F6A},
+  {0x1F68,0x0301,0x1F6C}, {0x1F68,0x0342,0x1F6E}, {0x1F68,0x0345,0x1FA8}, {0x1F69,0x0300,0x1F6B},
+  {0x1F69,0x0301,0x1F6D}, {0x1F69,0x0342,0x1F6F}, {0x1F69,0x0345,0x1FA9}, {0x1F6A,0x0345,0x1FAA},
+  {0x1F6B,0x0345,0x1FAB}, {0x1F6C,0x0345,0x1FAC}, {0x1F6D,0x0345,0x1FAD}, {0x1F6E,0x0345,0x1FAE},
+  {0x1F6F,0x0345,0x1FAF}, {0x1F70,0x0345,0x1FB2}, {0x1F74,0x0345,0x1FC2}, {0x1F7C,0x0345,0x1FF2},
+  {0x1FB6,0x0345,0x1FB7}, {0x1FBF,0x0300,0x1FCD}, {0x1FBF,0x0301,0x1FCE}, {0x1FBF,0x0342,0x1FCF},
+  {0x1FC6,0x0345,0x1FC7}, {0x1FF6,0x0345,0x1FF7}, {0x1FFE,0x0300,0x1FDD}, {0x1FFE,0x0301,0x1FDE},
+  {0x1FFE,0x0342,0x1FDF}, {0x2190,0x0338,0x219A}, {0x2192,0x0338,0x219B}, {0x2194,0x0338,0x21AE},
+  {0x21D0,0x0338,0x21CD}, {0x21D2,0x0338,0x21CF}, {0x21D4,0x0338,0x21CE}, {0x2203,0x0338,0x2204},
+  {0x2208,0x0338,0x2209}, {0x220B,0x0338,0x220C}, {0x2223,0x0338,0x2224}, {0x2225,0x0338,0x2226},
+  {0x223C,0x0338,0x2241}, {0x2243,0x0338,0x2244}, {0x2245,0x0338,0x2247}, {0x2248,0x0338,0x2249},
+  {0x224D,0x0338,0x226D}, {0x2261,0x0338,0x2262}, {0x2264,0x0338,0x2270}, {0x2265,0x0338,0x2271},
+  {0x2272,0x0338,0x2274}, {0x2273,0x0338,0x2275}, {0x2276,0x0338,0x2278}, {0x2277,0x0338,0x2279},
+  {0x227A,0x0338,0x2280}, {0x227B,0x0338,0x2281}, {0x227C,0x0338,0x22E0}, {0x227D,0x0338,0x22E1},
+  {0x2282,0x0338,0x2284}, {0x2283,0x0338,0x2285}, {0x2286,0x0338,0x2288}, {0x2287,0x0338,0x2289},
+  {0x2291,0x0338,0x22E2}, {0x2292,0x0338,0x22E3}, {0x22A2,0x0338,0x22AC}, {0x22A8,0x0338,0x22AD},
+  {0x22A9,0x0338,0x22AE}, {0x22AB,0x0338,0x22AF}, {0x22B2,0x0338,0x22EA}, {0x22B3,0x0338,0x22EB},
+  {0x22B4,0x0338,0x22EC}, {0x22B5,0x0338,0x22ED}, {0x3046,0x3099,0x3094}, {0x304B,0x3099,0x304C},
+  {0x304D,0x3099,0x304E}, {0x304F,0x3099,0x3050}, {0x3051,0x3099,0x3052}, {0x3053,0x3099,0x3054},
+  {0x3055,0x3099,0x3056}, {0x3057,0x3099,0x3058}, {0x3059,0x3099,0x305A}, {0x305B,0x3099,0x305C},
+  {0x305D,0x3099,0x305E}, {0x305F,0x3099,0x3060}, {0x3061,0x3099,0x3062}, {0x3064,0x3099,0x3065},
+  {0x3066,0x3099,0x3067}, {0x3068,0x3099,0x3069}, {0x306F,0x3099,0x3070}, {0x306F,0x309A,0x3071},
+  {0x3072,0x3099,0x3073}, {0x3072,0x309A,0x3074}, {0x3075,0x3099,0x3076}, {0x3075,0x309A,0x3077},
+  {0x3078,0x3099,0x3079}, {0x3078,0x309A,0x307A}, {0x307B,0x3099,0x307C}, {0x307B,0x309A,0x307D},
+  {0x309D,0x3099,0x309E}, {0x30A6,0x3099,0x30F4}, {0x30AB,0x3099,0x30AC}, {0x30AD,0x3099,0x30AE},
+  {0x30AF,0x3099,0x30B0}, {0x30B1,0x3099,0x30B2}, {0x30B3,0x3099,0x30B4}, {0x30B5,0x3099,0x30B6},
+  {0x30B7,0x3099,0x30B8}, {0x30B9,0x3099,0x30BA}, {0x30BB,0x3099,0x30BC}, {0x30BD,0x3099,0x30BE},
+  {0x30BF,0x3099,0x30C0}, {0x30C1,0x3099,0x30C2}, {0x30C4,0x3099,0x30C5}, {0x30C6,0x3099,0x30C7},
+  {0x30C8,0x3099,0x30C9}, {0x30CF,0x3099,0x30D0}, {0x30CF,0x309A,0x30D1}, {0x30D2,0x3099,0x30D3},
+  {0x30D2,0x309A,0x30D4}, {0x30D5,0x3099,0x30D6}, {0x30D5,0x309A,0x30D7}, {0x30D8,0x3099,0x30D9},
+  {0x30D8,0x309A,0x30DA}, {0x30DB,0x3099,0x30DC}, {0x30DB,0x309A,0x30DD}, {0x30EF,0x3099,0x30F7},
+  {0x30F0,0x3099,0x30F8}, {0x30F1,0x3099,0x30F9}, {0x30F2,0x3099,0x30FA}, {0x30FD,0x3099,0x30FE}
+};
+
+#endif
@@ -0,0 +1,218 @@
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include "ftcore.h"
+#include "ftpool.h"
+
+struct _ftpool_batch {
+  unsigned int pending;
+  pthread_mutex_t lock;
+  pthread_cond_t done;
+};
+
+/** the owner takes from the tail, thieves take from the head. */
+typedef struct _ftpool_deque {
+  pthread_mutex_t lock;
+  FTPOOL_TASK **items;
+  unsigned int head;
+  unsigned int tail;
+  unsigned int capacity;
+} FTPOOL_DEQUE;
+
+static FTPOOL_DEQUE *deques = NULL;
+static pthread_t *workers = NULL;
+static unsigned int pool_size = 0;
+static unsigned int deque_count = 0;
+static unsigned int pool_next = 0; // deque receiving the next batch's first task
+
+static pthread_mutex_t pool_lock;
+static pthread_cond_t pool_wake;
+static unsigned int pool_queued = 0;
+static int pool_quit = 0;
+
+static int deque_push(FTPOOL_DEQUE *dq, FTPOOL_TASK *task){
+  pthread_mutex_lock(&dq->lock);
+  if(dq->head == dq->tail){
+    dq->head = dq->tail = 0;
+  }
+  if(dq->tail == dq->capacity){
+    unsigned int sz = dq->capacity ? dq->capacity<<1 : 16;
+    FTPOOL_TASK **tmp = dq->items ? ftcore_realloc(dq->items, sz*sizeof(FTPOOL_TASK*)) : ftcore_malloc(sz*sizeof(FTPOOL_TASK*));
+    if(!tmp){
+      pthread_mutex_unlock(&dq->lock);
+      return -1;
+    }
+    dq->items = tmp;
+    dq->capacity = sz;
+  }
+  dq->items[dq->tail++] = task;
+  pthread_mutex_unlock(&dq->lock);
+  return 0;
+}
+
+static FTPOOL_TASK* deque_take(FTPOOL_DEQUE *dq, int steal){
+  FTPOOL_TASK *task = NULL;
+  pthread_mutex_lock(&dq->lock);
+  if(dq->head < dq->tail){
+    task = steal ? dq->items[dq->head++] : dq->items[--dq->tail];
+  }
+  pthread_mutex_unlock(&dq->lock);
+  if(task){
+    pthread_mutex_lock(&pool_lock);
+    pool_queued--;
+    pthread_mutex_unlock(&pool_lock);
+  }
+  return task;
+}
+
+/** takes a task from the own deque first (if any), then from the others. */
+static FTPOOL_TASK* find_task(int self){
+  FTPOOL_TASK *task = NULL;
+  unsigned int i;
+  if(self >= 0){
+    task = deque_take(&deques[self], 0);
+  }
+  for(i=1; !task && i<=pool_size; i++){
+    task = deque_take(&deques[(self + i) % pool_size], 1);
+  }
+  return task;
+}
+
+static void run_task(FTPOOL_TASK *task){
+  struct _ftpool_batch *batch = task->batch;
+  task->func(task->arg);
+  pthread_mutex_lock(&batch->lock);
+  if(--batch->pending == 0){
+    pthread_cond_signal(&batch->done);
+  }
+  pthread_mutex_unlock(&batch->lock);
+}
+
+static void* worker_main(void *arg){
+  int self = (int)(intptr_t)arg;
+  ftcore_thread_start();
+  while(1){
+    FTPOOL_TASK *task = find_task(self);
+    if(task){
+      run_task(task);
+      continue;
+    }
+    pthread_mutex_lock(&pool_lock);
+    while(!pool_quit && pool_queued == 0){
+      pthread_cond_wait(&pool_wake, &pool_lock);
+    }
+    if(pool_quit){
+      pthread_mutex_unlock(&pool_lock);
+      break;
+    }
+    pthread_mutex_unlock(&pool_lock);
+  }
+  ftcore_thread_end();
+  return NULL;
+}
+
+int ftpool_init(unsigned int threads){
+  unsigned int i;
+  pthread_mutex_init(&pool_lock, NULL);
+  pthread_cond_init(&pool_wake, NULL);
+  pool_quit = 0;
+  pool_queued = 0;
+  if(threads == 0){
+    return 0;
+  }
+  deques = (FTPOOL_DEQUE*)ftcore_malloc(threads*sizeof(FTPOOL_DEQUE));
+  workers = (pthread_t*)ftcore_malloc(threads*sizeof(pthread_t));
+  if(!deques || !workers){
+    ftpool_deinit();
+    return -1;
+  }
+  memset(deques, 0, threads*sizeof(FTPOOL_DEQUE));
+  for(i=0; i<threads; i++){
+    pthread_mutex_init(&deques[i].lock, NULL);
+  }
+  deque_count = threads;
+  pool_size = threads;
+  for(i=0; i<threads; i++){
+    if(pthread_create(&workers[i], NULL, worker_main, (void*)(intptr_t)i)){
+      pool_size = i; // run with the workers we got.
+      break;
+    }
+  }
+  return 0;
+}
+
+void ftpool_deinit(){
+  unsigned int i;
+  pthread_mutex_lock(&pool_lock);
+  pool_quit = 1;
+  pthread_cond_broadcast(&pool_wake);
+  pthread_mutex_unlock(&pool_lock);
+  for(i=0; i<pool_size; i++){
+    pthread_join(workers[i], NULL);
+  }
+  if(deques){
+    for(i=0; i<deque_count; i++){
+      if(deques[i].items){ ftcore_free(deques[i].items); }
+      pthread_mutex_destroy(&deques[i].lock);
+    }
+    ftcore_free(deques);
+  }
+  if(workers){ ftcore_free(workers); }
+  deques = NULL;
+  deque_count = 0;
+  workers = NULL;
+  pool_size = 0;
+  pthread_cond_destroy(&pool_wake);
+  pthread_mutex_destroy(&pool_lock);
+}
+
+unsigned int ftpool_size(){
+  return pool_size;
+}
+
+void ftpool_run(FTPOOL_TASK *tasks, unsigned int count){
+  struct _ftpool_batch batch;
+  unsigned int i;
+  
+  batch.pending = count;
+  pthread_mutex_init(&batch.lock, NULL);
+  pthread_cond_init(&batch.done, NULL);
+  
+  // counted before they are pushed, as a worker may take one at once.
+  pthread_mutex_lock(&pool_lock);
+  unsigned int first = pool_next++;
+  if(pool_size){
+    pool_queued += count;
+  }
+  pthread_mutex_unlock(&pool_lock);
+  for(i=0; i<count; i++){
+    tasks[i].batch = &batch;
+    if(pool_size == 0){
+      run_task(&tasks[i]);
+    }else if(deque_push(&deques[(first + i) % pool_size], &tasks[i])){
+      pthread_mutex_lock(&pool_lock);
+      pool_queued--;
+      pthread_mutex_unlock(&pool_lock);
+      run_task(&tasks[i]); // no memory to queue it.
+    }
+  }
+  if(pool_size){
+    pthread_mutex_lock(&pool_lock);
+    pthread_cond_broadcast(&pool_wake);
+    pthread_mutex_unlock(&pool_lock);
+  }
+  
+  // help out until nothing is left to take.
+  FTPOOL_TASK *task;
+  while(pool_size && (task = find_task(-1))){
+    run_task(task);
+  }
+  
+  pthread_mutex_lock(&batch.lock);
+  while(batch.pending > 0){
+    pthread_cond_wait(&batch.done, &batch.lock);
+  }
+  pthread_mutex_unlock(&batch.lock);
+  pthread_cond_destroy(&batch.done);
+  pthread_mutex_destroy(&batch.lock);
+}
@@ -0,0 +1,31 @@
+#ifndef FTPOOL_H
+#define FTPOOL_H
+
+#include <stddef.h>
+
+struct _ftpool_batch;
+
+typedef struct _ftpool_task {
+  void (*func)(void *arg);
+  void *arg;
+  struct _ftpool_batch *batch; // set by ftpool_run()
+} FTPOOL_TASK;
+
+/**
+ * Starts a pool of worker threads. Each worker has its own task deque and
+ * steals from the others when it runs dry.
+ * @param threads number of workers. 0 starts nothing.
+ * @return 0 on success
+ */
+int  ftpool_init(unsigned int threads);
+void ftpool_deinit();
+/** @return number of running workers */
+unsigned int ftpool_size();
+/**
+ * Runs all tasks on the pool and returns when they are finished. The calling
+ * thread works on queued tasks while it waits. Tasks run in no particular
+ * order.
+ */
+void ftpool_run(FTPOOL_TASK *tasks, unsigned int count);
+
+#endif
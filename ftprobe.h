@@ -0,0 +1,28 @@
+#ifndef FTPROBE_H
+#define FTPROBE_H
+
+/**
+ * USDT probes of provider ftsnowball, for perf and bpftrace, e.g.
+ *   bpftrace -e 'usdt:/usr/lib/mysql/plugin/libftsnowball.so:ftsnowball:parse_end { @[arg1] = count(); }'
+ * A probe nobody attached to is a nop in the code. Without sys/sdt.h
+ * (configure checks for it, --disable-probes skips it) they compile to
+ * nothing.
+ *
+ *   parse_begin(length, charset number, mode)   parse_end(tokens, result)
+ *   cache_hit(length)    cache_miss(length)     arena_grow(bytes)
+ *   normalize_begin(length)                     normalize_end(length, 0 on failure)
+ *   stem_begin(length)   stem_end(length of the stem, -1 on failure)
+ */
+
+#if defined(HAVE_SYS_SDT_H)
+#include <sys/sdt.h>
+#define FTPROBE1(name, a)       DTRACE_PROBE1(ftsnowball, name, a)
+#define FTPROBE2(name, a, b)    DTRACE_PROBE2(ftsnowball, name, a, b)
+#define FTPROBE3(name, a, b, c) DTRACE_PROBE3(ftsnowball, name, a, b, c)
+#else
+#define FTPROBE1(name, a)       do{}while(0)
+#define FTPROBE2(name, a, b)    do{}while(0)
+#define FTPROBE3(name, a, b, c) do{}while(0)
+#endif
+
+#endif
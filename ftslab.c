@@ -0,0 +1,262 @@
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "ftcore.h"
+#include "ftslab.h"
+
+#define FTSLAB_CLASSES    9            // 16, 32 ... 4096 bytes
+#define FTSLAB_MIN_SHIFT  4
+#define FTSLAB_MAX_SIZE   (1 << (FTSLAB_MIN_SHIFT + FTSLAB_CLASSES - 1))
+#define FTSLAB_LARGE      0xFFFFFFFFU  // class of a block from ftcore_malloc()
+#define FTSLAB_SLAB_BYTES (64 * 1024)
+#define FTSLAB_CACHE_BYTES (32 * 1024) // free bytes a thread keeps per class
+
+/** in front of every block, 16 bytes to keep the blocks aligned for ICU */
+struct ftslab_header {
+  uint32_t klass;
+  uint32_t pad[3];
+};
+
+/** a free block links to the next through its first bytes */
+struct ftslab_block {
+  struct ftslab_block *next;
+};
+
+struct ftslab_pool {
+  pthread_mutex_t lock;
+  struct ftslab_block *free;
+  unsigned int count;
+};
+
+struct ftslab_cache {
+  unsigned int generation; // the ftslab_init() the cache was registered with
+  struct ftslab_block *free[FTSLAB_CLASSES];
+  unsigned int count[FTSLAB_CLASSES];
+  unsigned long allocs;
+};
+
+unsigned long ftslab_allocs = 0;
+unsigned long ftslab_pool_visits = 0;
+unsigned long ftslab_large = 0;
+unsigned long ftslab_bytes = 0;
+
+static struct ftslab_pool ftslab_pools[FTSLAB_CLASSES];
+static pthread_once_t ftslab_once = PTHREAD_ONCE_INIT;
+static pthread_key_t ftslab_key;
+static unsigned int ftslab_generation = 0; // odd between ftslab_init() and ftslab_deinit()
+static __thread struct ftslab_cache ftslab_cache;
+
+static unsigned int ftslab_class(size_t size){
+  unsigned int k = 0;
+  size_t cap = (size_t)1 << FTSLAB_MIN_SHIFT;
+  while(cap < size){
+    cap <<= 1;
+    k++;
+  }
+  return k;
+}
+
+static size_t ftslab_class_size(unsigned int k){
+  return (size_t)1 << (FTSLAB_MIN_SHIFT + k);
+}
+
+/** free blocks a thread keeps of a class; it gives back half when over. */
+static unsigned int ftslab_cache_limit(unsigned int k){
+  size_t n = FTSLAB_CACHE_BYTES / ftslab_class_size(k);
+  return n < 8 ? 8 : (n > 128 ? 128 : (unsigned int)n);
+}
+
+/** moves the blocks over keep of a cache into the pool. */
+static void ftslab_give_back(struct ftslab_cache *cache, unsigned int k, unsigned int keep){
+  struct ftslab_pool *pool = &ftslab_pools[k];
+  pthread_mutex_lock(&pool->lock);
+  while(cache->count[k] > keep){
+    struct ftslab_block *b = cache->free[k];
+    cache->free[k] = b->next;
+    cache->count[k]--;
+    b->next = pool->free;
+    pool->free = b;
+    pool->count++;
+  }
+  pthread_mutex_unlock(&pool->lock);
+  __atomic_fetch_add(&ftslab_pool_visits, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&ftslab_allocs, cache->allocs, __ATOMIC_RELAXED);
+  cache->allocs = 0;
+}
+
+/** thread exit: the cached blocks go back to the pools. */
+static void ftslab_cache_flush(void *arg){
+  struct ftslab_cache *cache = (struct ftslab_cache*)arg;
+  unsigned int k;
+  for(k=0; k<FTSLAB_CLASSES; k++){
+    if(cache->count[k]){
+      ftslab_give_back(cache, k, 0);
+    }
+  }
+  cache->generation = 0; // blocks freed by later destructors register it again
+}
+
+/** cuts a new slab into blocks of class k. called with the pool locked. */
+static int ftslab_carve(struct ftslab_pool *pool, unsigned int k){
+  size_t block = sizeof(struct ftslab_header) + ftslab_class_size(k);
+  char *slab = (char*)ftcore_malloc(FTSLAB_SLAB_BYTES);
+  char *pos;
+  if(!slab){
+    return -1;
+  }
+  for(pos = slab; pos + block <= slab + FTSLAB_SLAB_BYTES; pos += block){
+    struct ftslab_header *h = (struct ftslab_header*)pos;
+    struct ftslab_block *b = (struct ftslab_block*)(h + 1);
+    h->klass = k;
+    b->next = pool->free;
+    pool->free = b;
+    pool->count++;
+  }
+  __atomic_fetch_add(&ftslab_bytes, FTSLAB_SLAB_BYTES, __ATOMIC_RELAXED);
+  return 0;
+}
+
+/** takes half a cache worth of blocks from the pool. */
+static int ftslab_refill(struct ftslab_cache *cache, unsigned int k){
+  struct ftslab_pool *pool = &ftslab_pools[k];
+  unsigned int want = ftslab_cache_limit(k) / 2;
+  pthread_mutex_lock(&pool->lock);
+  if(!pool->free && ftslab_carve(pool, k)){
+    pthread_mutex_unlock(&pool->lock);
+    return -1;
+  }
+  while(pool->free && cache->count[k] < want){
+    struct ftslab_block *b = pool->free;
+    pool->free = b->next;
+    pool->count--;
+    b->next = cache->free[k];
+    cache->free[k] = b;
+    cache->count[k]++;
+  }
+  pthread_mutex_unlock(&pool->lock);
+  __atomic_fetch_add(&ftslab_pool_visits, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&ftslab_allocs, cache->allocs, __ATOMIC_RELAXED);
+  cache->allocs = 0;
+  return 0;
+}
+
+/** @return the cache of the thread, registered for the flush at thread exit */
+static struct ftslab_cache* ftslab_thread_cache(void){
+  struct ftslab_cache *cache = &ftslab_cache;
+  if(cache->generation != ftslab_generation){
+    cache->generation = ftslab_generation;
+    pthread_setspecific(ftslab_key, cache);
+  }
+  return cache;
+}
+
+static void ftslab_pools_init(void){
+  unsigned int k;
+  for(k=0; k<FTSLAB_CLASSES; k++){
+    pthread_mutex_init(&ftslab_pools[k].lock, NULL);
+  }
+}
+
+int ftslab_init(void){
+  pthread_once(&ftslab_once, ftslab_pools_init);
+  if(pthread_key_create(&ftslab_key, ftslab_cache_flush)){
+    return -1;
+  }
+  ftslab_generation++;
+  return 0;
+}
+
+void ftslab_deinit(void){
+  if(ftslab_cache.generation == ftslab_generation){
+    ftslab_cache_flush(&ftslab_cache);
+  }
+  // other threads keep their blocks. deleting the key keeps the flush from
+  // running after the code is unloaded.
+  pthread_key_delete(ftslab_key);
+  ftslab_generation++;
+}
+
+static void* ftslab_malloc_large(size_t size){
+  struct ftslab_header *h = (struct ftslab_header*)ftcore_malloc(sizeof(struct ftslab_header) + size);
+  if(!h){
+    return NULL;
+  }
+  h->klass = FTSLAB_LARGE;
+  __atomic_fetch_add(&ftslab_large, 1, __ATOMIC_RELAXED);
+  return h + 1;
+}
+
+void* ftslab_malloc(size_t size){
+  struct ftslab_cache *cache;
+  struct ftslab_block *b;
+  unsigned int k;
+  if(size > FTSLAB_MAX_SIZE || (ftslab_generation & 1) == 0){
+    return ftslab_malloc_large(size); // too large, or between deinit and init
+  }
+  k = ftslab_class(size);
+  cache = ftslab_thread_cache();
+  if(!cache->free[k] && ftslab_refill(cache, k)){
+    return NULL;
+  }
+  b = cache->free[k];
+  cache->free[k] = b->next;
+  cache->count[k]--;
+  cache->allocs++;
+  return b;
+}
+
+void ftslab_free(void *ptr){
+  struct ftslab_header *h;
+  struct ftslab_cache *cache;
+  struct ftslab_block *b = (struct ftslab_block*)ptr;
+  unsigned int k;
+  if(!ptr){
+    return;
+  }
+  h = (struct ftslab_header*)ptr - 1;
+  if(h->klass == FTSLAB_LARGE){
+    ftcore_free(h);
+    return;
+  }
+  k = h->klass;
+  if((ftslab_generation & 1) == 0){
+    struct ftslab_pool *pool = &ftslab_pools[k]; // no thread caches without the key
+    pthread_mutex_lock(&pool->lock);
+    b->next = pool->free;
+    pool->free = b;
+    pool->count++;
+    pthread_mutex_unlock(&pool->lock);
+    return;
+  }
+  cache = ftslab_thread_cache();
+  b->next = cache->free[k];
+  cache->free[k] = b;
+  if(++cache->count[k] > ftslab_cache_limit(k)){
+    ftslab_give_back(cache, k, ftslab_cache_limit(k) / 2);
+  }
+}
+
+void* ftslab_realloc(void *ptr, size_t size){
+  struct ftslab_header *h;
+  void *tmp;
+  size_t old;
+  if(!ptr){
+    return ftslab_malloc(size);
+  }
+  h = (struct ftslab_header*)ptr - 1;
+  if(h->klass == FTSLAB_LARGE){
+    h = (struct ftslab_header*)ftcore_realloc(h, sizeof(struct ftslab_header) + size);
+    return h ? h + 1 : NULL;
+  }
+  old = ftslab_class_size(h->klass);
+  if(size <= old){
+    return ptr;
+  }
+  tmp = ftslab_malloc(size);
+  if(!tmp){
+    return NULL;
+  }
+  memcpy(tmp, ptr, old);
+  ftslab_free(ptr);
+  return tmp;
+}
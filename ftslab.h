@@ -0,0 +1,33 @@
+#ifndef FTSLAB_H
+#define FTSLAB_H
+
+#include <stddef.h>
+
+/**
+ * Size class allocator for the small, short lived blocks of ICU and the
+ * stemmers. Each thread keeps some free blocks of every class and visits
+ * the shared pool of a class, under its own lock, only to take or give
+ * back a batch. Slabs and blocks larger than the largest class come from
+ * ftcore_malloc().
+ *
+ * Slabs are kept until the process exits: ICU holds on to data allocated
+ * through its memory functions after the plugin is deinitialized.
+ */
+
+/** blocks handed out. threads add theirs when they visit the pool. */
+extern unsigned long ftslab_allocs;
+/** batches taken from or given back to the pools */
+extern unsigned long ftslab_pool_visits;
+/** allocations too large for a class */
+extern unsigned long ftslab_large;
+/** bytes of slabs */
+extern unsigned long ftslab_bytes;
+
+int   ftslab_init(void);
+/** stops the thread caches from being flushed at thread exit. */
+void  ftslab_deinit(void);
+void* ftslab_malloc(size_t size);
+void* ftslab_realloc(void *ptr, size_t size);
+void  ftslab_free(void *ptr);
+
+#endif
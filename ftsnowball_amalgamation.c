@@ -0,0 +1,27 @@
+/**
+ * Single translation unit build of the plugin and the libstemmer API
+ * (configure --enable-amalgamation), so that the compiler can inline the
+ * stemmer entry points into the parser loop. The stemming modules can not
+ * be merged into one unit, as the generated sources share static names;
+ * they are compiled with the runtime of libstemmer_c/runtime/inline.h
+ * instead.
+ */
+#undef SNOWBALL_AMALGAMATION
+
+#include "libstemmer_c/runtime/api.c"
+#include "libstemmer_c/libstemmer/libstemmer.c"
+
+#include "ftcore.c"
+#include "ftdict.c"
+#include "ftstring.c"
+#include "ftbool.c"
+#include "ftnorm.c"
+#include "fthash.c"
+#include "ftcache.c"
+#include "ftpool.c"
+#include "ftlog.c"
+#include "ftcapture.c"
+#include "ftslab.c"
+#include "ftconv.c"
+#include "ftbreak.c"
+#include "plugin_snowball.c"
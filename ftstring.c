@@ -1,6 +1,5 @@
-#include <my_global.h>
-#include <my_sys.h>
-#include <m_string.h>
+#include <string.h>
+#include "ftcore.h"
 #include "ftstring.h"
 
 /**
@@ -18,9 +17,9 @@ static void ftstring_expand(FTSTRING *str, int capacity){
   }
   
   if(str->buffer == NULL){
-    str->buffer = my_malloc(len, MYF(MY_WME));
+    str->buffer = ftcore_malloc(len);
   }else{
-		char* tmp = my_realloc(str->buffer, len, MYF(MY_WME));
+		char* tmp = ftcore_realloc(str->buffer, len);
 		if(tmp){ str->buffer = tmp; }
   }
   str->buffer_length = len;
@@ -46,7 +45,7 @@ void ftstring_reset(FTSTRING *str){
 
 void ftstring_destroy(FTSTRING *str){
   if(str->buffer){
-    my_free(str->buffer);
+    ftcore_free(str->buffer);
   }
 }
 
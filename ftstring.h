@@ -1,3 +1,6 @@
+#ifndef FTSTRING_H
+#define FTSTRING_H
+
 typedef struct _ftstring_buffer {
   char* start;
   int   length;
@@ -14,3 +17,5 @@ void  ftstring_bind(FTSTRING *str, char* src, int rewritable);
 void  ftstring_unbind(FTSTRING *str);
 void  ftstring_reset(FTSTRING *str);
 int   ftstring_internal(FTSTRING *str);
+
+#endif
@@ -1,12 +1,33 @@
 
+#ifndef SB_LIBSTEMMER_H
+#define SB_LIBSTEMMER_H
+
+#include <stddef.h>
+
 /* Make header file work when included from C++ */
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 struct sb_stemmer;
+struct sb_stemmer_module;
+struct SN_env;
 typedef unsigned char sb_symbol;
 
+/** Per-call stemming workspace.
+ *
+ *  A scratch holds the mutable state a module needs while it stems a word.
+ *  It is small enough to live on the stack or in thread-local storage and
+ *  must be initialised with SB_STEMMER_SCRATCH_INIT.  A scratch must not be
+ *  used by two threads at the same time, but it may be used with different
+ *  modules in turn; it is rebound to the module on first use.
+ */
+struct sb_stemmer_scratch {
+    const struct sb_stemmer_module * module;
+    struct SN_env * env;
+};
+#define SB_STEMMER_SCRATCH_INIT { 0, 0 }
+
 /* FIXME - should be able to get a version number for each stemming
  * algorithm (which will be incremented each time the output changes). */
 
@@ -73,7 +94,48 @@ const sb_symbol *   sb_stemmer_stem(struct sb_stemmer * stemmer,
  */
 int                 sb_stemmer_length(struct sb_stemmer * stemmer);
 
+/** Look up the module for an algorithm and character encoding.
+ *
+ *  The arguments are the same as for sb_stemmer_new().  The returned
+ *  handle is immutable, is never freed and may be shared by any number of
+ *  threads.  Nothing is allocated by this call.
+ *
+ *  @return NULL if the algorithm is not available for the encoding.
+ */
+const struct sb_stemmer_module * sb_stemmer_module_get(const char * algorithm,
+                                                       const char * charenc);
+
+/** Stem a word with a shared module, using the caller's scratch.
+ *
+ *  The return value is owned by the scratch and becomes invalid when the
+ *  scratch is used again or released.  Its length can be obtained using
+ *  sb_stemmer_scratch_length().
+ *
+ *  If an out-of-memory error occurs, this will return NULL.
+ */
+const sb_symbol *   sb_stemmer_module_stem(const struct sb_stemmer_module * module,
+                                           struct sb_stemmer_scratch * scratch,
+                                           const sb_symbol * word, int size);
+
+/** Get the length of the result of the last word stemmed with a scratch.
+ */
+int                 sb_stemmer_scratch_length(const struct sb_stemmer_scratch * scratch);
+
+/** Free the resources held by a scratch.  The scratch may be reused
+ *  afterwards.  It is safe to pass a scratch that was never used.
+ */
+void                sb_stemmer_scratch_release(struct sb_stemmer_scratch * scratch);
+
+/** Make the stemmers allocate through the given functions instead of
+ *  malloc(), realloc() and free().  Call it while no stemmer or scratch
+ *  holds memory.  NULL functions restore the defaults.
+ */
+void                sb_stemmer_set_allocator(void * (* malloc_fn)(size_t),
+                                             void * (* realloc_fn)(void *, size_t),
+                                             void (* free_fn)(void *));
+
 #ifdef __cplusplus
 }
 #endif
 
+#endif /* SB_LIBSTEMMER_H */
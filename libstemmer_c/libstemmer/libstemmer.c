@@ -1,18 +1,133 @@
 
+/* With --enable-amalgamation this file is compiled as part of
+ * ftsnowball_amalgamation.c instead of libstemmer.la.
+ */
+#ifndef SNOWBALL_AMALGAMATION
+
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "../include/libstemmer.h"
-#include "../runtime/api.h"
+#include "../runtime/header.h"
+#include "ftprobe.h"
+#if defined(SNOWBALL_MODULE_DIR)
+#include <stdio.h>
+#include <dlfcn.h>
+#include "modules_split.h"
+#elif defined(SB_MODULES_HEADER)
+#include SB_MODULES_HEADER
+#else
 #include "modules.h"
+#endif
 
-struct sb_stemmer {
+struct sb_stemmer_module {
     struct SN_env * (*create)(void);
     void (*close)(struct SN_env *);
     int (*stem)(struct SN_env *);
+};
 
-    struct SN_env * env;
+struct sb_stemmer {
+    const struct sb_stemmer_module * module;
+    struct sb_stemmer_scratch scratch;
 };
 
+/* Module registry.
+ *
+ * (name, encoding) pairs are found through an open addressing hash built
+ * once on first use.  Each entry of modules[] has a handle in
+ * sb_module_handles[]; handles are filled in at registry build time, or, in
+ * the split build, when the module's shared object is first loaded.  A
+ * handle is never changed once filled in.
+ */
+#define SB_MODULE_COUNT (sizeof(modules) / sizeof(modules[0]) - 1)
+#define SB_HASH_SIZE 512
+
+/* keep the hash at most half full */
+typedef char sb_module_hash_size_check[SB_MODULE_COUNT * 2 <= SB_HASH_SIZE ? 1 : -1];
+
+static struct sb_stemmer_module sb_module_handles[SB_MODULE_COUNT];
+static short sb_module_hash[SB_HASH_SIZE]; /* index into modules[] + 1 */
+static pthread_once_t sb_registry_once = PTHREAD_ONCE_INIT;
+#if defined(SNOWBALL_MODULE_DIR)
+static pthread_mutex_t sb_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+/* each module object has its own runtime, told about the allocator on load */
+static void * sb_module_libs[SB_MODULE_COUNT];
+#endif
+
+static unsigned int
+sb_module_hash_key(const char * name, stemmer_encoding_t enc)
+{
+    /* FNV-1a */
+    unsigned int h = 2166136261U;
+    while (*name) {
+        h ^= (unsigned char) *name++;
+        h *= 16777619U;
+    }
+    h ^= (unsigned int) enc;
+    h *= 16777619U;
+    return h;
+}
+
+static void
+sb_registry_init(void)
+{
+    unsigned int i;
+    for (i = 0; i < SB_MODULE_COUNT; i++) {
+        unsigned int slot = sb_module_hash_key(modules[i].name, modules[i].enc);
+        while (sb_module_hash[slot & (SB_HASH_SIZE - 1)] != 0) slot++;
+        sb_module_hash[slot & (SB_HASH_SIZE - 1)] = (short) (i + 1);
+#if !defined(SNOWBALL_MODULE_DIR)
+        sb_module_handles[i].create = modules[i].create;
+        sb_module_handles[i].close = modules[i].close;
+        sb_module_handles[i].stem = modules[i].stem;
+#endif
+    }
+}
+
+#if defined(SNOWBALL_MODULE_DIR)
+/* Hands the allocator of this runtime to the runtime of a module object. */
+static void
+sb_module_set_allocator(void * lib)
+{
+    void (* set)(void * (*)(size_t), void * (*)(void *, size_t), void (*)(void *));
+    *(void **) (&set) = dlsym(lib, "sn_set_allocator");
+    if (set != NULL) set(sn_malloc, sn_realloc, sn_free);
+}
+
+/* Load the shared object of a module and fill in its handle.  Called with
+ * sb_registry_lock held.  A module that is shared by several aliases is
+ * opened once per alias; dlopen() returns the same object each time.
+ */
+static int
+sb_module_load(const struct stemmer_modules * module,
+               struct sb_stemmer_module * handle)
+{
+    char path[1024];
+    char sym[128];
+    void * lib;
+    struct sb_stemmer_module tmp;
+
+    snprintf(path, sizeof(path), "%s/%s.so", SNOWBALL_MODULE_DIR, module->object);
+    lib = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (lib == NULL) return -1;
+
+    snprintf(sym, sizeof(sym), "%s_create_env", module->prefix);
+    *(void **) (&tmp.create) = dlsym(lib, sym);
+    snprintf(sym, sizeof(sym), "%s_close_env", module->prefix);
+    *(void **) (&tmp.close) = dlsym(lib, sym);
+    snprintf(sym, sizeof(sym), "%s_stem", module->prefix);
+    *(void **) (&tmp.stem) = dlsym(lib, sym);
+    if (tmp.create == NULL || tmp.close == NULL || tmp.stem == NULL) {
+        dlclose(lib);
+        return -1;
+    }
+    sb_module_set_allocator(lib);
+    sb_module_libs[module - modules] = lib;
+    *handle = tmp;
+    return 0;
+}
+#endif
+
 extern const char **
 sb_stemmer_list(void)
 {
@@ -31,30 +146,102 @@ sb_getenc(const char * charenc)
     return encoding->enc;
 }
 
-extern struct sb_stemmer *
-sb_stemmer_new(const char * algorithm, const char * charenc)
+extern const struct sb_stemmer_module *
+sb_stemmer_module_get(const char * algorithm, const char * charenc)
 {
     stemmer_encoding_t enc;
-    struct stemmer_modules * module;
-    struct sb_stemmer * stemmer;
+    unsigned int slot;
+    short i;
+    struct sb_stemmer_module * handle;
 
     enc = sb_getenc(charenc);
     if (enc == ENC_UNKNOWN) return NULL;
+    if (pthread_once(&sb_registry_once, sb_registry_init) != 0) return NULL;
+
+    slot = sb_module_hash_key(algorithm, enc);
+    while ((i = sb_module_hash[slot & (SB_HASH_SIZE - 1)]) != 0) {
+        if (modules[i - 1].enc == enc && strcmp(modules[i - 1].name, algorithm) == 0) break;
+        slot++;
+    }
+    if (i == 0) return NULL;
+
+    handle = &sb_module_handles[i - 1];
+#if defined(SNOWBALL_MODULE_DIR)
+    pthread_mutex_lock(&sb_registry_lock);
+    if (handle->stem == NULL && sb_module_load(&modules[i - 1], handle) != 0)
+        handle = NULL;
+    pthread_mutex_unlock(&sb_registry_lock);
+#endif
+    return handle;
+}
 
-    for (module = modules; module->name != 0; module++) {
-	if (strcmp(module->name, algorithm) == 0 && module->enc == enc) break;
+const sb_symbol *
+sb_stemmer_module_stem(const struct sb_stemmer_module * module,
+                       struct sb_stemmer_scratch * scratch,
+                       const sb_symbol * word, int size)
+{
+    int ret;
+    FTPROBE1(stem_begin, size);
+    if (scratch->module != module || scratch->env == NULL)
+    {
+        sb_stemmer_scratch_release(scratch);
+        scratch->env = module->create();
+        if (scratch->env == NULL)
+        {
+            FTPROBE1(stem_end, -1);
+            return NULL;
+        }
+        scratch->module = module;
     }
-    if (module->name == NULL) return NULL;
+    if (SN_set_current(scratch->env, size, (const symbol *)(word)))
+    {
+        scratch->env->l = 0;
+        FTPROBE1(stem_end, -1);
+        return NULL;
+    }
+    ret = module->stem(scratch->env);
+    if (ret < 0)
+    {
+        FTPROBE1(stem_end, -1);
+        return NULL;
+    }
+    scratch->env->p[scratch->env->l] = 0;
+    FTPROBE1(stem_end, scratch->env->l);
+    return (const sb_symbol *)(scratch->env->p);
+}
+
+int
+sb_stemmer_scratch_length(const struct sb_stemmer_scratch * scratch)
+{
+    return scratch->env->l;
+}
+
+void
+sb_stemmer_scratch_release(struct sb_stemmer_scratch * scratch)
+{
+    if (scratch == 0) return;
+    if (scratch->module != 0 && scratch->env != 0)
+        scratch->module->close(scratch->env);
+    scratch->module = 0;
+    scratch->env = 0;
+}
+
+extern struct sb_stemmer *
+sb_stemmer_new(const char * algorithm, const char * charenc)
+{
+    const struct sb_stemmer_module * module;
+    struct sb_stemmer * stemmer;
+
+    module = sb_stemmer_module_get(algorithm, charenc);
+    if (module == NULL) return NULL;
     
     stemmer = (struct sb_stemmer *) malloc(sizeof(struct sb_stemmer));
     if (stemmer == NULL) return NULL;
 
-    stemmer->create = module->create;
-    stemmer->close = module->close;
-    stemmer->stem = module->stem;
-
-    stemmer->env = stemmer->create();
-    if (stemmer->env == NULL)
+    stemmer->module = module;
+    stemmer->scratch.module = module;
+    stemmer->scratch.env = module->create();
+    if (stemmer->scratch.env == NULL)
     {
         sb_stemmer_delete(stemmer);
         return NULL;
@@ -67,29 +254,38 @@ void
 sb_stemmer_delete(struct sb_stemmer * stemmer)
 {
     if (stemmer == 0) return;
-    if (stemmer->close == 0) return;
-    stemmer->close(stemmer->env);
-    stemmer->close = 0;
+    sb_stemmer_scratch_release(&stemmer->scratch);
     free(stemmer);
 }
 
 const sb_symbol *
 sb_stemmer_stem(struct sb_stemmer * stemmer, const sb_symbol * word, int size)
 {
-    int ret;
-    if (SN_set_current(stemmer->env, size, (const symbol *)(word)))
-    {
-        stemmer->env->l = 0;
-        return NULL;
-    }
-    ret = stemmer->stem(stemmer->env);
-    if (ret < 0) return NULL;
-    stemmer->env->p[stemmer->env->l] = 0;
-    return (const sb_symbol *)(stemmer->env->p);
+    return sb_stemmer_module_stem(stemmer->module, &stemmer->scratch, word, size);
 }
 
 int
 sb_stemmer_length(struct sb_stemmer * stemmer)
 {
-    return stemmer->env->l;
+    return sb_stemmer_scratch_length(&stemmer->scratch);
+}
+
+void
+sb_stemmer_set_allocator(void * (* malloc_fn)(size_t),
+                         void * (* realloc_fn)(void *, size_t),
+                         void (* free_fn)(void *))
+{
+    sn_set_allocator(malloc_fn, realloc_fn, free_fn);
+#if defined(SNOWBALL_MODULE_DIR)
+    {
+        unsigned int i;
+        pthread_mutex_lock(&sb_registry_lock);
+        for (i = 0; i < SB_MODULE_COUNT; i++) {
+            if (sb_module_libs[i] != NULL) sb_module_set_allocator(sb_module_libs[i]);
+        }
+        pthread_mutex_unlock(&sb_registry_lock);
+    }
+#endif
 }
+
+#endif /* SNOWBALL_AMALGAMATION */
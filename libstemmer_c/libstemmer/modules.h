@@ -39,6 +39,7 @@
 #include "../src_c/stem_ISO_8859_1_swedish.h"
 #include "../src_c/stem_UTF_8_swedish.h"
 #include "../src_c/stem_UTF_8_turkish.h"
+#include "../src_c/stem_light.h"
 
 typedef enum {
   ENC_UNKNOWN=0,
@@ -88,6 +89,8 @@ static struct stemmer_modules modules[] = {
   {"eng", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem},
   {"english", ENC_ISO_8859_1, english_ISO_8859_1_create_env, english_ISO_8859_1_close_env, english_ISO_8859_1_stem},
   {"english", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem},
+  {"english_light", ENC_ISO_8859_1, english_light_ISO_8859_1_create_env, english_light_ISO_8859_1_close_env, english_light_ISO_8859_1_stem},
+  {"english_light", ENC_UTF_8, english_light_UTF_8_create_env, english_light_UTF_8_close_env, english_light_UTF_8_stem},
   {"es", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem},
   {"es", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem},
   {"esl", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem},
@@ -106,10 +109,14 @@ static struct stemmer_modules modules[] = {
   {"fre", ENC_UTF_8, french_UTF_8_create_env, french_UTF_8_close_env, french_UTF_8_stem},
   {"french", ENC_ISO_8859_1, french_ISO_8859_1_create_env, french_ISO_8859_1_close_env, french_ISO_8859_1_stem},
   {"french", ENC_UTF_8, french_UTF_8_create_env, french_UTF_8_close_env, french_UTF_8_stem},
+  {"french_light", ENC_ISO_8859_1, french_light_ISO_8859_1_create_env, french_light_ISO_8859_1_close_env, french_light_ISO_8859_1_stem},
+  {"french_light", ENC_UTF_8, french_light_UTF_8_create_env, french_light_UTF_8_close_env, french_light_UTF_8_stem},
   {"ger", ENC_ISO_8859_1, german_ISO_8859_1_create_env, german_ISO_8859_1_close_env, german_ISO_8859_1_stem},
   {"ger", ENC_UTF_8, german_UTF_8_create_env, german_UTF_8_close_env, german_UTF_8_stem},
   {"german", ENC_ISO_8859_1, german_ISO_8859_1_create_env, german_ISO_8859_1_close_env, german_ISO_8859_1_stem},
   {"german", ENC_UTF_8, german_UTF_8_create_env, german_UTF_8_close_env, german_UTF_8_stem},
+  {"german_light", ENC_ISO_8859_1, german_light_ISO_8859_1_create_env, german_light_ISO_8859_1_close_env, german_light_ISO_8859_1_stem},
+  {"german_light", ENC_UTF_8, german_light_UTF_8_create_env, german_light_UTF_8_close_env, german_light_UTF_8_stem},
   {"hu", ENC_ISO_8859_1, hungarian_ISO_8859_1_create_env, hungarian_ISO_8859_1_close_env, hungarian_ISO_8859_1_stem},
   {"hu", ENC_UTF_8, hungarian_UTF_8_create_env, hungarian_UTF_8_close_env, hungarian_UTF_8_stem},
   {"hun", ENC_ISO_8859_1, hungarian_ISO_8859_1_create_env, hungarian_ISO_8859_1_close_env, hungarian_ISO_8859_1_stem},
@@ -158,6 +165,8 @@ static struct stemmer_modules modules[] = {
   {"spa", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem},
   {"spanish", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem},
   {"spanish", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem},
+  {"spanish_light", ENC_ISO_8859_1, spanish_light_ISO_8859_1_create_env, spanish_light_ISO_8859_1_close_env, spanish_light_ISO_8859_1_stem},
+  {"spanish_light", ENC_UTF_8, spanish_light_UTF_8_create_env, spanish_light_UTF_8_close_env, spanish_light_UTF_8_stem},
   {"sv", ENC_ISO_8859_1, swedish_ISO_8859_1_create_env, swedish_ISO_8859_1_close_env, swedish_ISO_8859_1_stem},
   {"sv", ENC_UTF_8, swedish_UTF_8_create_env, swedish_UTF_8_close_env, swedish_UTF_8_stem},
   {"swe", ENC_ISO_8859_1, swedish_ISO_8859_1_create_env, swedish_ISO_8859_1_close_env, swedish_ISO_8859_1_stem},
@@ -173,9 +182,12 @@ static const char * algorithm_names[] = {
   "danish", 
   "dutch", 
   "english", 
+  "english_light", 
   "finnish", 
   "french", 
+  "french_light", 
   "german", 
+  "german_light", 
   "hungarian", 
   "italian", 
   "norwegian", 
@@ -184,6 +196,7 @@ static const char * algorithm_names[] = {
   "romanian", 
   "russian", 
   "spanish", 
+  "spanish_light", 
   "swedish", 
   "turkish", 
   0
@@ -0,0 +1,170 @@
+/* libstemmer/modules_split.h: List of stemming modules for the split build.
+ *
+ * It lists the modules of modules.h, with each module's entry points
+ * replaced by the names used to load it at run time.  It is written by hand;
+ * keep it in sync with modules.txt and mkinc_split.mak.
+ *
+ * Modules included by this file are: danish, dutch, english, finnish, french,
+ * german, hungarian, italian, norwegian, porter, portuguese, romanian,
+ * russian, spanish, swedish, turkish
+ */
+
+typedef enum {
+  ENC_UNKNOWN=0,
+  ENC_ISO_8859_1,
+  ENC_ISO_8859_2,
+  ENC_KOI8_R,
+  ENC_UTF_8
+} stemmer_encoding_t;
+
+struct stemmer_encoding {
+  const char * name;
+  stemmer_encoding_t enc;
+};
+static struct stemmer_encoding encodings[] = {
+  {"ISO_8859_1", ENC_ISO_8859_1},
+  {"ISO_8859_2", ENC_ISO_8859_2},
+  {"KOI8_R", ENC_KOI8_R},
+  {"UTF_8", ENC_UTF_8},
+  {0,ENC_UNKNOWN}
+};
+
+struct stemmer_modules {
+  const char * name;
+  stemmer_encoding_t enc; 
+  const char * prefix; /* prefix of the entry points, e.g. english_UTF_8 */
+  const char * object; /* shared object name, e.g. stem_UTF_8_english */
+};
+static struct stemmer_modules modules[] = {
+  {"da", ENC_ISO_8859_1, "danish_ISO_8859_1", "stem_ISO_8859_1_danish"},
+  {"da", ENC_UTF_8, "danish_UTF_8", "stem_UTF_8_danish"},
+  {"dan", ENC_ISO_8859_1, "danish_ISO_8859_1", "stem_ISO_8859_1_danish"},
+  {"dan", ENC_UTF_8, "danish_UTF_8", "stem_UTF_8_danish"},
+  {"danish", ENC_ISO_8859_1, "danish_ISO_8859_1", "stem_ISO_8859_1_danish"},
+  {"danish", ENC_UTF_8, "danish_UTF_8", "stem_UTF_8_danish"},
+  {"de", ENC_ISO_8859_1, "german_ISO_8859_1", "stem_ISO_8859_1_german"},
+  {"de", ENC_UTF_8, "german_UTF_8", "stem_UTF_8_german"},
+  {"deu", ENC_ISO_8859_1, "german_ISO_8859_1", "stem_ISO_8859_1_german"},
+  {"deu", ENC_UTF_8, "german_UTF_8", "stem_UTF_8_german"},
+  {"dut", ENC_ISO_8859_1, "dutch_ISO_8859_1", "stem_ISO_8859_1_dutch"},
+  {"dut", ENC_UTF_8, "dutch_UTF_8", "stem_UTF_8_dutch"},
+  {"dutch", ENC_ISO_8859_1, "dutch_ISO_8859_1", "stem_ISO_8859_1_dutch"},
+  {"dutch", ENC_UTF_8, "dutch_UTF_8", "stem_UTF_8_dutch"},
+  {"en", ENC_ISO_8859_1, "english_ISO_8859_1", "stem_ISO_8859_1_english"},
+  {"en", ENC_UTF_8, "english_UTF_8", "stem_UTF_8_english"},
+  {"eng", ENC_ISO_8859_1, "english_ISO_8859_1", "stem_ISO_8859_1_english"},
+  {"eng", ENC_UTF_8, "english_UTF_8", "stem_UTF_8_english"},
+  {"english", ENC_ISO_8859_1, "english_ISO_8859_1", "stem_ISO_8859_1_english"},
+  {"english", ENC_UTF_8, "english_UTF_8", "stem_UTF_8_english"},
+  {"english_light", ENC_ISO_8859_1, "english_light_ISO_8859_1", "stem_light"},
+  {"english_light", ENC_UTF_8, "english_light_UTF_8", "stem_light"},
+  {"es", ENC_ISO_8859_1, "spanish_ISO_8859_1", "stem_ISO_8859_1_spanish"},
+  {"es", ENC_UTF_8, "spanish_UTF_8", "stem_UTF_8_spanish"},
+  {"esl", ENC_ISO_8859_1, "spanish_ISO_8859_1", "stem_ISO_8859_1_spanish"},
+  {"esl", ENC_UTF_8, "spanish_UTF_8", "stem_UTF_8_spanish"},
+  {"fi", ENC_ISO_8859_1, "finnish_ISO_8859_1", "stem_ISO_8859_1_finnish"},
+  {"fi", ENC_UTF_8, "finnish_UTF_8", "stem_UTF_8_finnish"},
+  {"fin", ENC_ISO_8859_1, "finnish_ISO_8859_1", "stem_ISO_8859_1_finnish"},
+  {"fin", ENC_UTF_8, "finnish_UTF_8", "stem_UTF_8_finnish"},
+  {"finnish", ENC_ISO_8859_1, "finnish_ISO_8859_1", "stem_ISO_8859_1_finnish"},
+  {"finnish", ENC_UTF_8, "finnish_UTF_8", "stem_UTF_8_finnish"},
+  {"fr", ENC_ISO_8859_1, "french_ISO_8859_1", "stem_ISO_8859_1_french"},
+  {"fr", ENC_UTF_8, "french_UTF_8", "stem_UTF_8_french"},
+  {"fra", ENC_ISO_8859_1, "french_ISO_8859_1", "stem_ISO_8859_1_french"},
+  {"fra", ENC_UTF_8, "french_UTF_8", "stem_UTF_8_french"},
+  {"fre", ENC_ISO_8859_1, "french_ISO_8859_1", "stem_ISO_8859_1_french"},
+  {"fre", ENC_UTF_8, "french_UTF_8", "stem_UTF_8_french"},
+  {"french", ENC_ISO_8859_1, "french_ISO_8859_1", "stem_ISO_8859_1_french"},
+  {"french", ENC_UTF_8, "french_UTF_8", "stem_UTF_8_french"},
+  {"french_light", ENC_ISO_8859_1, "french_light_ISO_8859_1", "stem_light"},
+  {"french_light", ENC_UTF_8, "french_light_UTF_8", "stem_light"},
+  {"ger", ENC_ISO_8859_1, "german_ISO_8859_1", "stem_ISO_8859_1_german"},
+  {"ger", ENC_UTF_8, "german_UTF_8", "stem_UTF_8_german"},
+  {"german", ENC_ISO_8859_1, "german_ISO_8859_1", "stem_ISO_8859_1_german"},
+  {"german", ENC_UTF_8, "german_UTF_8", "stem_UTF_8_german"},
+  {"german_light", ENC_ISO_8859_1, "german_light_ISO_8859_1", "stem_light"},
+  {"german_light", ENC_UTF_8, "german_light_UTF_8", "stem_light"},
+  {"hu", ENC_ISO_8859_1, "hungarian_ISO_8859_1", "stem_ISO_8859_1_hungarian"},
+  {"hu", ENC_UTF_8, "hungarian_UTF_8", "stem_UTF_8_hungarian"},
+  {"hun", ENC_ISO_8859_1, "hungarian_ISO_8859_1", "stem_ISO_8859_1_hungarian"},
+  {"hun", ENC_UTF_8, "hungarian_UTF_8", "stem_UTF_8_hungarian"},
+  {"hungarian", ENC_ISO_8859_1, "hungarian_ISO_8859_1", "stem_ISO_8859_1_hungarian"},
+  {"hungarian", ENC_UTF_8, "hungarian_UTF_8", "stem_UTF_8_hungarian"},
+  {"it", ENC_ISO_8859_1, "italian_ISO_8859_1", "stem_ISO_8859_1_italian"},
+  {"it", ENC_UTF_8, "italian_UTF_8", "stem_UTF_8_italian"},
+  {"ita", ENC_ISO_8859_1, "italian_ISO_8859_1", "stem_ISO_8859_1_italian"},
+  {"ita", ENC_UTF_8, "italian_UTF_8", "stem_UTF_8_italian"},
+  {"italian", ENC_ISO_8859_1, "italian_ISO_8859_1", "stem_ISO_8859_1_italian"},
+  {"italian", ENC_UTF_8, "italian_UTF_8", "stem_UTF_8_italian"},
+  {"nl", ENC_ISO_8859_1, "dutch_ISO_8859_1", "stem_ISO_8859_1_dutch"},
+  {"nl", ENC_UTF_8, "dutch_UTF_8", "stem_UTF_8_dutch"},
+  {"nld", ENC_ISO_8859_1, "dutch_ISO_8859_1", "stem_ISO_8859_1_dutch"},
+  {"nld", ENC_UTF_8, "dutch_UTF_8", "stem_UTF_8_dutch"},
+  {"no", ENC_ISO_8859_1, "norwegian_ISO_8859_1", "stem_ISO_8859_1_norwegian"},
+  {"no", ENC_UTF_8, "norwegian_UTF_8", "stem_UTF_8_norwegian"},
+  {"nor", ENC_ISO_8859_1, "norwegian_ISO_8859_1", "stem_ISO_8859_1_norwegian"},
+  {"nor", ENC_UTF_8, "norwegian_UTF_8", "stem_UTF_8_norwegian"},
+  {"norwegian", ENC_ISO_8859_1, "norwegian_ISO_8859_1", "stem_ISO_8859_1_norwegian"},
+  {"norwegian", ENC_UTF_8, "norwegian_UTF_8", "stem_UTF_8_norwegian"},
+  {"por", ENC_ISO_8859_1, "portuguese_ISO_8859_1", "stem_ISO_8859_1_portuguese"},
+  {"por", ENC_UTF_8, "portuguese_UTF_8", "stem_UTF_8_portuguese"},
+  {"porter", ENC_ISO_8859_1, "porter_ISO_8859_1", "stem_ISO_8859_1_porter"},
+  {"porter", ENC_UTF_8, "porter_UTF_8", "stem_UTF_8_porter"},
+  {"portuguese", ENC_ISO_8859_1, "portuguese_ISO_8859_1", "stem_ISO_8859_1_portuguese"},
+  {"portuguese", ENC_UTF_8, "portuguese_UTF_8", "stem_UTF_8_portuguese"},
+  {"pt", ENC_ISO_8859_1, "portuguese_ISO_8859_1", "stem_ISO_8859_1_portuguese"},
+  {"pt", ENC_UTF_8, "portuguese_UTF_8", "stem_UTF_8_portuguese"},
+  {"ro", ENC_ISO_8859_2, "romanian_ISO_8859_2", "stem_ISO_8859_2_romanian"},
+  {"ro", ENC_UTF_8, "romanian_UTF_8", "stem_UTF_8_romanian"},
+  {"romanian", ENC_ISO_8859_2, "romanian_ISO_8859_2", "stem_ISO_8859_2_romanian"},
+  {"romanian", ENC_UTF_8, "romanian_UTF_8", "stem_UTF_8_romanian"},
+  {"ron", ENC_ISO_8859_2, "romanian_ISO_8859_2", "stem_ISO_8859_2_romanian"},
+  {"ron", ENC_UTF_8, "romanian_UTF_8", "stem_UTF_8_romanian"},
+  {"ru", ENC_KOI8_R, "russian_KOI8_R", "stem_KOI8_R_russian"},
+  {"ru", ENC_UTF_8, "russian_UTF_8", "stem_UTF_8_russian"},
+  {"rum", ENC_ISO_8859_2, "romanian_ISO_8859_2", "stem_ISO_8859_2_romanian"},
+  {"rum", ENC_UTF_8, "romanian_UTF_8", "stem_UTF_8_romanian"},
+  {"rus", ENC_KOI8_R, "russian_KOI8_R", "stem_KOI8_R_russian"},
+  {"rus", ENC_UTF_8, "russian_UTF_8", "stem_UTF_8_russian"},
+  {"russian", ENC_KOI8_R, "russian_KOI8_R", "stem_KOI8_R_russian"},
+  {"russian", ENC_UTF_8, "russian_UTF_8", "stem_UTF_8_russian"},
+  {"spa", ENC_ISO_8859_1, "spanish_ISO_8859_1", "stem_ISO_8859_1_spanish"},
+  {"spa", ENC_UTF_8, "spanish_UTF_8", "stem_UTF_8_spanish"},
+  {"spanish", ENC_ISO_8859_1, "spanish_ISO_8859_1", "stem_ISO_8859_1_spanish"},
+  {"spanish", ENC_UTF_8, "spanish_UTF_8", "stem_UTF_8_spanish"},
+  {"spanish_light", ENC_ISO_8859_1, "spanish_light_ISO_8859_1", "stem_light"},
+  {"spanish_light", ENC_UTF_8, "spanish_light_UTF_8", "stem_light"},
+  {"sv", ENC_ISO_8859_1, "swedish_ISO_8859_1", "stem_ISO_8859_1_swedish"},
+  {"sv", ENC_UTF_8, "swedish_UTF_8", "stem_UTF_8_swedish"},
+  {"swe", ENC_ISO_8859_1, "swedish_ISO_8859_1", "stem_ISO_8859_1_swedish"},
+  {"swe", ENC_UTF_8, "swedish_UTF_8", "stem_UTF_8_swedish"},
+  {"swedish", ENC_ISO_8859_1, "swedish_ISO_8859_1", "stem_ISO_8859_1_swedish"},
+  {"swedish", ENC_UTF_8, "swedish_UTF_8", "stem_UTF_8_swedish"},
+  {"tr", ENC_UTF_8, "turkish_UTF_8", "stem_UTF_8_turkish"},
+  {"tur", ENC_UTF_8, "turkish_UTF_8", "stem_UTF_8_turkish"},
+  {"turkish", ENC_UTF_8, "turkish_UTF_8", "stem_UTF_8_turkish"},
+  {0,ENC_UNKNOWN,0,0}
+};
+static const char * algorithm_names[] = {
+  "danish", 
+  "dutch", 
+  "english", 
+  "english_light", 
+  "finnish", 
+  "french", 
+  "french_light", 
+  "german", 
+  "german_light", 
+  "hungarian", 
+  "italian", 
+  "norwegian", 
+  "porter", 
+  "portuguese", 
+  "romanian", 
+  "russian", 
+  "spanish", 
+  "spanish_light", 
+  "swedish", 
+  "turkish", 
+  0
+};
@@ -24,6 +24,7 @@
 #include "../src_c/stem_UTF_8_spanish.h"
 #include "../src_c/stem_UTF_8_swedish.h"
 #include "../src_c/stem_UTF_8_turkish.h"
+#include "../src_c/stem_light.h"
 
 typedef enum {
   ENC_UNKNOWN=0,
@@ -57,6 +58,7 @@ static struct stemmer_modules modules[] = {
   {"en", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem},
   {"eng", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem},
   {"english", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem},
+  {"english_light", ENC_UTF_8, english_light_UTF_8_create_env, english_light_UTF_8_close_env, english_light_UTF_8_stem},
   {"es", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem},
   {"esl", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem},
   {"fi", ENC_UTF_8, finnish_UTF_8_create_env, finnish_UTF_8_close_env, finnish_UTF_8_stem},
@@ -66,8 +68,10 @@ static struct stemmer_modules modules[] = {
   {"fra", ENC_UTF_8, french_UTF_8_create_env, french_UTF_8_close_env, french_UTF_8_stem},
   {"fre", ENC_UTF_8, french_UTF_8_create_env, french_UTF_8_close_env, french_UTF_8_stem},
   {"french", ENC_UTF_8, french_UTF_8_create_env, french_UTF_8_close_env, french_UTF_8_stem},
+  {"french_light", ENC_UTF_8, french_light_UTF_8_create_env, french_light_UTF_8_close_env, french_light_UTF_8_stem},
   {"ger", ENC_UTF_8, german_UTF_8_create_env, german_UTF_8_close_env, german_UTF_8_stem},
   {"german", ENC_UTF_8, german_UTF_8_create_env, german_UTF_8_close_env, german_UTF_8_stem},
+  {"german_light", ENC_UTF_8, german_light_UTF_8_create_env, german_light_UTF_8_close_env, german_light_UTF_8_stem},
   {"hu", ENC_UTF_8, hungarian_UTF_8_create_env, hungarian_UTF_8_close_env, hungarian_UTF_8_stem},
   {"hun", ENC_UTF_8, hungarian_UTF_8_create_env, hungarian_UTF_8_close_env, hungarian_UTF_8_stem},
   {"hungarian", ENC_UTF_8, hungarian_UTF_8_create_env, hungarian_UTF_8_close_env, hungarian_UTF_8_stem},
@@ -92,6 +96,7 @@ static struct stemmer_modules modules[] = {
   {"russian", ENC_UTF_8, russian_UTF_8_create_env, russian_UTF_8_close_env, russian_UTF_8_stem},
   {"spa", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem},
   {"spanish", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem},
+  {"spanish_light", ENC_UTF_8, spanish_light_UTF_8_create_env, spanish_light_UTF_8_close_env, spanish_light_UTF_8_stem},
   {"sv", ENC_UTF_8, swedish_UTF_8_create_env, swedish_UTF_8_close_env, swedish_UTF_8_stem},
   {"swe", ENC_UTF_8, swedish_UTF_8_create_env, swedish_UTF_8_close_env, swedish_UTF_8_stem},
   {"swedish", ENC_UTF_8, swedish_UTF_8_create_env, swedish_UTF_8_close_env, swedish_UTF_8_stem},
@@ -104,9 +109,12 @@ static const char * algorithm_names[] = {
   "danish", 
   "dutch", 
   "english", 
+  "english_light", 
   "finnish", 
   "french", 
+  "french_light", 
   "german", 
+  "german_light", 
   "hungarian", 
   "italian", 
   "norwegian", 
@@ -115,6 +123,7 @@ static const char * algorithm_names[] = {
   "romanian", 
   "russian", 
   "spanish", 
+  "spanish_light", 
   "swedish", 
   "turkish", 
   0
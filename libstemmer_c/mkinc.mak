@@ -39,6 +39,7 @@ snowball_sources= \
   src_c/stem_ISO_8859_1_swedish.c \
   src_c/stem_UTF_8_swedish.c \
   src_c/stem_UTF_8_turkish.c \
+  src_c/stem_light.c \
   runtime/api.c \
   runtime/utilities.c \
   libstemmer/libstemmer.c
@@ -75,6 +76,7 @@ snowball_headers= \
   src_c/stem_ISO_8859_1_swedish.h \
   src_c/stem_UTF_8_swedish.h \
   src_c/stem_UTF_8_turkish.h \
+  src_c/stem_light.h \
   include/libstemmer.h \
   libstemmer/modules.h \
   runtime/api.h \
@@ -0,0 +1,136 @@
+# libstemmer/mkinc_split.mak: List of stemming modules built as separate
+# shared objects (configure --enable-module-split).
+#
+# Each module carries its own copy of the snowball runtime, since it is
+# loaded with RTLD_LOCAL by libstemmer.c and can not see the plugin's.
+# Keep in sync with mkinc.mak.
+
+snowball_split_modules= \
+  stem_ISO_8859_1_danish.la \
+  stem_ISO_8859_1_dutch.la \
+  stem_ISO_8859_1_english.la \
+  stem_ISO_8859_1_finnish.la \
+  stem_ISO_8859_1_french.la \
+  stem_ISO_8859_1_german.la \
+  stem_ISO_8859_1_hungarian.la \
+  stem_ISO_8859_1_italian.la \
+  stem_ISO_8859_1_norwegian.la \
+  stem_ISO_8859_1_porter.la \
+  stem_ISO_8859_1_portuguese.la \
+  stem_ISO_8859_1_spanish.la \
+  stem_ISO_8859_1_swedish.la \
+  stem_ISO_8859_2_romanian.la \
+  stem_KOI8_R_russian.la \
+  stem_UTF_8_danish.la \
+  stem_UTF_8_dutch.la \
+  stem_UTF_8_english.la \
+  stem_UTF_8_finnish.la \
+  stem_UTF_8_french.la \
+  stem_UTF_8_german.la \
+  stem_UTF_8_hungarian.la \
+  stem_UTF_8_italian.la \
+  stem_UTF_8_norwegian.la \
+  stem_UTF_8_porter.la \
+  stem_UTF_8_portuguese.la \
+  stem_UTF_8_romanian.la \
+  stem_UTF_8_russian.la \
+  stem_UTF_8_spanish.la \
+  stem_UTF_8_swedish.la \
+  stem_UTF_8_turkish.la \
+  stem_light.la
+
+stem_ISO_8859_1_danish_la_SOURCES= src_c/stem_ISO_8859_1_danish.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_danish_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_dutch_la_SOURCES= src_c/stem_ISO_8859_1_dutch.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_dutch_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_english_la_SOURCES= src_c/stem_ISO_8859_1_english.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_english_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_finnish_la_SOURCES= src_c/stem_ISO_8859_1_finnish.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_finnish_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_french_la_SOURCES= src_c/stem_ISO_8859_1_french.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_french_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_german_la_SOURCES= src_c/stem_ISO_8859_1_german.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_german_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_hungarian_la_SOURCES= src_c/stem_ISO_8859_1_hungarian.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_hungarian_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_italian_la_SOURCES= src_c/stem_ISO_8859_1_italian.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_italian_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_norwegian_la_SOURCES= src_c/stem_ISO_8859_1_norwegian.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_norwegian_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_porter_la_SOURCES= src_c/stem_ISO_8859_1_porter.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_porter_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_portuguese_la_SOURCES= src_c/stem_ISO_8859_1_portuguese.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_portuguese_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_spanish_la_SOURCES= src_c/stem_ISO_8859_1_spanish.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_spanish_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_1_swedish_la_SOURCES= src_c/stem_ISO_8859_1_swedish.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_1_swedish_la_LDFLAGS= -module -avoid-version
+
+stem_ISO_8859_2_romanian_la_SOURCES= src_c/stem_ISO_8859_2_romanian.c runtime/api.c runtime/utilities.c
+stem_ISO_8859_2_romanian_la_LDFLAGS= -module -avoid-version
+
+stem_KOI8_R_russian_la_SOURCES= src_c/stem_KOI8_R_russian.c runtime/api.c runtime/utilities.c
+stem_KOI8_R_russian_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_danish_la_SOURCES= src_c/stem_UTF_8_danish.c runtime/api.c runtime/utilities.c
+stem_UTF_8_danish_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_dutch_la_SOURCES= src_c/stem_UTF_8_dutch.c runtime/api.c runtime/utilities.c
+stem_UTF_8_dutch_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_english_la_SOURCES= src_c/stem_UTF_8_english.c runtime/api.c runtime/utilities.c
+stem_UTF_8_english_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_finnish_la_SOURCES= src_c/stem_UTF_8_finnish.c runtime/api.c runtime/utilities.c
+stem_UTF_8_finnish_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_french_la_SOURCES= src_c/stem_UTF_8_french.c runtime/api.c runtime/utilities.c
+stem_UTF_8_french_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_german_la_SOURCES= src_c/stem_UTF_8_german.c runtime/api.c runtime/utilities.c
+stem_UTF_8_german_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_hungarian_la_SOURCES= src_c/stem_UTF_8_hungarian.c runtime/api.c runtime/utilities.c
+stem_UTF_8_hungarian_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_italian_la_SOURCES= src_c/stem_UTF_8_italian.c runtime/api.c runtime/utilities.c
+stem_UTF_8_italian_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_norwegian_la_SOURCES= src_c/stem_UTF_8_norwegian.c runtime/api.c runtime/utilities.c
+stem_UTF_8_norwegian_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_porter_la_SOURCES= src_c/stem_UTF_8_porter.c runtime/api.c runtime/utilities.c
+stem_UTF_8_porter_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_portuguese_la_SOURCES= src_c/stem_UTF_8_portuguese.c runtime/api.c runtime/utilities.c
+stem_UTF_8_portuguese_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_romanian_la_SOURCES= src_c/stem_UTF_8_romanian.c runtime/api.c runtime/utilities.c
+stem_UTF_8_romanian_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_russian_la_SOURCES= src_c/stem_UTF_8_russian.c runtime/api.c runtime/utilities.c
+stem_UTF_8_russian_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_spanish_la_SOURCES= src_c/stem_UTF_8_spanish.c runtime/api.c runtime/utilities.c
+stem_UTF_8_spanish_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_swedish_la_SOURCES= src_c/stem_UTF_8_swedish.c runtime/api.c runtime/utilities.c
+stem_UTF_8_swedish_la_LDFLAGS= -module -avoid-version
+
+stem_UTF_8_turkish_la_SOURCES= src_c/stem_UTF_8_turkish.c runtime/api.c runtime/utilities.c
+stem_UTF_8_turkish_la_LDFLAGS= -module -avoid-version
+
+stem_light_la_SOURCES= src_c/stem_light.c runtime/api.c runtime/utilities.c
+stem_light_la_LDFLAGS= -module -avoid-version
@@ -24,6 +24,7 @@ snowball_sources= \
   src_c/stem_UTF_8_spanish.c \
   src_c/stem_UTF_8_swedish.c \
   src_c/stem_UTF_8_turkish.c \
+  src_c/stem_light.c \
   runtime/api.c \
   runtime/utilities.c \
   libstemmer/libstemmer_utf8.c
@@ -45,6 +46,7 @@ snowball_headers= \
   src_c/stem_UTF_8_spanish.h \
   src_c/stem_UTF_8_swedish.h \
   src_c/stem_UTF_8_turkish.h \
+  src_c/stem_light.h \
   include/libstemmer.h \
   libstemmer/modules_utf8.h \
   runtime/api.h \
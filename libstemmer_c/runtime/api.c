@@ -1,17 +1,29 @@
 
-#include <stdlib.h> /* for calloc, free */
+/* With --enable-amalgamation this file is compiled as part of
+ * ftsnowball_amalgamation.c instead of libstemmer.la.
+ */
+#ifndef SNOWBALL_AMALGAMATION
+
+#include <string.h> /* for memset */
 #include "header.h"
 
+static void * sn_calloc(size_t count, size_t size)
+{
+    void * p = sn_malloc(count * size);
+    if (p != NULL) memset(p, 0, count * size);
+    return p;
+}
+
 extern struct SN_env * SN_create_env(int S_size, int I_size, int B_size)
 {
-    struct SN_env * z = (struct SN_env *) calloc(1, sizeof(struct SN_env));
+    struct SN_env * z = (struct SN_env *) sn_calloc(1, sizeof(struct SN_env));
     if (z == NULL) return NULL;
     z->p = create_s();
     if (z->p == NULL) goto error;
     if (S_size)
     {
         int i;
-        z->S = (symbol * *) calloc(S_size, sizeof(symbol *));
+        z->S = (symbol * *) sn_calloc(S_size, sizeof(symbol *));
         if (z->S == NULL) goto error;
 
         for (i = 0; i < S_size; i++)
@@ -23,13 +35,13 @@ extern struct SN_env * SN_create_env(int S_size, int I_size, int B_size)
 
     if (I_size)
     {
-        z->I = (int *) calloc(I_size, sizeof(int));
+        z->I = (int *) sn_calloc(I_size, sizeof(int));
         if (z->I == NULL) goto error;
     }
 
     if (B_size)
     {
-        z->B = (unsigned char *) calloc(B_size, sizeof(unsigned char));
+        z->B = (unsigned char *) sn_calloc(B_size, sizeof(unsigned char));
         if (z->B == NULL) goto error;
     }
 
@@ -49,12 +61,12 @@ extern void SN_close_env(struct SN_env * z, int S_size)
         {
             lose_s(z->S[i]);
         }
-        free(z->S);
+        sn_free(z->S);
     }
-    free(z->I);
-    free(z->B);
+    sn_free(z->I);
+    sn_free(z->B);
     if (z->p) lose_s(z->p);
-    free(z);
+    sn_free(z);
 }
 
 extern int SN_set_current(struct SN_env * z, int size, const symbol * s)
@@ -64,3 +76,4 @@ extern int SN_set_current(struct SN_env * z, int size, const symbol * s)
     return err;
 }
 
+#endif /* SNOWBALL_AMALGAMATION */
@@ -1,5 +1,9 @@
 
+#ifndef SN_HEADER_H
+#define SN_HEADER_H
+
 #include <limits.h>
+#include <stddef.h>
 
 #include "api.h"
 
@@ -23,6 +27,14 @@ struct among
 extern symbol * create_s(void);
 extern void lose_s(symbol * p);
 
+/* The allocator of the runtime: malloc, realloc and free unless replaced
+ * by sb_stemmer_set_allocator(). */
+extern void * (* sn_malloc)(size_t size);
+extern void * (* sn_realloc)(void * ptr, size_t size);
+extern void (* sn_free)(void * ptr);
+extern void sn_set_allocator(void * (* malloc_fn)(size_t), void * (* realloc_fn)(void *, size_t),
+                             void (* free_fn)(void *));
+
 extern int skip_utf8(const symbol * p, int c, int lb, int l, int n);
 
 extern int in_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
@@ -56,3 +68,8 @@ extern symbol * assign_to(struct SN_env * z, symbol * p);
 
 extern void debug(struct SN_env * z, int number, int line_count);
 
+#if defined(SNOWBALL_INLINE_RUNTIME) && !defined(SN_RUNTIME_SOURCE)
+#include "inline.h"
+#endif
+
+#endif /* SN_HEADER_H */
@@ -0,0 +1,327 @@
+
+/* Runtime routines shared by utilities.c and, when SNOWBALL_INLINE_RUNTIME
+ * is defined, by every generated stemming module.
+ *
+ * The generated code calls these with constant groupings, ranges and
+ * strings, e.g. in_grouping_U(z, g_v, 97, 121, 0).  Compiled into the
+ * module they are specialised for those constants instead of going through
+ * the out-of-line versions in utilities.c.
+ */
+
+#ifndef SN_INLINE_H
+#define SN_INLINE_H
+
+#if defined(__GNUC__)
+#define SN_LOCAL static __inline__
+#elif defined(_MSC_VER)
+#define SN_LOCAL static __inline
+#else
+#define SN_LOCAL static
+#endif
+
+/* Code for character groupings: utf8 cases */
+
+SN_LOCAL int sn_get_utf8(const symbol * p, int c, int l, int * slot) {
+    int b0, b1, b2;
+    if (c >= l) return 0;
+    b0 = p[c++];
+    if (b0 < 0xC0 || c == l) {   /* 1100 0000 */
+        * slot = b0; return 1;
+    }
+    b1 = p[c++];
+    if (b0 < 0xE0 || c == l) {   /* 1110 0000 */
+        * slot = (b0 & 0x1F) << 6 | (b1 & 0x3F); return 2;
+    }
+    b2 = p[c++];
+    if (b0 < 0xF0 || c == l) {   /* 1111 0000 */
+        * slot = (b0 & 0xF) << 12 | (b1 & 0x3F) << 6 | (b2 & 0x3F); return 3;
+    }
+    * slot = (b0 & 0x7) << 18 | (b1 & 0x3F) << 12 | (b2 & 0x3F) << 6 | (p[c] & 0x3F); return 4;
+}
+
+SN_LOCAL int sn_get_b_utf8(const symbol * p, int c, int lb, int * slot) {
+    int b0, b1, b2;
+    if (c <= lb) return 0;
+    b0 = p[--c];
+    if (b0 < 0x80 || c == lb) {   /* 1000 0000 */
+        * slot = b0; return 1;
+    }
+    b1 = p[--c];
+    if (b1 >= 0xC0 || c == lb) {   /* 1100 0000 */
+        * slot = (b1 & 0x1F) << 6 | (b0 & 0x3F); return 2;
+    }
+    b2 = p[--c];
+    if (b2 >= 0xE0 || c == lb) {   /* 1110 0000 */
+        * slot = (b2 & 0xF) << 12 | (b1 & 0x3F) << 6 | (b0 & 0x3F); return 3;
+    }
+    * slot = (p[--c] & 0x7) << 18 | (b2 & 0x3F) << 12 | (b1 & 0x3F) << 6 | (b0 & 0x3F); return 4;
+}
+
+SN_LOCAL int sn_in_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+	int ch;
+	int w = sn_get_utf8(z->p, z->c, z->l, & ch);
+	if (!w) return -1;
+	if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
+	    return w;
+	z->c += w;
+    } while (repeat);
+    return 0;
+}
+
+SN_LOCAL int sn_in_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+	int ch;
+	int w = sn_get_b_utf8(z->p, z->c, z->lb, & ch);
+	if (!w) return -1;
+	if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
+	    return w;
+	z->c -= w;
+    } while (repeat);
+    return 0;
+}
+
+SN_LOCAL int sn_out_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+	int ch;
+	int w = sn_get_utf8(z->p, z->c, z->l, & ch);
+	if (!w) return -1;
+	if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0))
+	    return w;
+	z->c += w;
+    } while (repeat);
+    return 0;
+}
+
+SN_LOCAL int sn_out_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+	int ch;
+	int w = sn_get_b_utf8(z->p, z->c, z->lb, & ch);
+	if (!w) return -1;
+	if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0))
+	    return w;
+	z->c -= w;
+    } while (repeat);
+    return 0;
+}
+
+/* Code for character groupings: non-utf8 cases */
+
+SN_LOCAL int sn_in_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+	int ch;
+	if (z->c >= z->l) return -1;
+	ch = z->p[z->c];
+	if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
+	    return 1;
+	z->c++;
+    } while (repeat);
+    return 0;
+}
+
+SN_LOCAL int sn_in_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+	int ch;
+	if (z->c <= z->lb) return -1;
+	ch = z->p[z->c - 1];
+	if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
+	    return 1;
+	z->c--;
+    } while (repeat);
+    return 0;
+}
+
+SN_LOCAL int sn_out_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+	int ch;
+	if (z->c >= z->l) return -1;
+	ch = z->p[z->c];
+	if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0))
+	    return 1;
+	z->c++;
+    } while (repeat);
+    return 0;
+}
+
+SN_LOCAL int sn_out_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+	int ch;
+	if (z->c <= z->lb) return -1;
+	ch = z->p[z->c - 1];
+	if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0))
+	    return 1;
+	z->c--;
+    } while (repeat);
+    return 0;
+}
+
+SN_LOCAL int sn_eq_s(struct SN_env * z, int s_size, const symbol * s) {
+    const symbol * q = z->p + z->c;
+    int i;
+    if (z->l - z->c < s_size) return 0;
+    for (i = 0; i < s_size; i++) if (q[i] != s[i]) return 0;
+    z->c += s_size; return 1;
+}
+
+SN_LOCAL int sn_eq_s_b(struct SN_env * z, int s_size, const symbol * s) {
+    const symbol * q = z->p + z->c - s_size;
+    int i;
+    if (z->c - z->lb < s_size) return 0;
+    for (i = 0; i < s_size; i++) if (q[i] != s[i]) return 0;
+    z->c -= s_size; return 1;
+}
+
+SN_LOCAL int sn_eq_v(struct SN_env * z, const symbol * p) {
+    return sn_eq_s(z, SIZE(p), p);
+}
+
+SN_LOCAL int sn_eq_v_b(struct SN_env * z, const symbol * p) {
+    return sn_eq_s_b(z, SIZE(p), p);
+}
+
+SN_LOCAL int sn_find_among(struct SN_env * z, const struct among * v, int v_size) {
+
+    int i = 0;
+    int j = v_size;
+
+    int c = z->c; int l = z->l;
+    symbol * q = z->p + c;
+
+    const struct among * w;
+
+    int common_i = 0;
+    int common_j = 0;
+
+    int first_key_inspected = 0;
+
+    while(1) {
+        int k = i + ((j - i) >> 1);
+        int diff = 0;
+        int common = common_i < common_j ? common_i : common_j; /* smaller */
+        w = v + k;
+        {
+            int i2; for (i2 = common; i2 < w->s_size; i2++) {
+                if (c + common == l) { diff = -1; break; }
+                diff = q[common] - w->s[i2];
+                if (diff != 0) break;
+                common++;
+            }
+        }
+        if (diff < 0) { j = k; common_j = common; }
+                 else { i = k; common_i = common; }
+        if (j - i <= 1) {
+            if (i > 0) break; /* v->s has been inspected */
+            if (j == i) break; /* only one item in v */
+
+            /* - but now we need to go round once more to get
+               v->s inspected. This looks messy, but is actually
+               the optimal approach.  */
+
+            if (first_key_inspected) break;
+            first_key_inspected = 1;
+        }
+    }
+    while(1) {
+        w = v + i;
+        if (common_i >= w->s_size) {
+            z->c = c + w->s_size;
+            if (w->function == 0) return w->result;
+            {
+                int res = w->function(z);
+                z->c = c + w->s_size;
+                if (res) return w->result;
+            }
+        }
+        i = w->substring_i;
+        if (i < 0) return 0;
+    }
+}
+
+/* find_among_b is for backwards processing. Same comments apply */
+
+SN_LOCAL int sn_find_among_b(struct SN_env * z, const struct among * v, int v_size) {
+
+    int i = 0;
+    int j = v_size;
+
+    int c = z->c; int lb = z->lb;
+    symbol * q = z->p + c - 1;
+
+    const struct among * w;
+
+    int common_i = 0;
+    int common_j = 0;
+
+    int first_key_inspected = 0;
+
+    while(1) {
+        int k = i + ((j - i) >> 1);
+        int diff = 0;
+        int common = common_i < common_j ? common_i : common_j;
+        w = v + k;
+        {
+            int i2; for (i2 = w->s_size - 1 - common; i2 >= 0; i2--) {
+                if (c - common == lb) { diff = -1; break; }
+                diff = q[- common] - w->s[i2];
+                if (diff != 0) break;
+                common++;
+            }
+        }
+        if (diff < 0) { j = k; common_j = common; }
+                 else { i = k; common_i = common; }
+        if (j - i <= 1) {
+            if (i > 0) break;
+            if (j == i) break;
+            if (first_key_inspected) break;
+            first_key_inspected = 1;
+        }
+    }
+    while(1) {
+        w = v + i;
+        if (common_i >= w->s_size) {
+            z->c = c - w->s_size;
+            if (w->function == 0) return w->result;
+            {
+                int res = w->function(z);
+                z->c = c - w->s_size;
+                if (res) return w->result;
+            }
+        }
+        i = w->substring_i;
+        if (i < 0) return 0;
+    }
+}
+
+/* Replacing a slice by a string of the same length, as most rules that
+ * swap one suffix letter do, needs neither the buffer growth nor the tail
+ * memmove of replace_s().
+ */
+SN_LOCAL int sn_slice_from_s(struct SN_env * z, int s_size, const symbol * s) {
+    if (z->bra >= 0 && z->bra <= z->ket && z->ket <= z->l &&
+        z->p != 0 && z->l <= SIZE(z->p) && z->ket - z->bra == s_size) {
+        int i;
+        for (i = 0; i < s_size; i++) z->p[z->bra + i] = s[i];
+        return 0;
+    }
+    return slice_from_s(z, s_size, s);
+}
+
+#ifndef SN_RUNTIME_SOURCE
+#define in_grouping_U       sn_in_grouping_U
+#define in_grouping_b_U     sn_in_grouping_b_U
+#define out_grouping_U      sn_out_grouping_U
+#define out_grouping_b_U    sn_out_grouping_b_U
+#define in_grouping         sn_in_grouping
+#define in_grouping_b       sn_in_grouping_b
+#define out_grouping        sn_out_grouping
+#define out_grouping_b      sn_out_grouping_b
+#define eq_s                sn_eq_s
+#define eq_s_b              sn_eq_s_b
+#define eq_v                sn_eq_v
+#define eq_v_b              sn_eq_v_b
+#define find_among         sn_find_among
+#define find_among_b        sn_find_among_b
+#define slice_from_s        sn_slice_from_s
+#endif
+
+#endif /* SN_INLINE_H */
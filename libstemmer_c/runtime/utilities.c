@@ -3,15 +3,33 @@
 #include <stdlib.h>
 #include <string.h>
 
+#define SN_RUNTIME_SOURCE
 #include "header.h"
+#include "inline.h"
 
 #define unless(C) if(!(C))
 
 #define CREATE_SIZE 1
 
+void * (* sn_malloc)(size_t size) = malloc;
+void * (* sn_realloc)(void * ptr, size_t size) = realloc;
+void (* sn_free)(void * ptr) = free;
+
+extern void sn_set_allocator(void * (* malloc_fn)(size_t), void * (* realloc_fn)(void *, size_t),
+                             void (* free_fn)(void *)) {
+    if (malloc_fn == NULL || realloc_fn == NULL || free_fn == NULL) {
+        malloc_fn = malloc;
+        realloc_fn = realloc;
+        free_fn = free;
+    }
+    sn_malloc = malloc_fn;
+    sn_realloc = realloc_fn;
+    sn_free = free_fn;
+}
+
 extern symbol * create_s(void) {
     symbol * p;
-    void * mem = malloc(HEAD + (CREATE_SIZE + 1) * sizeof(symbol));
+    void * mem = sn_malloc(HEAD + (CREATE_SIZE + 1) * sizeof(symbol));
     if (mem == NULL) return NULL;
     p = (symbol *) (HEAD + (char *) mem);
     CAPACITY(p) = CREATE_SIZE;
@@ -21,7 +39,7 @@ extern symbol * create_s(void) {
 
 extern void lose_s(symbol * p) {
     if (p == NULL) return;
-    free((char *) p - HEAD);
+    sn_free((char *) p - HEAD);
 }
 
 /*
@@ -63,273 +81,71 @@ extern int skip_utf8(const symbol * p, int c, int lb, int l, int n) {
     return c;
 }
 
-/* Code for character groupings: utf8 cases */
-
-static int get_utf8(const symbol * p, int c, int l, int * slot) {
-    int b0, b1;
-    if (c >= l) return 0;
-    b0 = p[c++];
-    if (b0 < 0xC0 || c == l) {   /* 1100 0000 */
-        * slot = b0; return 1;
-    }
-    b1 = p[c++];
-    if (b0 < 0xE0 || c == l) {   /* 1110 0000 */
-        * slot = (b0 & 0x1F) << 6 | (b1 & 0x3F); return 2;
-    }
-    * slot = (b0 & 0xF) << 12 | (b1 & 0x3F) << 6 | (p[c] & 0x3F); return 3;
-}
-
-static int get_b_utf8(const symbol * p, int c, int lb, int * slot) {
-    int b0, b1;
-    if (c <= lb) return 0;
-    b0 = p[--c];
-    if (b0 < 0x80 || c == lb) {   /* 1000 0000 */
-        * slot = b0; return 1;
-    }
-    b1 = p[--c];
-    if (b1 >= 0xC0 || c == lb) {   /* 1100 0000 */
-        * slot = (b1 & 0x1F) << 6 | (b0 & 0x3F); return 2;
-    }
-    * slot = (p[c] & 0xF) << 12 | (b1 & 0x3F) << 6 | (b0 & 0x3F); return 3;
-}
+/* The bodies of the routines below live in inline.h. */
 
 extern int in_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-	int ch;
-	int w = get_utf8(z->p, z->c, z->l, & ch);
-	unless (w) return -1;
-	if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-	    return w;
-	z->c += w;
-    } while (repeat);
-    return 0;
+    return sn_in_grouping_U(z, s, min, max, repeat);
 }
 
 extern int in_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-	int ch;
-	int w = get_b_utf8(z->p, z->c, z->lb, & ch);
-	unless (w) return -1;
-	if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-	    return w;
-	z->c -= w;
-    } while (repeat);
-    return 0;
+    return sn_in_grouping_b_U(z, s, min, max, repeat);
 }
 
 extern int out_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-	int ch;
-	int w = get_utf8(z->p, z->c, z->l, & ch);
-	unless (w) return -1;
-	unless (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-	    return w;
-	z->c += w;
-    } while (repeat);
-    return 0;
+    return sn_out_grouping_U(z, s, min, max, repeat);
 }
 
 extern int out_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-	int ch;
-	int w = get_b_utf8(z->p, z->c, z->lb, & ch);
-	unless (w) return -1;
-	unless (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-	    return w;
-	z->c -= w;
-    } while (repeat);
-    return 0;
+    return sn_out_grouping_b_U(z, s, min, max, repeat);
 }
 
-/* Code for character groupings: non-utf8 cases */
-
 extern int in_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-	int ch;
-	if (z->c >= z->l) return -1;
-	ch = z->p[z->c];
-	if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-	    return 1;
-	z->c++;
-    } while (repeat);
-    return 0;
+    return sn_in_grouping(z, s, min, max, repeat);
 }
 
 extern int in_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-	int ch;
-	if (z->c <= z->lb) return -1;
-	ch = z->p[z->c - 1];
-	if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-	    return 1;
-	z->c--;
-    } while (repeat);
-    return 0;
+    return sn_in_grouping_b(z, s, min, max, repeat);
 }
 
 extern int out_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-	int ch;
-	if (z->c >= z->l) return -1;
-	ch = z->p[z->c];
-	unless (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-	    return 1;
-	z->c++;
-    } while (repeat);
-    return 0;
+    return sn_out_grouping(z, s, min, max, repeat);
 }
 
 extern int out_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-	int ch;
-	if (z->c <= z->lb) return -1;
-	ch = z->p[z->c - 1];
-	unless (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-	    return 1;
-	z->c--;
-    } while (repeat);
-    return 0;
+    return sn_out_grouping_b(z, s, min, max, repeat);
 }
 
 extern int eq_s(struct SN_env * z, int s_size, const symbol * s) {
-    if (z->l - z->c < s_size || memcmp(z->p + z->c, s, s_size * sizeof(symbol)) != 0) return 0;
-    z->c += s_size; return 1;
+    return sn_eq_s(z, s_size, s);
 }
 
 extern int eq_s_b(struct SN_env * z, int s_size, const symbol * s) {
-    if (z->c - z->lb < s_size || memcmp(z->p + z->c - s_size, s, s_size * sizeof(symbol)) != 0) return 0;
-    z->c -= s_size; return 1;
+    return sn_eq_s_b(z, s_size, s);
 }
 
 extern int eq_v(struct SN_env * z, const symbol * p) {
-    return eq_s(z, SIZE(p), p);
+    return sn_eq_v(z, p);
 }
 
 extern int eq_v_b(struct SN_env * z, const symbol * p) {
-    return eq_s_b(z, SIZE(p), p);
+    return sn_eq_v_b(z, p);
 }
 
 extern int find_among(struct SN_env * z, const struct among * v, int v_size) {
-
-    int i = 0;
-    int j = v_size;
-
-    int c = z->c; int l = z->l;
-    symbol * q = z->p + c;
-
-    const struct among * w;
-
-    int common_i = 0;
-    int common_j = 0;
-
-    int first_key_inspected = 0;
-
-    while(1) {
-        int k = i + ((j - i) >> 1);
-        int diff = 0;
-        int common = common_i < common_j ? common_i : common_j; /* smaller */
-        w = v + k;
-        {
-            int i2; for (i2 = common; i2 < w->s_size; i2++) {
-                if (c + common == l) { diff = -1; break; }
-                diff = q[common] - w->s[i2];
-                if (diff != 0) break;
-                common++;
-            }
-        }
-        if (diff < 0) { j = k; common_j = common; }
-                 else { i = k; common_i = common; }
-        if (j - i <= 1) {
-            if (i > 0) break; /* v->s has been inspected */
-            if (j == i) break; /* only one item in v */
-
-            /* - but now we need to go round once more to get
-               v->s inspected. This looks messy, but is actually
-               the optimal approach.  */
-
-            if (first_key_inspected) break;
-            first_key_inspected = 1;
-        }
-    }
-    while(1) {
-        w = v + i;
-        if (common_i >= w->s_size) {
-            z->c = c + w->s_size;
-            if (w->function == 0) return w->result;
-            {
-                int res = w->function(z);
-                z->c = c + w->s_size;
-                if (res) return w->result;
-            }
-        }
-        i = w->substring_i;
-        if (i < 0) return 0;
-    }
+    return sn_find_among(z, v, v_size);
 }
 
-/* find_among_b is for backwards processing. Same comments apply */
-
 extern int find_among_b(struct SN_env * z, const struct among * v, int v_size) {
-
-    int i = 0;
-    int j = v_size;
-
-    int c = z->c; int lb = z->lb;
-    symbol * q = z->p + c - 1;
-
-    const struct among * w;
-
-    int common_i = 0;
-    int common_j = 0;
-
-    int first_key_inspected = 0;
-
-    while(1) {
-        int k = i + ((j - i) >> 1);
-        int diff = 0;
-        int common = common_i < common_j ? common_i : common_j;
-        w = v + k;
-        {
-            int i2; for (i2 = w->s_size - 1 - common; i2 >= 0; i2--) {
-                if (c - common == lb) { diff = -1; break; }
-                diff = q[- common] - w->s[i2];
-                if (diff != 0) break;
-                common++;
-            }
-        }
-        if (diff < 0) { j = k; common_j = common; }
-                 else { i = k; common_i = common; }
-        if (j - i <= 1) {
-            if (i > 0) break;
-            if (j == i) break;
-            if (first_key_inspected) break;
-            first_key_inspected = 1;
-        }
-    }
-    while(1) {
-        w = v + i;
-        if (common_i >= w->s_size) {
-            z->c = c - w->s_size;
-            if (w->function == 0) return w->result;
-            {
-                int res = w->function(z);
-                z->c = c - w->s_size;
-                if (res) return w->result;
-            }
-        }
-        i = w->substring_i;
-        if (i < 0) return 0;
-    }
+    return sn_find_among_b(z, v, v_size);
 }
 
-
 /* Increase the size of the buffer pointed to by p to at least n symbols.
  * If insufficient memory, returns NULL and frees the old buffer.
  */
 static symbol * increase_size(symbol * p, int n) {
     symbol * q;
     int new_size = n + 20;
-    void * mem = realloc((char *) p - HEAD,
+    void * mem = sn_realloc((char *) p - HEAD,
                          HEAD + (new_size + 1) * sizeof(symbol));
     if (mem == NULL) {
         lose_s(p);
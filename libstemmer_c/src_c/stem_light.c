@@ -0,0 +1,147 @@
+
+/* Light stemmers: plurals, possessives and the commonest inflections
+ * stripped by hand, at a fraction of the cost of the full algorithms, for
+ * tables where that matters more than recall. They are not generated by
+ * the Snowball compiler, but have the entry points of a generated module
+ * and are registered as <language>_light.
+ *
+ *   english  the S-stemmer of Harman (1991), after the possessive
+ *   french   the minimal stemmer of Savoy
+ *   german   the minimal stemmer of Savoy, umlauts folded first
+ *   spanish  the light stemmer of Savoy, accents of the vowels folded first
+ *
+ * Words are stemmed in place; none gets longer.  Lengths are counted in
+ * characters, and the suffixes are ASCII, so a word stems the same in
+ * ISO-8859-1 and UTF-8.
+ */
+
+#include "../runtime/header.h"
+#include "stem_light.h"
+
+/* base letters of U+00E0 to U+00FF, 0 for a character that stays */
+static const symbol g_umlauts[32] = {
+    0, 0, 0, 0, 'a', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 'o', 0, 0, 0, 0, 0, 'u', 0, 0, 0
+};
+static const symbol g_vowels[32] = {
+    'a', 'a', 'a', 0, 'a', 0, 0, 0, 'e', 'e', 'e', 'e', 'i', 'i', 'i', 'i',
+    0, 0, 'o', 'o', 'o', 0, 'o', 0, 0, 'u', 'u', 'u', 'u', 0, 0, 0
+};
+
+/* Replaces the letters of U+00E0 to U+00FF that map has by their base letters. */
+static int fold(symbol * p, int l, int utf8, const symbol * map) {
+    int i, j = 0;
+    for (i = 0; i < l; i++) {
+        int c = p[i];
+        if (utf8 && c == 0xC3 && i + 1 < l && p[i + 1] >= 0xA0 && p[i + 1] <= 0xBF && map[p[i + 1] - 0xA0]) {
+            p[j++] = map[p[++i] - 0xA0];
+        } else if (!utf8 && c >= 0xE0 && map[c - 0xE0]) {
+            p[j++] = map[c - 0xE0];
+        } else {
+            p[j++] = c;
+        }
+    }
+    return j;
+}
+
+static int chars(const symbol * p, int l, int utf8) {
+    int i, n = l;
+    if (utf8) {
+        for (i = 0; i < l; i++) {
+            if ((p[i] & 0xC0) == 0x80) n--;
+        }
+    }
+    return n;
+}
+
+static int english_light(symbol * p, int l, int utf8) {
+    (void) utf8;
+    if (l >= 2 && p[l - 2] == '\'' && p[l - 1] == 's') l -= 2;
+    else if (l >= 1 && p[l - 1] == '\'') l--;
+    if (l < 3 || p[l - 1] != 's') return l;
+    switch (p[l - 2]) {
+        case 'u': case 's': return l; /* status, class */
+        case 'e':
+            if (l > 3 && p[l - 3] == 'i' && p[l - 4] != 'a' && p[l - 4] != 'e') {
+                p[l - 3] = 'y'; /* ponies, but not aies and eies */
+                return l - 2;
+            }
+            if (p[l - 3] == 'i' || p[l - 3] == 'a' || p[l - 3] == 'o' || p[l - 3] == 'e') return l;
+            /* fall through */
+        default:
+            return l - 1;
+    }
+}
+
+static int french_light(symbol * p, int l, int utf8) {
+    if (chars(p, l, utf8) < 6) return l;
+    if (p[l - 1] == 'x') {
+        if (p[l - 3] == 'a' && p[l - 2] == 'u') p[l - 2] = 'l'; /* chevaux */
+        return l - 1;
+    }
+    if (p[l - 1] == 's') l--;
+    if (p[l - 1] == 'r') l--;
+    if (p[l - 1] == 'e') l--;
+    if (utf8 ? l >= 2 && p[l - 2] == 0xC3 && p[l - 1] == 0xA9 : p[l - 1] == 0xE9) l -= utf8 ? 2 : 1;
+    if (l >= 2 && p[l - 1] < 0x80 && p[l - 1] == p[l - 2]) l--;
+    return l;
+}
+
+static int german_light(symbol * p, int l, int utf8) {
+    if (chars(p, l, utf8) < 5) return l;
+    l = fold(p, l, utf8, g_umlauts);
+    if (chars(p, l, utf8) > 6 && p[l - 3] == 'n' && p[l - 2] == 'e' && p[l - 1] == 'n') return l - 3;
+    if (chars(p, l, utf8) > 5) {
+        switch (p[l - 1]) {
+            case 'n': case 's': case 'r':
+                if (p[l - 2] == 'e') return l - 2;
+                break;
+            case 'e':
+                if (p[l - 2] == 's') return l - 2;
+                break;
+        }
+    }
+    switch (p[l - 1]) {
+        case 'n': case 'e': case 's': case 'r': return l - 1;
+    }
+    return l;
+}
+
+static int spanish_light(symbol * p, int l, int utf8) {
+    if (chars(p, l, utf8) < 5) return l;
+    l = fold(p, l, utf8, g_vowels);
+    switch (p[l - 1]) {
+        case 'o': case 'a': case 'e': return l - 1;
+        case 's':
+            if (p[l - 2] == 'e' && p[l - 3] == 's' && p[l - 4] == 'e') return l - 2; /* meses */
+            if (p[l - 2] == 'e' && p[l - 3] == 'c') {
+                p[l - 3] = 'z'; /* luces */
+                return l - 2;
+            }
+            if (p[l - 2] == 'o' || p[l - 2] == 'a' || p[l - 2] == 'e') return l - 2;
+            break;
+    }
+    return l;
+}
+
+/* The environment holds the word only.  Its size is kept with z->l, as
+ * SN_set_current() replaces the word by it. */
+#define LIGHT_MODULE(lang, enc, utf8) \
+extern struct SN_env * lang##_light_##enc##_create_env(void) { return SN_create_env(0, 0, 0); } \
+extern void lang##_light_##enc##_close_env(struct SN_env * z) { SN_close_env(z, 0); } \
+extern int lang##_light_##enc##_stem(struct SN_env * z) { \
+    z->l = lang##_light(z->p, z->l, utf8); \
+    SET_SIZE(z->p, z->l); \
+    z->c = 0; \
+    return 1; \
+}
+
+LIGHT_MODULE(english, ISO_8859_1, 0)
+LIGHT_MODULE(english, UTF_8, 1)
+LIGHT_MODULE(french, ISO_8859_1, 0)
+LIGHT_MODULE(french, UTF_8, 1)
+LIGHT_MODULE(german, ISO_8859_1, 0)
+LIGHT_MODULE(german, UTF_8, 1)
+LIGHT_MODULE(spanish, ISO_8859_1, 0)
+LIGHT_MODULE(spanish, UTF_8, 1)
+
@@ -0,0 +1,42 @@
+/* Hand-written light stemmers, see stem_light.c */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * english_light_ISO_8859_1_create_env(void);
+extern void english_light_ISO_8859_1_close_env(struct SN_env * z);
+extern int english_light_ISO_8859_1_stem(struct SN_env * z);
+
+extern struct SN_env * english_light_UTF_8_create_env(void);
+extern void english_light_UTF_8_close_env(struct SN_env * z);
+extern int english_light_UTF_8_stem(struct SN_env * z);
+
+extern struct SN_env * french_light_ISO_8859_1_create_env(void);
+extern void french_light_ISO_8859_1_close_env(struct SN_env * z);
+extern int french_light_ISO_8859_1_stem(struct SN_env * z);
+
+extern struct SN_env * french_light_UTF_8_create_env(void);
+extern void french_light_UTF_8_close_env(struct SN_env * z);
+extern int french_light_UTF_8_stem(struct SN_env * z);
+
+extern struct SN_env * german_light_ISO_8859_1_create_env(void);
+extern void german_light_ISO_8859_1_close_env(struct SN_env * z);
+extern int german_light_ISO_8859_1_stem(struct SN_env * z);
+
+extern struct SN_env * german_light_UTF_8_create_env(void);
+extern void german_light_UTF_8_close_env(struct SN_env * z);
+extern int german_light_UTF_8_stem(struct SN_env * z);
+
+extern struct SN_env * spanish_light_ISO_8859_1_create_env(void);
+extern void spanish_light_ISO_8859_1_close_env(struct SN_env * z);
+extern int spanish_light_ISO_8859_1_stem(struct SN_env * z);
+
+extern struct SN_env * spanish_light_UTF_8_create_env(void);
+extern void spanish_light_UTF_8_close_env(struct SN_env * z);
+extern int spanish_light_UTF_8_stem(struct SN_env * z);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -1,15 +1,17 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <time.h>
 
-#include "ftbool.h"
-#include "ftstring.h"
+#include "ftcore.h"
+#include "ftcache.h"
+#include "ftlog.h"
+#include "ftcapture.h"
+#include "ftprobe.h"
+#include "ftslab.h"
 #if HAVE_ICU
-#include <unicode/uclean.h>
 #include <unicode/uversion.h>
 #include <unicode/uchar.h>
-#include <unicode/unorm.h>
-#include "ftnorm.h"
 #endif
 #include "libstemmer_c/include/libstemmer.h"
 
@@ -21,26 +23,177 @@
 #include <plugin.h>
 
 #define HA_FT_MAXBYTELEN 254
-#define FTPPC_MEMORY_ERROR -1
-#define FTPPC_NORMALIZATION_ERROR -2
-#define FTPPC_SYNTAX_ERROR -3
+#define FTPPC_MEMORY_ERROR FTCORE_MEMORY_ERROR
+#define FTPPC_NORMALIZATION_ERROR FTCORE_NORMALIZATION_ERROR
+#define FTPPC_SYNTAX_ERROR FTCORE_SYNTAX_ERROR
+#define SNOWBALL_SLOW_LOG_RING 1048576
+#define SNOWBALL_CAPTURE_RING  16777216 // also the largest document captured
 
 #if !defined(__attribute__) && (defined(__cplusplus) || !defined(__GNUC__)  || __GNUC__ == 2 && __GNUC_MINOR__ < 8)
 #define __attribute__(A)
 #endif
 
+/**
+ * MySQL adapter of libftsnowball_core: mysql charsets become FTCORE_CODECs,
+ * memory comes from mysys, and the tokens go to mysql_parse.
+ */
+
 static char* snowball_unicode_normalize;
 static char* snowball_unicode_version;
+static char* snowball_tokenizer;
 static char* snowball_algorithm;
+static char* snowball_drop_tokens;
+static char* snowball_emit;
+static ulong snowball_edge_min;
+static ulong snowball_edge_max;
+static ulong snowball_cache_size;
+static ulong snowball_parallel_threads;
+static ulong snowball_parallel_threshold;
+static ulong snowball_time_budget;
+static my_bool snowball_budget_skip;
+static my_bool snowball_unaccent;
+static ulong snowball_budget_exceeded = 0;
+static char* snowball_dictionary;
+static FTDICT* snowball_dict = NULL;
+static ulong snowball_dictionary_entries = 0;
+static char* snowball_slow_log;
+static ulong snowball_slow_log_threshold;
+static FTLOG* snowball_slow_log_writer = NULL;
+static ulong snowball_slow_documents = 0;
+static ulong snowball_slow_log_dropped = 0;
+static char* snowball_capture;
+static ulong snowball_capture_sample;
+static ulong snowball_capture_max_size;
+static FTLOG* snowball_capture_writer = NULL;
+static ulong snowball_capture_seen = 0;
+static ulonglong snowball_capture_bytes = 0;
+static ulong snowball_captured_documents = 0;
+static ulong snowball_capture_dropped = 0;
 static char snowball_info[128];
 
-static void  icu_free(const void* context, void *ptr){ my_free(ptr); }
-static void* icu_malloc(const void* context, size_t size){ return my_malloc(size,MYF(MY_WME)); }
-static void* icu_realloc(const void* context, void* ptr, size_t size){
+/** core hooks */
+static void* ftppc_malloc(size_t size){ return my_malloc(size, MYF(MY_WME)); }
+static void* ftppc_realloc(void *ptr, size_t size){
   if(ptr!=NULL) return my_realloc(ptr,size,MYF(MY_WME));
   else return my_malloc(size,MYF(MY_WME));
 }
+static void  ftppc_free(void *ptr){ my_free(ptr); }
+static void  ftppc_thread_start(void){ my_thread_init(); }
+static void  ftppc_thread_end(void){ my_thread_end(); }
+
+static const FTCORE_HOOKS ftppc_hooks = {
+  ftppc_malloc, ftppc_realloc, ftppc_free, ftppc_thread_start, ftppc_thread_end
+};
+/** /core hooks */
+
+/** mysql charset codec */
+static int ftppc_decode(const FTCORE_CODEC *codec, ftcore_wc *wc, const unsigned char *s, const unsigned char *e){
+  CHARSET_INFO *cs = (CHARSET_INFO*)codec->data;
+  my_wc_t tmp;
+  int ret = cs->cset->mb_wc(cs, &tmp, (uchar*)s, (uchar*)e);
+  if(ret > 0){
+    *wc = (ftcore_wc)tmp;
+    return ret;
+  }
+  return ret == MY_CS_ILSEQ ? FTCORE_ILSEQ : FTCORE_TOOSMALL;
+}
+
+static int ftppc_encode(const FTCORE_CODEC *codec, ftcore_wc wc, unsigned char *s, unsigned char *e){
+  CHARSET_INFO *cs = (CHARSET_INFO*)codec->data;
+  int ret = cs->cset->wc_mb(cs, (my_wc_t)wc, (uchar*)s, (uchar*)e);
+  if(ret > 0){
+    return ret;
+  }
+  return ret == MY_CS_ILUNI ? FTCORE_ILSEQ : FTCORE_TOOSMALL;
+}
+
+static int ftppc_ctype(const FTCORE_CODEC *codec, const unsigned char *s, const unsigned char *e, int *length){
+  CHARSET_INFO *cs = (CHARSET_INFO*)codec->data;
+  my_wc_t wc = 0;
+  int ctype = 0;
+  int flags = 0;
+  *length = cs->cset->ctype(cs, &ctype, (uchar*)s, (uchar*)e);
+  if(ctype & (_MY_U | _MY_L | _MY_NMR)){
+    flags |= FTCORE_CT_WORD;
+  }else{
+    cs->cset->mb_wc(cs, &wc, (uchar*)s, (uchar*)e);
+    if(wc == '_'){
+      flags |= FTCORE_CT_WORD;
+    }
+  }
+  if(my_isspace(cs, *s)){
+    flags |= FTCORE_CT_SPACE;
+  }
+  return flags;
+}
 
+/** the 4 byte sequences of utf8mb4 are above the planes mysql has ctypes for. */
+static int ftppc_ctype_utf8(const FTCORE_CODEC *codec, const unsigned char *s, const unsigned char *e, int *length){
+  if(*s >= 0xF0){
+    return ftcore_codec_utf8.ctype(&ftcore_codec_utf8, s, e, length);
+  }
+  return ftppc_ctype(codec, s, e, length);
+}
+
+/** mysql charsets snowball has modules for */
+static const char* ftppc_stemmer_encodings[][2] = {
+  { "utf8",    "UTF_8" },
+  { "utf8mb3", "UTF_8" },
+  { "utf8mb4", "UTF_8" },
+  { "latin1",  "ISO_8859_1" },
+  { "cp850",   "CP850" },
+  { "koi8r",   "KOI8_R" },
+  { NULL, NULL }
+};
+
+/** mysql charsets of more than a byte ftconv has kernels for */
+static const struct {
+  const char *name;
+  int encoding;
+} ftppc_wide_encodings[] = {
+  { "ucs2",    FTCORE_ENC_UCS2 },
+  { "utf16",   FTCORE_ENC_UTF16 },
+  { "utf16le", FTCORE_ENC_UTF16LE },
+  { "utf32",   FTCORE_ENC_UTF32 },
+  { NULL, 0 }
+};
+
+static void ftppc_codec_init(FTCORE_CODEC *codec, CHARSET_INFO *cs){
+  int i;
+  codec->name = cs->csname;
+  codec->stemmer_encoding = NULL;
+  for(i=0; ftppc_stemmer_encodings[i][0]; i++){
+    if(strcmp(cs->csname, ftppc_stemmer_encodings[i][0])==0){
+      codec->stemmer_encoding = ftppc_stemmer_encodings[i][1];
+    }
+  }
+  // every alias of UTF-8 is fed to the stemmers and ICU as it is
+  codec->flags = codec->stemmer_encoding && strcmp(codec->stemmer_encoding, "UTF_8")==0 ? FTCORE_CODEC_UTF8 : 0;
+  codec->mbmaxlen = (int)cs->mbmaxlen;
+  codec->decode = ftppc_decode;
+  codec->encode = ftppc_encode;
+  codec->ctype = cs->mbmaxlen >= 4 && codec->flags ? ftppc_ctype_utf8 : ftppc_ctype;
+  codec->data = cs;
+  // charsets ftconv converts without the charset handler
+  codec->to_uni = NULL;
+  codec->encoding = FTCORE_ENC_OTHER;
+  if(codec->flags & FTCORE_CODEC_UTF8){
+    codec->encoding = FTCORE_ENC_UTF8;
+  }else if(cs->mbmaxlen == 1 && cs->tab_to_uni){
+    codec->encoding = FTCORE_ENC_SBCS;
+    codec->to_uni = cs->tab_to_uni;
+  }else{
+    for(i=0; ftppc_wide_encodings[i].name; i++){
+      if(strcmp(cs->csname, ftppc_wide_encodings[i].name)==0){
+        codec->encoding = ftppc_wide_encodings[i].encoding;
+      }
+    }
+  }
+}
+
+/** the codec for text transcoded into UTF-8 */
+static FTCORE_CODEC ftppc_utf8;
+/** /mysql charset codec */
 
 /** ftstate */
 static LIST* list_top(LIST* root){
@@ -61,8 +214,14 @@ struct ftppc_state {
   /** immutable memory buffer */
   size_t bulksize;
   LIST*  mem_root;
-  void*  engine;
-  CHARSET_INFO* engine_charset;
+  FTCORE_PARSER* parser;
+  /** the charset of the documents */
+  FTCORE_CODEC codec;
+  /** token stream of the current document, for the parse cache */
+  int    recording;
+  FTCORE_TOKENS record;
+  /** words handed to mysql for the current document */
+  ulong  tokens;
 };
 
 static void* ftppc_alloc(struct ftppc_state *state, size_t length){
@@ -82,6 +241,7 @@ static void* ftppc_alloc(struct ftppc_state *state, size_t length){
       tmp->mem_size = sz;
       
       if(!tmp->mem_head){ return NULL; }
+      FTPROBE1(arena_grow, sz);
       
       state->mem_root = list_cons(tmp, cur);
       cur = state->mem_root;
@@ -97,14 +257,200 @@ static void* ftppc_alloc(struct ftppc_state *state, size_t length){
     cur = cur->prev;
   }
 }
+
+/**
+ * Appends a token to the record of the current document. Recording stops
+ * once the document would not fit into the cache.
+ */
+static void ftppc_record(struct ftppc_state *state, const char *word, size_t length){
+  char *pos = ftcore_tokens_push(&state->record, length, ftcache_max_entry());
+  if(!pos){
+    state->recording = 0;
+    return;
+  }
+  memcpy(pos, word, length);
+}
 /** /ftstate */
 
+/** config descriptor */
+/**
+ * The settings that change the parse result, copied out of the system
+ * variables whenever one of them is updated and published with one pointer
+ * swap. A parse loads the pointer once and reads a consistent, immutable
+ * snapshot without taking a lock; the generation tells the parsers and the
+ * parse cache that the settings changed.
+ */
+struct snowball_descriptor {
+  FTCORE_CONFIG config;
+  ulong generation;
+  char *algorithm;
+  /** the descriptor this one replaced. descriptors are freed at plugin deinit. */
+  struct snowball_descriptor *retired;
+};
+
+static struct snowball_descriptor *snowball_current = NULL;
+static ulong snowball_generation = 0;
+
+struct snowball_flag {
+  const char *name;
+  int flag;
+};
+
+static const struct snowball_flag snowball_classes[] = {
+  { "NUMERIC", FTCORE_CLASS_NUMERIC }, { "HEX", FTCORE_CLASS_HEX }, { "OVERLONG", FTCORE_CLASS_OVERLONG }, { NULL, 0 }
+};
+
+static const struct snowball_flag snowball_emits[] = {
+  { "SURFACE", FTCORE_EMIT_SURFACE }, { "EDGE", FTCORE_EMIT_EDGE }, { "TRIGRAM", FTCORE_EMIT_TRIGRAM }, { NULL, 0 }
+};
+
+/**
+ * @param flags the flags of a comma separated list of names
+ * @return 0 if the list is valid
+ */
+static int snowball_flag_list(const char *str, const struct snowball_flag *names, int *flags){
+  *flags = 0;
+  while(str && *str){
+    size_t len = strcspn(str, ",");
+    uint i;
+    for(i=0; names[i].name; i++){
+      if(len == strlen(names[i].name) && strncmp(str, names[i].name, len) == 0){
+        *flags |= names[i].flag;
+        break;
+      }
+    }
+    if(!names[i].name){
+      return -1;
+    }
+    str += len;
+    if(*str == ','){ str++; }
+  }
+  return 0;
+}
+
+/** builds a descriptor from the system variables and publishes it. */
+static int snowball_descriptor_publish(){
+  struct snowball_descriptor *d = (struct snowball_descriptor*)my_malloc(sizeof(struct snowball_descriptor), MYF(MY_WME|MY_ZEROFILL));
+  if(!d){
+    return FTPPC_MEMORY_ERROR;
+  }
+  if(snowball_algorithm){
+    d->algorithm = my_strdup(snowball_algorithm, MYF(MY_WME));
+    if(!d->algorithm){
+      my_free(d);
+      return FTPPC_MEMORY_ERROR;
+    }
+  }
+  FTCORE_CONFIG *config = &d->config;
+  config->algorithm = d->algorithm;
+  config->normalization = FTCORE_NORM_NONE;
+  if(snowball_unicode_normalize){
+    if(strcmp(snowball_unicode_normalize, "C")==0) config->normalization = FTCORE_NORM_C;
+    if(strcmp(snowball_unicode_normalize, "D")==0) config->normalization = FTCORE_NORM_D;
+    if(strcmp(snowball_unicode_normalize, "KC")==0) config->normalization = FTCORE_NORM_KC;
+    if(strcmp(snowball_unicode_normalize, "KD")==0) config->normalization = FTCORE_NORM_KD;
+    if(strcmp(snowball_unicode_normalize, "FCD")==0) config->normalization = FTCORE_NORM_FCD;
+    if(strcmp(snowball_unicode_normalize, "C_CF")==0) config->normalization = FTCORE_NORM_C_CF;
+    if(strcmp(snowball_unicode_normalize, "KC_CF")==0) config->normalization = FTCORE_NORM_KC_CF;
+  }
+#if HAVE_ICU
+  if(snowball_unicode_version && strcmp(snowball_unicode_version, "3.2")==0) config->unicode_3_2 = 1;
+#endif
+  config->utf8 = ftppc_utf8.data ? &ftppc_utf8 : NULL;
+  config->dictionary = snowball_dict;
+  config->max_token_bytes = HA_FT_MAXBYTELEN;
+  config->unaccent = snowball_unaccent;
+  if(snowball_tokenizer && strcmp(snowball_tokenizer, "CJK_BIGRAM")==0) config->tokenizer = FTCORE_TOKENIZER_CJK_BIGRAM;
+  if(snowball_tokenizer && strcmp(snowball_tokenizer, "ICU")==0) config->tokenizer = FTCORE_TOKENIZER_ICU;
+  snowball_flag_list(snowball_drop_tokens, snowball_classes, &config->drop);
+  snowball_flag_list(snowball_emit, snowball_emits, &config->emit);
+  config->edge_min = (unsigned int)snowball_edge_min;
+  config->edge_max = (unsigned int)snowball_edge_max;
+  // mysqld serializes the updates of system variables.
+  d->generation = ++snowball_generation;
+  config->generation = d->generation;
+  // readers that load the pointer with acquire see the contents.
+  d->retired = __atomic_exchange_n(&snowball_current, d, __ATOMIC_ACQ_REL);
+  return 0;
+}
+
+static void snowball_descriptor_free_all(){
+  struct snowball_descriptor *d = __atomic_exchange_n(&snowball_current, NULL, __ATOMIC_ACQ_REL);
+  while(d){
+    struct snowball_descriptor *next = d->retired;
+    if(d->algorithm){ my_free(d->algorithm); }
+    my_free(d);
+    d = next;
+  }
+}
+/** /config descriptor */
+
 
 static int snowball_parser_plugin_init(void *arg __attribute__((unused))){
   snowball_info[0] = '\0';
+  if(ftcore_init(&ftppc_hooks, (uint)snowball_parallel_threads)){
+    return(1);
+  }
+  if(snowball_dictionary && strlen(snowball_dictionary) > 0){
+    unsigned int i;
+    snowball_dict = ftdict_open(snowball_dictionary);
+    if(!snowball_dict){
+      fprintf(stderr, "snowball: %s is not a stem dictionary\n", snowball_dictionary);
+      fflush(stderr);
+      ftcore_deinit();
+      return(1);
+    }
+    snowball_dictionary_entries = 0;
+    for(i=0; i<ftdict_sections(snowball_dict); i++){
+      snowball_dictionary_entries += (ulong)ftdict_section_entries(ftdict_section(snowball_dict, i));
+    }
+  }
+  if(snowball_slow_log && strlen(snowball_slow_log) > 0){
+    snowball_slow_log_writer = ftlog_open(snowball_slow_log, SNOWBALL_SLOW_LOG_RING);
+    if(!snowball_slow_log_writer){
+      fprintf(stderr, "snowball: can not open %s for the slow document log\n", snowball_slow_log);
+      fflush(stderr);
+      ftcore_deinit();
+      ftdict_close(snowball_dict);
+      snowball_dict = NULL;
+      return(1);
+    }
+  }
+  if(snowball_capture && strlen(snowball_capture) > 0){
+    snowball_capture_writer = ftlog_open(snowball_capture, SNOWBALL_CAPTURE_RING);
+    if(!snowball_capture_writer){
+      fprintf(stderr, "snowball: can not open %s for capturing documents\n", snowball_capture);
+      fflush(stderr);
+      ftcore_deinit();
+      ftdict_close(snowball_dict);
+      snowball_dict = NULL;
+      ftlog_close(snowball_slow_log_writer);
+      snowball_slow_log_writer = NULL;
+      return(1);
+    }
+  }
+  ftcache_init((size_t)snowball_cache_size);
+  // transcode into utf8mb4 where the server has it, so nothing outside the BMP is lost
+  CHARSET_INFO *uc = get_charset_by_csname("utf8mb4", MY_CS_PRIMARY, MYF(0));
+  if(!uc){
+    uc = get_charset(33, MYF(0)); // my_charset_utf8_general_ci
+  }
+  if(uc){
+    ftppc_codec_init(&ftppc_utf8, uc);
+  }
+  if(snowball_descriptor_publish()){
+    ftcore_deinit();
+    ftcache_deinit();
+    ftdict_close(snowball_dict);
+    snowball_dict = NULL;
+    ftlog_close(snowball_slow_log_writer);
+    snowball_slow_log_writer = NULL;
+    ftlog_close(snowball_capture_writer);
+    snowball_capture_writer = NULL;
+    return(1);
+  }
 #if HAVE_ICU
   char icu_tmp_str[16];
-  char errstr[128];
   UVersionInfo versionInfo;
   u_getVersion(versionInfo); // get ICU version
   u_versionToString(versionInfo, icu_tmp_str);
@@ -115,14 +461,6 @@ static int snowball_parser_plugin_init(void *arg __attribute__((unused))){
   strcat(snowball_info, "(Unicode ");
   strcat(snowball_info, icu_tmp_str);
   strcat(snowball_info, ")");
-  
-  UErrorCode ustatus=0;
-  u_setMemoryFunctions(NULL, icu_malloc, icu_realloc, icu_free, &ustatus);
-  if(U_FAILURE(ustatus)){
-    sprintf(errstr, "u_setMemoryFunctions failed. ICU status code %d\n", ustatus);
-    fputs(errstr, stderr);
-    fflush(stderr);
-  }
 #else
   strcat(snowball_info, "without ICU");
 #endif
@@ -130,409 +468,330 @@ static int snowball_parser_plugin_init(void *arg __attribute__((unused))){
 }
 
 static int snowball_parser_plugin_deinit(void *arg __attribute__((unused))){
+  ftcore_deinit();
+  ftcache_deinit();
+  ftdict_close(snowball_dict);
+  snowball_dict = NULL;
+  ftlog_close(snowball_slow_log_writer);
+  snowball_slow_log_writer = NULL;
+  ftlog_close(snowball_capture_writer);
+  snowball_capture_writer = NULL;
+  snowball_descriptor_free_all();
   return(0);
 }
 
 
 static int snowball_parser_init(MYSQL_FTPARSER_PARAM *param __attribute__((unused))){
-  struct ftppc_state tmp ={ 8, NULL, NULL, NULL };
-  struct ftppc_state *state = (struct ftppc_state*)my_malloc(sizeof(struct ftppc_state), MYF(MY_WME));
+  struct ftppc_state *state = (struct ftppc_state*)my_malloc(sizeof(struct ftppc_state), MYF(MY_WME|MY_ZEROFILL));
   if(!state){
     return(FTPPC_MEMORY_ERROR);
   }
-  *state = tmp;
+  state->bulksize = 8;
+  state->parser = ftcore_parser_new();
+  if(!state->parser){
+    my_free(state);
+    return(FTPPC_MEMORY_ERROR);
+  }
   param->ftparser_state = state;
   
   return(0);
 }
 static int snowball_parser_deinit(MYSQL_FTPARSER_PARAM *param __attribute__((unused))){
   struct ftppc_state *state = (struct ftppc_state*)param->ftparser_state;
-  sb_stemmer_delete((struct sb_stemmer *)state->engine);
   list_free(state->mem_root, 1);
+  ftcore_parser_free(state->parser);
+  ftcore_tokens_free(&state->record);
   my_free(state);
   return(0);
 }
 
-static int iswchar(CHARSET_INFO *cs, char *doc, char *end, int *readsize){
-  my_wc_t wc;
-  int ctype;
-  *readsize = cs->cset->ctype(cs, &ctype, (uchar*)doc, (uchar*)end);
-  if(ctype & (_MY_U | _MY_L | _MY_NMR)){
-    return 1;
-  }
-  cs->cset->mb_wc(cs, &wc, (uchar*)doc, (uchar*)end);
-  if(wc == '_'){ 
-    return 1;
-  }
-  return 0;
-}
-
-static size_t str_convert(CHARSET_INFO *cs, char *from, size_t from_length,
-                          CHARSET_INFO *uc, char *to,   size_t to_length,
-                          size_t *numchars){
-  char *rpos, *rend, *wpos, *wend;
-  my_wc_t wc;
-  char* tmp = NULL;
+/** ftcore_sink: hands the tokens to mysql */
+static int snowball_sink(void *ctx, const char *word, size_t length, const FTCORE_BOOLEAN_INFO *info){
+  MYSQL_FTPARSER_PARAM *param = (MYSQL_FTPARSER_PARAM*)ctx;
+  struct ftppc_state *state = (struct ftppc_state*)param->ftparser_state;
   
-  if(numchars){ *numchars = 0; }
-  rpos = from;
-  rend = from + from_length;
-  wpos = to;
-  wend = to + to_length;
-  while(rpos < rend){
-    int cnvres = 0;
-    cnvres = cs->cset->mb_wc(cs, &wc, (uchar*)rpos, (uchar*)rend);
-    if(cnvres > 0){
-      rpos += cnvres;
-    }else if(cnvres == MY_CS_ILSEQ){
-      rpos++;
-      wc = '?';
-    }else{
-      break;
+  if(info && info->type != FTCORE_TOKEN_WORD){
+    MYSQL_FTPARSER_BOOLEAN_INFO instinfo ={ FT_TOKEN_WORD, info->yesno, info->weight_adjust, info->wasign, info->trunc, ' ', 0 };
+    instinfo.type = info->type == FTCORE_TOKEN_LEFT_PAREN ? FT_TOKEN_LEFT_PAREN : FT_TOKEN_RIGHT_PAREN;
+    if(info->quot){
+      instinfo.quot = (char*)word; // mysqld only tests it, as its own parser points it at the quote.
     }
-    if(!to){
-      if(!tmp){ tmp=my_malloc(uc->mbmaxlen, MYF(MY_WME)); }
-      cnvres = uc->cset->wc_mb(uc, wc, (uchar*)tmp, (uchar*)(tmp+uc->mbmaxlen));
-    }else{
-      cnvres = uc->cset->wc_mb(uc, wc, (uchar*)wpos, (uchar*)wend);
+    return param->mysql_add_word(param, (char*)word, 0, &instinfo);
+  }
+  // the words must live as long as the parser state.
+  char *thead = ftppc_alloc(state, length);
+  if(!thead){
+    return FTPPC_MEMORY_ERROR;
+  }
+  memcpy(thead, word, length);
+  state->tokens++;
+  if(state->recording){
+    ftppc_record(state, thead, length);
+  }
+  if(info && (info->yesno || info->weight_adjust || info->wasign)){
+    // mysql_parse drops the operators of a word, a group of one keeps them.
+    MYSQL_FTPARSER_BOOLEAN_INFO group ={ FT_TOKEN_LEFT_PAREN, info->yesno, info->weight_adjust, info->wasign, 0, ' ', 0 };
+    int ret = param->mysql_add_word(param, thead, 0, &group);
+    if(!ret){
+      ret = param->mysql_parse(param, thead, (int)length);
     }
-    if(cnvres > 0){
-      wpos += (size_t)cnvres;
-    }else{
-      break;
+    if(!ret){
+      group.type = FT_TOKEN_RIGHT_PAREN;
+      ret = param->mysql_add_word(param, thead, 0, &group);
     }
-    if(numchars){ *numchars++; }
+    return ret;
   }
-  if(tmp){ my_free(tmp); }
-  return (size_t)(wpos-to);
+  return param->mysql_parse(param, thead, (int)length);
 }
 
-static int snowball_add_word(MYSQL_FTPARSER_PARAM *param, FTSTRING *pbuffer, MYSQL_FTPARSER_BOOLEAN_INFO* instinfo){
-  size_t tlen = ftstring_length(pbuffer);
-  if(tlen==0){
-    return 0;
-  }
-  char* thead = ftstring_head(pbuffer);
-  
-  struct ftppc_state *state = (struct ftppc_state*)param->ftparser_state;
+/** slow document log */
+/**
+ * Logs a document that took at least snowball_slow_log_threshold. The line
+ * is formatted here and written out by the log thread, so a parse never
+ * waits for the file; when the ring is full the line is dropped.
+ * @param phases NULL when the tokens came from the parse cache
+ */
+static void snowball_slow_log_check(MYSQL_FTPARSER_PARAM *param, struct ftppc_state *state,
+                                    unsigned long long started, const FTCORE_PHASES *phases){
+  unsigned long long elapsed = ftcore_now_us() - started;
+  static const FTCORE_PHASES none = { 0, 0, 0 };
+  char line[512];
+  char stamp[32];
+  struct tm tm;
+  time_t now;
+  FTHASH128 hash;
+  const char *mode;
+  int len;
   
-  struct sb_stemmer *st = (struct sb_stemmer*)(state->engine);
-  const sb_symbol * sym = sb_stemmer_stem(st, (const sb_symbol*)thead, tlen);
-  int sym_len = sb_stemmer_length(st);
-  
-  if(!sym){
-    // stemming failed.
-    return 0;
+  if(elapsed < snowball_slow_log_threshold){
+    return;
+  }
+  switch(param->mode){
+    case MYSQL_FTPARSER_FULL_BOOLEAN_INFO: mode = "boolean"; break;
+    case MYSQL_FTPARSER_WITH_STOPWORDS:    mode = "with_stopwords"; break;
+    default:                               mode = "natural"; break;
+  }
+  now = time(NULL);
+  localtime_r(&now, &tm);
+  strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%S", &tm);
+  fthash128(param->doc, (size_t)param->length, 0, &hash);
+  if(!phases){
+    phases = &none;
   }
+  len = snprintf(line, sizeof(line),
+    "%s length=%lu charset=%s mode=%s tokens=%lu total_us=%llu normalize_us=%llu convert_us=%llu tokenize_us=%llu cached=%d over_budget=%d hash=%016llx%016llx\n",
+    stamp, (ulong)param->length, param->cs->csname, mode, state->tokens, elapsed,
+    phases->normalize_us, phases->convert_us, phases->tokenize_us,
+    phases == &none, phases != &none && ftcore_parser_over_budget(state->parser),
+    hash.h1, hash.h2);
+  if(len < 0 || (size_t)len >= sizeof(line)){
+    len = sizeof(line) - 1;
+    line[len - 1] = '\n';
+  }
+  __atomic_fetch_add(&snowball_slow_documents, 1, __ATOMIC_RELAXED);
+  if(ftlog_write(snowball_slow_log_writer, line, (size_t)len, NULL, 0)){
+    __atomic_fetch_add(&snowball_slow_log_dropped, 1, __ATOMIC_RELAXED);
+  }
+}
+/** /slow document log */
+
+/** workload capture */
+/**
+ * Writes one in snowball_capture_sample documents with the settings it is
+ * parsed with, until snowball_capture_max_size bytes have been captured.
+ * Like the slow log, a document that does not fit into the ring is dropped.
+ */
+static void snowball_capture_document(MYSQL_FTPARSER_PARAM *param, const FTCORE_CONFIG *config){
+  FTCAPTURE_RECORD rec;
+  ulonglong size = sizeof(FTCAPTURE_RECORD) + (ulonglong)param->length;
+  ulong sample = snowball_capture_sample ? snowball_capture_sample : 1;
+  ulong limit = snowball_capture_max_size;
   
-  if(strcmp(state->engine_charset->csname, param->cs->csname) != 0){
-    tlen = str_convert(state->engine_charset, (char*)sym, (size_t)sym_len, param->cs, NULL, 0, NULL);
-    thead = ftppc_alloc(state, tlen);
-    if(!thead){
-      return FTPPC_MEMORY_ERROR;
+  if(__atomic_fetch_add(&snowball_capture_seen, 1, __ATOMIC_RELAXED) % sample != 0){
+    return;
+  }
+  // the size is reserved before the write, and given back if nothing was written.
+  if(limit && __atomic_add_fetch(&snowball_capture_bytes, size, __ATOMIC_RELAXED) > limit){
+    __atomic_fetch_sub(&snowball_capture_bytes, size, __ATOMIC_RELAXED);
+    return;
+  }
+  ftcapture_record_init(&rec, config, (int)param->mode, param->cs->number, param->cs->csname, (size_t)param->length);
+  if(ftlog_write(snowball_capture_writer, &rec, sizeof(rec), param->doc, (size_t)param->length)){
+    if(limit){
+      __atomic_fetch_sub(&snowball_capture_bytes, size, __ATOMIC_RELAXED);
     }
-    str_convert(state->engine_charset, (char*)sym, (size_t)sym_len, param->cs, thead, tlen, NULL);
+    __atomic_fetch_add(&snowball_capture_dropped, 1, __ATOMIC_RELAXED);
   }else{
-    tlen = (size_t)sym_len;
-    thead = ftppc_alloc(state, tlen);
-    if(!thead){
-      return FTPPC_MEMORY_ERROR;
-    }
-    memcpy(thead, (char*)sym, tlen);
+    __atomic_fetch_add(&snowball_captured_documents, 1, __ATOMIC_RELAXED);
   }
-  return param->mysql_parse(param, thead, tlen);
 }
+/** /workload capture */
 
 static int snowball_parser_parse(MYSQL_FTPARSER_PARAM *param)
 {
-  char* feed = param->doc;
-  size_t feed_length = (size_t)param->length;
-  int feed_req_free = 0;
-  CHARSET_INFO *cs = param->cs; // the charset of feed
+  struct ftppc_state *state = (struct ftppc_state*)param->ftparser_state;
+  // this parse sees one version of the settings.
+  const struct snowball_descriptor *d = __atomic_load_n(&snowball_current, __ATOMIC_ACQUIRE);
+  unsigned long long started = snowball_slow_log_writer ? ftcore_now_us() : 0;
   
-#if HAVE_ICU
-  // normalize.
-  if(snowball_unicode_normalize && strcmp(snowball_unicode_normalize, "OFF")!=0){
-    if(strcmp(cs->csname, "utf8")!=0){
-      // convert into UTF-8
-      CHARSET_INFO *uc = get_charset(33, MYF(0)); // my_charset_utf8_general_ci for utf8 conversion
-      // calculate mblen and malloc.
-//      size_t cv_length = uc->mbmaxlen * cs->cset->numchars(cs, feed, feed+feed_length);
-      size_t cv_length = str_convert(cs, feed, feed_length, uc, NULL, 0, NULL);
-      char* cv = my_malloc(cv_length, MYF(MY_WME));
-      feed_length = str_convert(cs, feed, feed_length, uc, cv, cv_length, NULL);
-      feed = cv;
-      feed_req_free = 1;
-      cs = uc;
-    }
-    char* nm;
-    char* t;
-    size_t nm_length=0;
-    size_t nm_used=0;
-    nm_length = feed_length+32;
-    nm = my_malloc(nm_length, MYF(MY_WME));
-    int status = 0;
-    int mode = UNORM_NONE;
-    int options = 0;
-    if(strcmp(snowball_unicode_normalize, "C")==0) mode = UNORM_NFC;
-    if(strcmp(snowball_unicode_normalize, "D")==0) mode = UNORM_NFD;
-    if(strcmp(snowball_unicode_normalize, "KC")==0) mode = UNORM_NFKC;
-    if(strcmp(snowball_unicode_normalize, "KD")==0) mode = UNORM_NFKD;
-    if(strcmp(snowball_unicode_normalize, "FCD")==0) mode = UNORM_FCD;
-    if(snowball_unicode_version && strcmp(snowball_unicode_version, "3.2")==0) options |= UNORM_UNICODE_3_2;
-    if(feed_length > 0){
-      nm_used = uni_normalize(feed, feed_length, nm, nm_length, mode, options);
-      if(nm_used == 0){
-        fputs("unicode normalization failed.\n",stderr);
-        fflush(stderr);
-        
-        if(feed_req_free){ my_free(feed); }
-        return FTPPC_NORMALIZATION_ERROR;
-      }else if(nm_used > nm_length){
-        nm_length = nm_used + 8;
-        char *tmp = my_realloc(nm, nm_length, MYF(MY_WME));
-        if(tmp){
-          nm = tmp;
-        }else{
-          if(feed_req_free){ my_free(feed); }
-          my_free(nm);
-          return FTPPC_MEMORY_ERROR;
-        }
-        nm_used = uni_normalize(feed, feed_length, nm, nm_length, mode, options);
-        if(nm_used == 0){
-          fputs("unicode normalization failed.\n",stderr);
-          fflush(stderr);
-          
-          if(feed_req_free){ my_free(feed); }
-          my_free(nm);
-          return FTPPC_NORMALIZATION_ERROR;
-        }
-      }
-      if(feed_req_free){ my_free(feed); }
-      feed = nm;
-      feed_length = nm_used;
-      feed_req_free = 1;
-    }
+  FTPROBE3(parse_begin, param->length, param->cs->number, param->mode);
+  state->tokens = 0;
+  if(state->codec.data != param->cs){
+    ftppc_codec_init(&state->codec, param->cs);
   }
-#endif
   
-  struct ftppc_state *state = (struct ftppc_state*)param->ftparser_state;
-  // init engine >>
-  if(!state->engine){
-    char *algorithm = "english";
-    if(snowball_algorithm && strlen(snowball_algorithm) > 0){
-      algorithm = snowball_algorithm;
-    }
-    
-    struct sb_stemmer *st = NULL;
-    CHARSET_INFO *cs;
-    if(strcmp(param->cs->csname, "utf8")==0){
-      cs = get_charset(83, MYF(0)); // cs (utf8_bin) can't be null.
-      st = sb_stemmer_new(algorithm, "UTF_8");
-      if(st){
-        state->engine = st;
-        state->engine_charset = cs;
-      }
-    }else if(strcmp(param->cs->csname, "latin1")==0){
-      cs = get_charset(47, MYF(0)); // cs (latin1_bin) can't be null.
-      st = sb_stemmer_new(algorithm, "ISO_8858_1");
-      if(st){
-        state->engine = st;
-        state->engine_charset = cs;
-      }
-    }else if(strcmp(param->cs->csname, "cp850")==0){
-      cs = get_charset(80, MYF(0)); // cs (cp850_bin) can't be null.
-      st = sb_stemmer_new(algorithm, "CP850");
-      if(st){
-        state->engine = st;
-        state->engine_charset = cs;
-      }
-    }else if(strcmp(param->cs->csname, "koi8r")==0){
-      cs = get_charset(74, MYF(0)); // cs (koi8r_bin) can't be null.
-      st = sb_stemmer_new(algorithm, "KOI8_R");
-      if(st){
-        state->engine = st;
-        state->engine_charset = cs;
-      }
-    }
-    if(!st){ // if engine was not available, we'll transcode.
-      cs = get_charset(83, MYF(0)); // cs (utf8_bin) can't be null.
-      st = sb_stemmer_new(algorithm, "UTF_8"); // st can't be NULL because update function will check it.
-      state->engine = st;
-      state->engine_charset = cs;
-    }
+  FTCORE_CONFIG config = d->config;
+  config.parallel_threshold = (size_t)snowball_parallel_threshold;
+  config.time_budget_us = snowball_time_budget;
+  config.budget_skip = snowball_budget_skip;
+  if(param->mode == MYSQL_FTPARSER_WITH_STOPWORDS){
+    config.emit = 0; // phrases are checked against the stems, in order.
   }
-  // init engine <<
-  if(strcmp(cs->csname, state->engine_charset->csname)!=0){
-    size_t tmp_len = str_convert(cs, feed, feed_length, state->engine_charset, NULL, 0, NULL);
-    char* tmp = my_malloc(tmp_len, MYF(MY_WME));
-    if(!tmp){
-      return FTPPC_MEMORY_ERROR;
-    }
-    str_convert(cs, feed, feed_length, state->engine_charset, tmp, tmp_len, NULL);
-    if(feed_req_free){ my_free(feed); }
-    feed = tmp;
-    feed_length = tmp_len;
-    feed_req_free = 1;
-    cs = state->engine_charset;
+  config.timing = started != 0;
+  if(snowball_capture_writer){
+    snowball_capture_document(param, &config);
   }
   
-  FTSTRING buffer = { NULL, 0, NULL, 0, 0 };
-  FTSTRING *pbuffer = &buffer;
-  ftstring_bind(pbuffer, feed, feed_req_free);
-  
-  if(param->mode == MYSQL_FTPARSER_FULL_BOOLEAN_INFO){
-    MYSQL_FTPARSER_BOOLEAN_INFO instinfo ={ FT_TOKEN_WORD, 0, 0, 0, 0, ' ', 0 };
-    MYSQL_FTPARSER_BOOLEAN_INFO *info_may = (MYSQL_FTPARSER_BOOLEAN_INFO*)my_malloc(sizeof(MYSQL_FTPARSER_BOOLEAN_INFO), MYF(MY_WME));
-    if(!info_may){
-      return FTPPC_MEMORY_ERROR;
-    }
-    *info_may = instinfo;
-    LIST *infos = NULL;
-    list_push(infos, info_may);
-    
-    int context=CTX_CONTROL;
-    SEQFLOW sf,sf_prev = SF_BROKEN;
-    char* pos = feed;
-    char* docend = feed+feed_length;
-    while(pos < docend){
-      int readsize;
-      my_wc_t dst;
-      sf = ctxscan(cs, pos, docend, &dst, &readsize, context);
-      if(sf==SF_ESCAPE){
-        context |= CTX_ESCAPE;
-        context |= CTX_CONTROL;
-      }else{
-        context &= ~CTX_ESCAPE;
-        if(sf == SF_CHAR){
-          context &= ~CTX_CONTROL;
-        }else{
-          context |= CTX_CONTROL;
-        }
-      }
-      if(context & CTX_QUOTE){
-        if(my_isspace(param->cs, *pos) && sf_prev!=SF_ESCAPE){ // perform phrase query.
-          sf = SF_WHITE;
-        }
-      }
-      if(sf == SF_PLUS){   instinfo.yesno = 1; }
-      if(sf == SF_MINUS){  instinfo.yesno = -1; }
-      if(sf == SF_STRONG){ instinfo.weight_adjust++; }
-      if(sf == SF_WEAK){   instinfo.weight_adjust--; }
-      if(sf == SF_WASIGN){ instinfo.wasign = !instinfo.wasign; }
-      if(sf == SF_LEFT_PAREN){
-        MYSQL_FTPARSER_BOOLEAN_INFO *tmp = (MYSQL_FTPARSER_BOOLEAN_INFO*)my_malloc(sizeof(MYSQL_FTPARSER_BOOLEAN_INFO), MYF(MY_WME));
-        if(!tmp){
-          list_free(infos, 1);
-          ftstring_destroy(pbuffer);
-          return FTPPC_MEMORY_ERROR;
-        }
-        *tmp = instinfo;
-        list_push(infos, tmp);
-        
-        instinfo.type = FT_TOKEN_LEFT_PAREN;
-        param->mysql_add_word(param, pos, 0, &instinfo); // push LEFT_PAREN token
-        instinfo = *tmp;
+  // parse cache. boolean queries are parsed once per query and not cached.
+  FTHASH128 cache_key;
+  state->recording = 0;
+  if(ftcache_capacity() > 0 && param->mode != MYSQL_FTPARSER_FULL_BOOLEAN_INFO){
+    ulonglong seed = ((ulonglong)d->generation << 32)
+                   ^ ((ulonglong)param->cs->number << 8)
+                   ^ (ulonglong)param->mode;
+    fthash128(param->doc, (size_t)param->length, seed, &cache_key);
+    FTCACHE_ENTRY *hit = ftcache_lookup(&cache_key);
+    if(hit){
+      FTPROBE1(cache_hit, param->length);
+      size_t length;
+      const char *tokens = ftcache_tokens(hit, &length);
+      // the entry may be evicted once released, so the sink copies the words.
+      int ret = ftcore_tokens_emit(tokens, length, snowball_sink, param);
+      ftcache_release(hit);
+      if(started){
+        snowball_slow_log_check(param, state, started, NULL);
       }
-      if(sf == SF_QUOTE_START){
-        context |= CTX_QUOTE;
-      }
-      if(sf == SF_RIGHT_PAREN){
-        instinfo = *((MYSQL_FTPARSER_BOOLEAN_INFO*)infos->data);
-        instinfo.type = FT_TOKEN_RIGHT_PAREN;
-        param->mysql_add_word(param, pos, 0, &instinfo); // push RIGHT_PAREN token
-        
-        MYSQL_FTPARSER_BOOLEAN_INFO *tmp = (MYSQL_FTPARSER_BOOLEAN_INFO*)infos->data;
-        if(tmp){ my_free(tmp); }
-        list_pop(infos);
-        if(!infos){
-          return FTPPC_SYNTAX_ERROR;
-        } // must not reach the base info_may level.
-        instinfo = *((MYSQL_FTPARSER_BOOLEAN_INFO*)infos->data);
-      }
-      if(sf == SF_QUOTE_END){
-        context &= ~CTX_QUOTE;
-      }
-      if(sf == SF_CHAR){
-        if(ftstring_length(pbuffer)==0){
-          ftstring_bind(pbuffer, pos, feed_req_free);
-        }
-        ftstring_append(pbuffer, pos, readsize);
-      }else if(sf != SF_ESCAPE){
-        if(sf == SF_TRUNC){
-          instinfo.trunc = 1;
-        }
-        snowball_add_word(param, pbuffer, &instinfo);
-        ftstring_reset(pbuffer);
-        instinfo = *((MYSQL_FTPARSER_BOOLEAN_INFO *)infos->data);
-      }
-      
-      if(readsize > 0){
-        pos += readsize;
-      }else if(readsize == MY_CS_ILSEQ){
-        pos++;
-      }else{
-        break;
-      }
-      sf_prev = sf;
-    }
-    if(sf==SF_CHAR){
-      if(ftstring_length(pbuffer)>0){ // we must not exceed HA_FT_MAXBYTELEN-HA_FT_WLEN
-        snowball_add_word(param, pbuffer, &instinfo);
-      }
-    }
-    list_free(infos,1);
-  }else{
-    char *s = feed;
-    char *e = feed + feed_length;
-    while(s < e){
-      int readsize;
-      if(iswchar(cs, s, e, &readsize)){
-        if(ftstring_length(pbuffer) == 0){
-          ftstring_bind(pbuffer, s, feed_req_free);
-        }
-        ftstring_append(pbuffer, s, readsize);
-      }else{
-        if(ftstring_length(pbuffer) > 0){
-          snowball_add_word(param, pbuffer, NULL);
-          ftstring_reset(pbuffer);
-        }
-      }
-      s += readsize;
+      FTPROBE2(parse_end, state->tokens, ret);
+      return ret;
     }
+    FTPROBE1(cache_miss, param->length);
+    state->recording = 1;
+    state->record.length = 0;
   }
-  if(ftstring_length(pbuffer) > 0){
-    snowball_add_word(param, pbuffer, NULL);
+  
+  int ret = ftcore_parse(state->parser, &config, &state->codec, param->doc, (size_t)param->length,
+                         param->mode == MYSQL_FTPARSER_FULL_BOOLEAN_INFO ? FTCORE_MODE_BOOLEAN : FTCORE_MODE_NATURAL,
+                         snowball_sink, param);
+  if(ftcore_parser_over_budget(state->parser)){
+    __atomic_fetch_add(&snowball_budget_exceeded, 1, __ATOMIC_RELAXED);
+    state->recording = 0; // a degraded result is not cached.
   }
-  ftstring_destroy(pbuffer);
-  if(feed_req_free){ my_free(feed); }
-  return 0;
+  if(ret == 0 && state->recording){
+    ftcache_insert(&cache_key, state->record.data, state->record.length);
+  }
+  state->recording = 0;
+  if(started){
+    snowball_slow_log_check(param, state, started, ftcore_parser_phases(state->parser));
+  }
+  FTPROBE2(parse_end, state->tokens, ret);
+  return ret;
+}
+
+/** the update of PLUGIN_VAR_MEMALLOC strings: mysqld frees what the variable holds. */
+static void snowball_config_update(MYSQL_THD thd, struct st_mysql_sys_var *var, void *var_ptr, const void *save){
+  char *old = *(char**)var_ptr;
+  const char *str = *(const char**)save;
+  *(char**)var_ptr = str ? my_strdup(str, MYF(MY_WME)) : NULL;
+  if(old){ my_free(old); }
+  snowball_descriptor_publish(); // on failure the previous settings stay.
+}
+
+static void snowball_config_bool_update(MYSQL_THD thd, struct st_mysql_sys_var *var, void *var_ptr, const void *save){
+  *(my_bool*)var_ptr = *(my_bool*)save;
+  snowball_descriptor_publish();
+}
+
+static void snowball_config_ulong_update(MYSQL_THD thd, struct st_mysql_sys_var *var, void *var_ptr, const void *save){
+  *(ulong*)var_ptr = *(ulong*)save;
+  snowball_descriptor_publish();
+}
+
+static void snowball_cache_size_update(MYSQL_THD thd, struct st_mysql_sys_var *var, void *var_ptr, const void *save){
+  *(ulong*)var_ptr = *(ulong*)save;
+  ftcache_set_capacity((size_t)snowball_cache_size);
+}
+
+/**
+ * @return the value of a string variable, copied to the statement, as the
+ * update runs after the check has returned
+ */
+static const char* snowball_value_str(MYSQL_THD thd, struct st_mysql_value *value, int *len){
+    char buf[64];
+    const char *str;
+    
+    *len = sizeof(buf);
+    str = value->val_str(value,buf,len);
+    if(!str) return NULL;
+    return thd_strmake(thd, str, (unsigned int)*len);
 }
 
 int snowball_algorithm_check(MYSQL_THD thd, struct st_mysql_sys_var *var, void *save, struct st_mysql_value *value){
-    char buf[4];
-    int len=4;
+    int len;
     const char *str;
     
-    str = value->val_str(value,buf,&len);
+    str = snowball_value_str(thd, value, &len);
     if(!str) return -1;
     *(const char**)save=str;
     
     // we want to use alias names, we don't use sb_stemmer_list().
-    struct sb_stemmer *st = sb_stemmer_new(str, NULL);
-    if(st){
-      sb_stemmer_delete(st);
+    if(sb_stemmer_module_get(str, NULL)){
       return 0;
     }
     return -1;
 }
 
+int snowball_drop_tokens_check(MYSQL_THD thd, struct st_mysql_sys_var *var, void *save, struct st_mysql_value *value){
+    int len;
+    int flags;
+    const char *str;
+    
+    str = snowball_value_str(thd, value, &len);
+    if(!str) return -1;
+    *(const char**)save=str;
+    return snowball_flag_list(str, snowball_classes, &flags);
+}
+
+int snowball_emit_check(MYSQL_THD thd, struct st_mysql_sys_var *var, void *save, struct st_mysql_value *value){
+    int len;
+    int flags;
+    const char *str;
+    
+    str = snowball_value_str(thd, value, &len);
+    if(!str) return -1;
+    *(const char**)save=str;
+    return snowball_flag_list(str, snowball_emits, &flags);
+}
+
+int snowball_tokenizer_check(MYSQL_THD thd, struct st_mysql_sys_var *var, void *save, struct st_mysql_value *value){
+    int len;
+    const char *str;
+    
+    str = snowball_value_str(thd, value, &len);
+    if(!str) return -1;
+    *(const char**)save=str;
+    if(len==7 && memcmp(str, "DEFAULT", len)==0) return 0;
+    if(len==10 && memcmp(str, "CJK_BIGRAM", len)==0) return 0;
+#if HAVE_ICU
+    if(len==3 && memcmp(str, "ICU", len)==0) return 0;
+#endif
+    return -1;
+}
+
 int snowball_unicode_version_check(MYSQL_THD thd, struct st_mysql_sys_var *var, void *save, struct st_mysql_value *value){
-    char buf[4];
-    int len=4;
+    int len;
     const char *str;
     
-    str = value->val_str(value,buf,&len);
+    str = snowball_value_str(thd, value, &len);
     if(!str) return -1;
     *(const char**)save=str;
     if(len==3){
@@ -545,11 +804,10 @@ int snowball_unicode_version_check(MYSQL_THD thd, struct st_mysql_sys_var *var,
 }
 
 int snowball_unicode_normalize_check(MYSQL_THD thd, struct st_mysql_sys_var *var, void *save, struct st_mysql_value *value){
-    char buf[4];
-    int len=4;
+    int len;
     const char *str;
     
-    str = value->val_str(value,buf,&len);
+    str = snowball_value_str(thd, value, &len);
     if(!str) return -1;
     *(const char**)save=str;
     if(!get_charset(33, MYF(0))) return -1; // If you don't have utf8 codec in mysql, it fails
@@ -562,37 +820,159 @@ int snowball_unicode_normalize_check(MYSQL_THD thd, struct st_mysql_sys_var *var
         if(str[0]=='K' && str[1]=='D'){ return 0;}
     }
     if(len==3){
+#if HAVE_ICU
         if(str[0]=='F' && str[1]=='C' && str[2]=='D'){ return 0;}
+#endif
         if(str[0]=='O' && str[1]=='F' && str[2]=='F'){ return 0;}
     }
+    if(len==4){
+        if(memcmp(str, "C_CF", len)==0){ return 0;}
+    }
+    if(len==5){
+        if(memcmp(str, "KC_CF", len)==0){ return 0;}
+    }
     return -1;
 }
 
 static MYSQL_SYSVAR_STR(algorithm, snowball_algorithm,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_MEMALLOC,
-  "Set stemming algorithm by ISO 639 codes.",
-  snowball_algorithm_check, NULL, "english");
+  "Set stemming algorithm by ISO 639 codes. english_light, french_light, german_light and spanish_light strip plurals and little more, for a fraction of the cost",
+  snowball_algorithm_check, snowball_config_update, "english");
+
+static MYSQL_SYSVAR_STR(drop_tokens, snowball_drop_tokens,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_MEMALLOC,
+  "Tokens to drop rather than index unstemmed (NUMERIC, HEX, OVERLONG, comma separated)",
+  snowball_drop_tokens_check, snowball_config_update, "");
+
+static MYSQL_SYSVAR_STR(emit, snowball_emit,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_MEMALLOC,
+  "Tokens to index besides the stems (SURFACE, EDGE, TRIGRAM, comma separated). SURFACE adds the word as written, marked with _, where it differs from its stem; =word in boolean mode matches it. EDGE adds its prefixes marked with __, matched by ^prefix; TRIGRAM every three characters marked with ___, matched by %part",
+  snowball_emit_check, snowball_config_update, "");
+
+static MYSQL_SYSVAR_ULONG(edge_min, snowball_edge_min,
+  PLUGIN_VAR_RQCMDARG,
+  "Characters of the shortest prefix snowball_emit=EDGE indexes; ^prefix finds nothing shorter",
+  NULL, snowball_config_ulong_update, FTCORE_EDGE_MIN, 1, 64, 0);
+
+static MYSQL_SYSVAR_ULONG(edge_max, snowball_edge_max,
+  PLUGIN_VAR_RQCMDARG,
+  "Characters of the longest prefix snowball_emit=EDGE indexes; ^prefix looks longer ones up by their first ones",
+  NULL, snowball_config_ulong_update, FTCORE_EDGE_MAX, 1, 64, 0);
 
 static MYSQL_SYSVAR_STR(normalization, snowball_unicode_normalize,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_MEMALLOC,
-  "Set unicode normalization (OFF, C, D, KC, KD, FCD)",
-  snowball_unicode_normalize_check, NULL, "OFF");
+  "Set unicode normalization (OFF, C, D, KC, KD, FCD, C_CF, KC_CF). FCD needs ICU",
+  snowball_unicode_normalize_check, snowball_config_update, "OFF");
 
 static MYSQL_SYSVAR_STR(unicode_version, snowball_unicode_version,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_MEMALLOC,
   "Set unicode version (3.2, DEFAULT)",
-  snowball_unicode_version_check, NULL, "DEFAULT");
+  snowball_unicode_version_check, snowball_config_update, "DEFAULT");
+
+static MYSQL_SYSVAR_STR(tokenizer, snowball_tokenizer,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_MEMALLOC,
+  "Set tokenizer (DEFAULT, CJK_BIGRAM, ICU). CJK_BIGRAM indexes runs of Han, kana and Hangul as overlapping bigrams, which MyISAM keeps only with ft_min_word_len=2 or less; ICU splits words by ICU word break rules and needs ICU",
+  snowball_tokenizer_check, snowball_config_update, "DEFAULT");
+
+static MYSQL_SYSVAR_BOOL(unaccent, snowball_unaccent,
+  PLUGIN_VAR_OPCMDARG,
+  "Strip accents from the stems, so that words with and without them match",
+  NULL, snowball_config_bool_update, 0);
+
+static MYSQL_SYSVAR_ULONG(cache_size, snowball_cache_size,
+  PLUGIN_VAR_RQCMDARG,
+  "Bytes of memory for caching parse results of documents, each up to 1/128 of it (0 disables the cache)",
+  NULL, snowball_cache_size_update, 0, 0, ~0UL, 0);
+
+static MYSQL_SYSVAR_ULONG(parallel_threads, snowball_parallel_threads,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Worker threads for stemming large documents in parallel (0 disables)",
+  NULL, NULL, 0, 0, 64, 0);
+
+static MYSQL_SYSVAR_ULONG(parallel_threshold, snowball_parallel_threshold,
+  PLUGIN_VAR_RQCMDARG,
+  "Documents of at least this many bytes are stemmed in parallel",
+  NULL, NULL, 1048576, 4096, ~0UL, 0);
+
+static MYSQL_SYSVAR_ULONG(time_budget, snowball_time_budget,
+  PLUGIN_VAR_RQCMDARG,
+  "Microseconds a document may be stemmed for; the rest is indexed unstemmed (0 for no limit)",
+  NULL, NULL, 0, 0, ~0UL, 0);
+
+static MYSQL_SYSVAR_BOOL(budget_skip, snowball_budget_skip,
+  PLUGIN_VAR_OPCMDARG,
+  "Drop the rest of a document over snowball_time_budget instead of indexing it unstemmed",
+  NULL, NULL, 0);
+
+static MYSQL_SYSVAR_STR(dictionary, snowball_dictionary,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Stem dictionary written by ftsnowball_bulk -D, mapped at startup",
+  NULL, NULL, NULL);
+
+static MYSQL_SYSVAR_STR(slow_log, snowball_slow_log,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "File the documents slower than snowball_slow_log_threshold are logged to (empty disables)",
+  NULL, NULL, NULL);
+
+static MYSQL_SYSVAR_ULONG(slow_log_threshold, snowball_slow_log_threshold,
+  PLUGIN_VAR_RQCMDARG,
+  "Microseconds a document must take to be written to snowball_slow_log (0 logs every document)",
+  NULL, NULL, 100000, 0, ~0UL, 0);
+
+static MYSQL_SYSVAR_STR(capture, snowball_capture,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "File sampled documents are captured to for replaying with ftsnowball_bulk -r (empty disables)",
+  NULL, NULL, NULL);
+
+static MYSQL_SYSVAR_ULONG(capture_sample, snowball_capture_sample,
+  PLUGIN_VAR_RQCMDARG,
+  "Capture one in this many documents",
+  NULL, NULL, 100, 1, ~0UL, 0);
+
+static MYSQL_SYSVAR_ULONG(capture_max_size, snowball_capture_max_size,
+  PLUGIN_VAR_RQCMDARG,
+  "Bytes captured to snowball_capture before capturing stops (0 for no limit)",
+  NULL, NULL, 1073741824, 0, ~0UL, 0);
 
 static struct st_mysql_show_var snowball_status[]=
 {
   {"Snowball_info", (char *)snowball_info, SHOW_CHAR},
+  {"Snowball_cache_hits", (char *)&ftcache_hits, SHOW_LONG},
+  {"Snowball_cache_misses", (char *)&ftcache_misses, SHOW_LONG},
+  {"Snowball_dictionary_entries", (char *)&snowball_dictionary_entries, SHOW_LONG},
+  {"Snowball_budget_exceeded", (char *)&snowball_budget_exceeded, SHOW_LONG},
+  {"Snowball_slow_documents", (char *)&snowball_slow_documents, SHOW_LONG},
+  {"Snowball_slow_log_dropped", (char *)&snowball_slow_log_dropped, SHOW_LONG},
+  {"Snowball_captured_documents", (char *)&snowball_captured_documents, SHOW_LONG},
+  {"Snowball_capture_dropped", (char *)&snowball_capture_dropped, SHOW_LONG},
+  {"Snowball_slab_allocs", (char *)&ftslab_allocs, SHOW_LONG},
+  {"Snowball_slab_pool_visits", (char *)&ftslab_pool_visits, SHOW_LONG},
+  {"Snowball_slab_large", (char *)&ftslab_large, SHOW_LONG},
+  {"Snowball_slab_bytes", (char *)&ftslab_bytes, SHOW_LONG},
   {0,0,0}
 };
 
 static struct st_mysql_sys_var* snowball_system_variables[]= {
   MYSQL_SYSVAR(algorithm),
-#if HAVE_ICU
+  MYSQL_SYSVAR(drop_tokens),
+  MYSQL_SYSVAR(emit),
+  MYSQL_SYSVAR(edge_min),
+  MYSQL_SYSVAR(edge_max),
+  MYSQL_SYSVAR(cache_size),
+  MYSQL_SYSVAR(parallel_threads),
+  MYSQL_SYSVAR(parallel_threshold),
+  MYSQL_SYSVAR(dictionary),
+  MYSQL_SYSVAR(time_budget),
+  MYSQL_SYSVAR(budget_skip),
+  MYSQL_SYSVAR(slow_log),
+  MYSQL_SYSVAR(slow_log_threshold),
+  MYSQL_SYSVAR(capture),
+  MYSQL_SYSVAR(capture_sample),
+  MYSQL_SYSVAR(capture_max_size),
   MYSQL_SYSVAR(normalization),
+  MYSQL_SYSVAR(tokenizer),
+  MYSQL_SYSVAR(unaccent),
+#if HAVE_ICU
   MYSQL_SYSVAR(unicode_version),
 #endif
   NULL
@@ -1,8 +1,29 @@
 #!/bin/sh
+# CJK bigrams are two characters: the CJK_BIGRAM case is only checked when
+# mysqld runs with --ft_min_word_len=2 or less.
 EXPECT="1
 1
 1
-1"
+1
+1
+1
+1
+0
+1
+1
+0
+1
+2
+1
+1
+2
+1
+1
+0
+1
+2
+1
+kittens horses"
 RESULT=`mysql --default-character-set utf8 test -B -N < test.sql`
 if [ "$EXPECT" = "$RESULT" ];
 then
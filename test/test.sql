@@ -21,6 +21,114 @@ SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('continuait continuelle');
 SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('continuait' IN BOOLEAN MODE);
 DROP TABLE IF EXISTS sn;
 
+SET GLOBAL snowball_algorithm="english";
+SET GLOBAL snowball_cache_size=1048576;
+DROP TABLE IF EXISTS sn;
+CREATE TABLE sn (id INT, a TEXT, FULLTEXT(a) WITH PARSER snowball) CHARSET latin1;
+INSERT INTO sn VALUES (1, "consignment consistently");
+INSERT INTO sn VALUES (2, "dummy");
+INSERT INTO sn VALUES (3, "dummy");
+SELECT VARIABLE_VALUE+0 INTO @hits FROM information_schema.GLOBAL_STATUS WHERE VARIABLE_NAME='SNOWBALL_CACHE_HITS';
+UPDATE sn SET id=4 WHERE id=1;
+SELECT VARIABLE_VALUE+0 > @hits FROM information_schema.GLOBAL_STATUS WHERE VARIABLE_NAME='SNOWBALL_CACHE_HITS';
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('consigned consisted');
+DROP TABLE IF EXISTS sn;
+SET GLOBAL snowball_cache_size=0;
+
+SET GLOBAL snowball_drop_tokens="NUMERIC,HEX";
+DROP TABLE IF EXISTS sn;
+CREATE TABLE sn (a TEXT, FULLTEXT(a) WITH PARSER snowball) CHARSET utf8;
+INSERT INTO sn VALUES ("orders 12345 checksum 9f86d081884c7d65");
+INSERT INTO sn VALUES ("dummy");
+INSERT INTO sn VALUES ("dummy");
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('ordered' IN BOOLEAN MODE);
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('12345 9f86d081884c7d65' IN BOOLEAN MODE);
+DROP TABLE IF EXISTS sn;
+SET GLOBAL snowball_drop_tokens="";
+
+SET GLOBAL snowball_algorithm="fr";
+SET GLOBAL snowball_unaccent=ON;
+DROP TABLE IF EXISTS sn;
+CREATE TABLE sn (a TEXT, FULLTEXT(a) WITH PARSER snowball) CHARSET utf8;
+INSERT INTO sn VALUES ("élèves continué");
+INSERT INTO sn VALUES ("dummy");
+INSERT INTO sn VALUES ("dummy");
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('eleve' IN BOOLEAN MODE);
+DROP TABLE IF EXISTS sn;
+SET GLOBAL snowball_unaccent=OFF;
+
+SET GLOBAL snowball_algorithm="english";
+SET GLOBAL snowball_tokenizer="CJK_BIGRAM";
+DROP TABLE IF EXISTS sn;
+CREATE TABLE sn (a TEXT, FULLTEXT(a) WITH PARSER snowball) CHARSET utf8;
+INSERT INTO sn VALUES ("東京都に住んでいます running");
+INSERT INTO sn VALUES ("dummy");
+INSERT INTO sn VALUES ("dummy");
+-- MyISAM drops the bigrams below ft_min_word_len; the expected results stand in then.
+SELECT IF(@@ft_min_word_len > 2, 1, COUNT(*)) FROM sn WHERE MATCH(a) AGAINST('+東京都 +runs' IN BOOLEAN MODE);
+SELECT IF(@@ft_min_word_len > 2, 0, COUNT(*)) FROM sn WHERE MATCH(a) AGAINST('都東京' IN BOOLEAN MODE);
+DROP TABLE IF EXISTS sn;
+SET GLOBAL snowball_tokenizer="DEFAULT";
+
+SET GLOBAL snowball_emit="SURFACE";
+DROP TABLE IF EXISTS sn;
+CREATE TABLE sn (a TEXT, FULLTEXT(a) WITH PARSER snowball) CHARSET latin1;
+INSERT INTO sn VALUES ("jumping");
+INSERT INTO sn VALUES ("jumps");
+INSERT INTO sn VALUES ("dummy");
+INSERT INTO sn VALUES ("dummy");
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('=jumping' IN BOOLEAN MODE);
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('jumping' IN BOOLEAN MODE);
+DROP TABLE IF EXISTS sn;
+SET GLOBAL snowball_emit="";
+
+SET GLOBAL snowball_emit="EDGE,TRIGRAM";
+DROP TABLE IF EXISTS sn;
+CREATE TABLE sn (a TEXT, FULLTEXT(a) WITH PARSER snowball) CHARSET latin1;
+INSERT INTO sn VALUES ("keyboard");
+INSERT INTO sn VALUES ("keystone");
+INSERT INTO sn VALUES ("dummy");
+INSERT INTO sn VALUES ("dummy");
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('^keyb' IN BOOLEAN MODE);
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('%ston' IN BOOLEAN MODE);
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('^key' IN BOOLEAN MODE);
+DROP TABLE IF EXISTS sn;
+SET GLOBAL snowball_emit="";
+
+SET GLOBAL snowball_tokenizer="ICU";
+DROP TABLE IF EXISTS sn;
+CREATE TABLE sn (a TEXT, FULLTEXT(a) WITH PARSER snowball) CHARSET utf8;
+INSERT INTO sn VALUES ("สวัสดีครับ running");
+INSERT INTO sn VALUES ("dummy");
+INSERT INTO sn VALUES ("dummy");
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('ครับ runs');
+DROP TABLE IF EXISTS sn;
+SET GLOBAL snowball_tokenizer="DEFAULT";
+
+SET GLOBAL snowball_algorithm="english_light";
+DROP TABLE IF EXISTS sn;
+CREATE TABLE sn (a TEXT, FULLTEXT(a) WITH PARSER snowball) CHARSET latin1;
+INSERT INTO sn VALUES ("ponies");
+INSERT INTO sn VALUES ("running");
+INSERT INTO sn VALUES ("dummy");
+INSERT INTO sn VALUES ("dummy");
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('pony' IN BOOLEAN MODE);
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('run' IN BOOLEAN MODE);
+DROP TABLE IF EXISTS sn;
+
+SET GLOBAL snowball_algorithm="english";
+DROP TABLE IF EXISTS sn;
+CREATE TABLE sn (a TEXT, FULLTEXT(a) WITH PARSER snowball) CHARSET latin1;
+INSERT INTO sn VALUES ("kittens horses");
+INSERT INTO sn VALUES ("puppies horses");
+INSERT INTO sn VALUES ("horses");
+INSERT INTO sn VALUES ("dummy");
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('+kittens' IN BOOLEAN MODE);
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('+horses -kittens' IN BOOLEAN MODE);
+SELECT COUNT(*) FROM sn WHERE MATCH(a) AGAINST('-(kittens puppies) horses' IN BOOLEAN MODE);
+SELECT a FROM sn WHERE MATCH(a) AGAINST('>kittens <puppies' IN BOOLEAN MODE) ORDER BY MATCH(a) AGAINST('>kittens <puppies' IN BOOLEAN MODE) DESC LIMIT 1;
+DROP TABLE IF EXISTS sn;
+
 SET GLOBAL snowball_normalization=OFF;
 SET GLOBAL snowball_unicode_version="DEFAULT";
 SET GLOBAL snowball_algorithm="english"
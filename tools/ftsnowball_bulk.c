@@ -0,0 +1,1100 @@
+/**
+ * ftsnowball_bulk: tokenizes table dumps outside mysqld.
+ *
+ * The rows of a TSV (SELECT ... INTO OUTFILE, mysqldump --tab) or CSV dump
+ * are mmap()ed, cut into shards of whole rows and parsed on the workers of
+ * libftsnowball_core, the pipeline behind the plugin. Writes one line of
+ * tokens per row and, optionally, the frequency of every token.
+ *
+ * With -D it writes a stem dictionary for snowball_dictionary instead: the
+ * most frequent words of the dump, each with its stem.
+ *
+ * With -r it replays a snowball_capture file: every document is parsed in
+ * the order and with the settings it was captured with, one line of tokens
+ * per document, so that runs of two builds can be timed and compared.
+ *
+ * With -b it benchmarks concurrent parsers instead: 1, 2, 4 ... threads,
+ * each with its own parser, parse every field of the dump, and the
+ * throughput, the scaling and the allocator and scheduler load of each
+ * step are reported.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ftcore.h"
+#include "fthash.h"
+#include "ftpool.h"
+#include "ftslab.h"
+#include "ftcapture.h"
+
+#define BULK_SHARD_BYTES (4<<20)
+#define BULK_MAX_COLUMNS 1024
+
+enum bulk_format { BULK_TSV, BULK_CSV };
+
+static const char *progname;
+
+/** options */
+static enum bulk_format bulk_format = BULK_TSV;
+static char bulk_columns[BULK_MAX_COLUMNS]; // 1 for columns to tokenize
+static int  bulk_all_columns = 1;
+static unsigned int bulk_key_column = 0; // 0 for the row number
+static int  bulk_skip_header = 0;
+static const FTCORE_CODEC *bulk_codec = NULL;
+static FTCORE_CONFIG bulk_config;
+
+/** growable byte buffer */
+typedef struct _bulk_buf {
+  char*  data;
+  size_t length;
+  size_t capacity;
+} BULK_BUF;
+
+static int bulk_buf_reserve(BULK_BUF *buf, size_t length){
+  size_t required = buf->length + length;
+  if(required > buf->capacity){
+    size_t sz = buf->capacity ? buf->capacity : 4096;
+    while(sz < required){
+      sz = sz<<1;
+    }
+    char *tmp = buf->data ? ftcore_realloc(buf->data, sz) : ftcore_malloc(sz);
+    if(!tmp){
+      return -1;
+    }
+    buf->data = tmp;
+    buf->capacity = sz;
+  }
+  return 0;
+}
+
+static int bulk_buf_append(BULK_BUF *buf, const char *data, size_t length){
+  if(bulk_buf_reserve(buf, length)){
+    return -1;
+  }
+  memcpy(buf->data + buf->length, data, length);
+  buf->length += length;
+  return 0;
+}
+
+static void bulk_buf_free(BULK_BUF *buf){
+  if(buf->data){ ftcore_free(buf->data); }
+  buf->data = NULL;
+  buf->length = buf->capacity = 0;
+}
+
+/** token frequencies: open addressing, words kept in a byte buffer */
+struct bulk_freq_slot {
+  unsigned long long hash;
+  size_t    offset; // of the word in words, 0 for an empty slot
+  unsigned int      length;
+  unsigned long long count;
+};
+
+typedef struct _bulk_freq {
+  struct bulk_freq_slot *slots;
+  size_t   size;
+  size_t   used;
+  BULK_BUF words;
+} BULK_FREQ;
+
+static int bulk_freq_add(BULK_FREQ *freq, const char *word, unsigned int length, unsigned long long count);
+
+static int bulk_freq_grow(BULK_FREQ *freq){
+  size_t sz = freq->size ? freq->size<<1 : 1024;
+  struct bulk_freq_slot *old = freq->slots;
+  size_t old_size = freq->size;
+  size_t i;
+  freq->slots = (struct bulk_freq_slot*)ftcore_malloc(sz * sizeof(struct bulk_freq_slot));
+  if(!freq->slots){
+    freq->slots = old;
+    return -1;
+  }
+  memset(freq->slots, 0, sz * sizeof(struct bulk_freq_slot));
+  freq->size = sz;
+  for(i=0; i<old_size; i++){
+    if(old[i].offset){
+      size_t j = old[i].hash & (sz-1);
+      while(freq->slots[j].offset){
+        j = (j+1) & (sz-1);
+      }
+      freq->slots[j] = old[i];
+    }
+  }
+  if(old){ ftcore_free(old); }
+  return 0;
+}
+
+static int bulk_freq_add(BULK_FREQ *freq, const char *word, unsigned int length, unsigned long long count){
+  FTHASH128 h;
+  size_t i;
+  if((freq->used+1)*2 > freq->size && bulk_freq_grow(freq)){
+    return -1;
+  }
+  fthash128(word, length, 0, &h);
+  i = h.h1 & (freq->size-1);
+  while(freq->slots[i].offset){
+    struct bulk_freq_slot *slot = &freq->slots[i];
+    if(slot->hash == h.h1 && slot->length == length
+        && memcmp(freq->words.data + slot->offset, word, length) == 0){
+      slot->count += count;
+      return 0;
+    }
+    i = (i+1) & (freq->size-1);
+  }
+  if(freq->words.length == 0 && bulk_buf_append(&freq->words, "", 1)){
+    return -1; // keeps offset 0 for empty slots
+  }
+  size_t offset = freq->words.length;
+  if(bulk_buf_append(&freq->words, word, length)){
+    return -1;
+  }
+  freq->slots[i].hash   = h.h1;
+  freq->slots[i].offset = offset;
+  freq->slots[i].length = length;
+  freq->slots[i].count  = count;
+  freq->used++;
+  return 0;
+}
+
+static int bulk_freq_merge(BULK_FREQ *to, BULK_FREQ *from){
+  size_t i;
+  for(i=0; i<from->size; i++){
+    struct bulk_freq_slot *slot = &from->slots[i];
+    if(slot->offset && bulk_freq_add(to, from->words.data + slot->offset, slot->length, slot->count)){
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static void bulk_freq_free(BULK_FREQ *freq){
+  if(freq->slots){ ftcore_free(freq->slots); }
+  bulk_buf_free(&freq->words);
+  freq->slots = NULL;
+  freq->size = freq->used = 0;
+}
+
+/** a run of whole rows, parsed by one pool task */
+struct bulk_shard {
+  char* start;
+  char* end;
+  unsigned long long first_row;
+  int  use_freq;
+  BULK_BUF  out;
+  BULK_FREQ freq;
+  BULK_BUF  field;
+  unsigned long long tokens;
+  int  row_tokens;
+  int  error;
+};
+
+/** @return the position after the row starting at pos */
+static char* bulk_row_end(char *pos, char *end){
+  if(bulk_format == BULK_CSV){
+    int quoted = 0;
+    for(; pos < end; pos++){
+      if(*pos == '"'){
+        quoted = !quoted;
+      }else if(*pos == '\n' && !quoted){
+        return pos + 1;
+      }
+    }
+    return end;
+  }
+  for(; pos < end; pos++){
+    if(*pos == '\\'){
+      pos++;
+    }else if(*pos == '\n'){
+      return pos + 1;
+    }
+  }
+  return end;
+}
+
+/**
+ * Decodes the field at pos into buf.
+ * @param last set when the field ends the row
+ * @param null set for the NULL marker of TSV dumps
+ * @return the position after the field
+ */
+static char* bulk_field(char *pos, char *end, BULK_BUF *buf, int *last, int *null){
+  buf->length = 0;
+  *last = 0;
+  *null = 0;
+  if(bulk_buf_reserve(buf, (size_t)(end - pos))){
+    return NULL;
+  }
+  char *w = buf->data;
+  if(bulk_format == BULK_CSV){
+    int quoted = 0;
+    while(pos < end){
+      char c = *pos++;
+      if(quoted){
+        if(c == '"'){
+          if(pos < end && *pos == '"'){
+            *w++ = '"';
+            pos++;
+          }else{
+            quoted = 0;
+          }
+        }else{
+          *w++ = c;
+        }
+      }else if(c == '"'){
+        quoted = 1;
+      }else if(c == ','){
+        break;
+      }else if(c == '\n'){
+        if(w > buf->data && w[-1] == '\r'){ w--; }
+        *last = 1;
+        break;
+      }else{
+        *w++ = c;
+      }
+    }
+  }else{
+    if(end - pos >= 2 && pos[0] == '\\' && pos[1] == 'N'
+        && (end - pos == 2 || pos[2] == '\t' || pos[2] == '\n')){
+      *null = 1;
+      pos += 2;
+    }
+    while(pos < end){
+      char c = *pos++;
+      if(c == '\\' && pos < end){
+        c = *pos++;
+        switch(c){
+          case '0': c = '\0'; break;
+          case 'b': c = '\b'; break;
+          case 'n': c = '\n'; break;
+          case 'r': c = '\r'; break;
+          case 't': c = '\t'; break;
+          case 'Z': c = '\032'; break;
+        }
+        *w++ = c;
+      }else if(c == '\t'){
+        break;
+      }else if(c == '\n'){
+        *last = 1;
+        break;
+      }else{
+        *w++ = c;
+      }
+    }
+  }
+  if(pos >= end){
+    *last = 1;
+  }
+  buf->length = (size_t)(w - buf->data);
+  return pos;
+}
+
+/** ftcore_sink of the shard parser */
+static int bulk_collect(void *ctx, const char *word, size_t length,
+                        const FTCORE_BOOLEAN_INFO *info __attribute__((unused))){
+  struct bulk_shard *shard = (struct bulk_shard*)ctx;
+  if(shard->row_tokens++ && bulk_buf_append(&shard->out, " ", 1)){
+    return -1;
+  }
+  if(bulk_buf_append(&shard->out, word, length)){
+    return -1;
+  }
+  if(shard->use_freq && bulk_freq_add(&shard->freq, word, (unsigned int)length, 1)){
+    return -1;
+  }
+  shard->tokens++;
+  return 0;
+}
+
+/** FTPOOL_TASK function */
+static void bulk_shard_parse(void *arg){
+  struct bulk_shard *shard = (struct bulk_shard*)arg;
+  FTCORE_PARSER *parser;
+  BULK_BUF key = { NULL, 0, 0 };
+  char num[32];
+  unsigned long long row = shard->first_row;
+  char *pos = shard->start;
+
+  if(!(parser = ftcore_parser_new())){
+    shard->error = FTCORE_MEMORY_ERROR;
+    return;
+  }
+  while(pos < shard->end && !shard->error){
+    unsigned int column = 0;
+    int last = 0, null;
+    shard->row_tokens = 0;
+    size_t line = shard->out.length;
+    if(bulk_buf_append(&shard->out, "\t", 1)){ // the key goes in front later
+      shard->error = -1;
+      break;
+    }
+    key.length = 0;
+    while(!last){
+      column++;
+      pos = bulk_field(pos, shard->end, &shard->field, &last, &null);
+      if(!pos){
+        shard->error = -1;
+        break;
+      }
+      if(column == bulk_key_column && bulk_buf_append(&key, shard->field.data, shard->field.length)){
+        shard->error = -1;
+        break;
+      }
+      if(null || shard->field.length == 0){
+        continue;
+      }
+      if(bulk_all_columns ? column != bulk_key_column : (column < BULK_MAX_COLUMNS && bulk_columns[column])){
+        int ret = ftcore_parse(parser, &bulk_config, bulk_codec, shard->field.data, shard->field.length,
+                               FTCORE_MODE_NATURAL, bulk_collect, shard);
+        if(ret){
+          shard->error = ret;
+        }
+      }
+    }
+    if(shard->error){
+      break;
+    }
+    if(!bulk_key_column){
+      sprintf(num, "%llu", row);
+      bulk_buf_append(&key, num, strlen(num));
+    }
+    // move the tokens behind the key.
+    if(bulk_buf_reserve(&shard->out, key.length + 1)){
+      shard->error = -1;
+      break;
+    }
+    memmove(shard->out.data + line + key.length, shard->out.data + line, shard->out.length - line);
+    memcpy(shard->out.data + line, key.data, key.length);
+    shard->out.length += key.length;
+    shard->out.data[shard->out.length++] = '\n';
+    row++;
+  }
+  ftcore_parser_free(parser);
+  bulk_buf_free(&key);
+  bulk_buf_free(&shard->field);
+}
+
+/** replay */
+/** ftcore_sink of the replay: words separated by spaces, boolean groups in parentheses */
+static int bulk_replay_collect(void *ctx, const char *word, size_t length, const FTCORE_BOOLEAN_INFO *info){
+  BULK_BUF *out = (BULK_BUF*)ctx;
+  if(out->length && out->data[out->length-1] != '\t' && bulk_buf_append(out, " ", 1)){
+    return -1;
+  }
+  if(info && info->type != FTCORE_TOKEN_WORD){
+    return bulk_buf_append(out, info->type == FTCORE_TOKEN_LEFT_PAREN ? "(" : ")", 1);
+  }
+  return bulk_buf_append(out, word, length);
+}
+
+/**
+ * Parses the documents of a capture file one after another on this thread.
+ * Time budgets are not replayed, so that the tokens do not depend on the
+ * speed of the run.
+ */
+static int bulk_replay(const char *path, FILE *out, int verbose){
+  FTCAPTURE_READER *reader = ftcapture_open(path);
+  FTCORE_PARSER *parser = ftcore_parser_new();
+  const FTCAPTURE_RECORD *rec;
+  const char *doc;
+  BULK_BUF line = { NULL, 0, 0 };
+  unsigned long long docs = 0, bytes = 0, skipped = 0;
+  unsigned long long started = ftcore_now_us(), elapsed = 0;
+  char num[32];
+  int next, status = 0;
+
+  if(!reader){
+    fprintf(stderr, "%s: %s: %s\n", progname, path, strerror(errno));
+    ftcore_parser_free(parser);
+    return 1;
+  }
+  if(!parser){
+    ftcapture_close(reader);
+    return 1;
+  }
+  while((next = ftcapture_next(reader, &rec, &doc)) == 1){
+    FTCORE_CONFIG config = bulk_config;
+    const FTCORE_CODEC *codec = ftcore_codec_get(rec->charset_name);
+    docs++;
+    if(!codec){
+      skipped++;
+      continue;
+    }
+    ftcapture_record_config(rec, &config);
+    config.time_budget_us = 0;
+    sprintf(num, "%llu\t", docs);
+    line.length = 0;
+    if(bulk_buf_append(&line, num, strlen(num))){
+      status = 1;
+      break;
+    }
+    int ret = ftcore_parse(parser, &config, codec, doc, (size_t)rec->length,
+                           rec->mode == FTCAPTURE_MODE_BOOLEAN ? FTCORE_MODE_BOOLEAN : FTCORE_MODE_NATURAL,
+                           bulk_replay_collect, &line);
+    if(ret){
+      fprintf(stderr, "%s: failed to parse document %llu (%d)\n", progname, docs, ret);
+      status = 1;
+      break;
+    }
+    bytes += rec->length;
+    if(bulk_buf_append(&line, "\n", 1) || fwrite(line.data, 1, line.length, out) != line.length){
+      fprintf(stderr, "%s: %s\n", progname, strerror(errno));
+      status = 1;
+      break;
+    }
+  }
+  elapsed = ftcore_now_us() - started;
+  if(next < 0){
+    fprintf(stderr, "%s: %s: damaged record after document %llu\n", progname, path, docs);
+    status = 1;
+  }
+  if(skipped){
+    fprintf(stderr, "%s: skipped %llu documents in charsets without a codec\n", progname, skipped);
+  }
+  if(verbose){
+    fprintf(stderr, "%llu documents, %llu bytes, %.3f s", docs, bytes, (double)elapsed / 1e6);
+    if(elapsed > 0){
+      fprintf(stderr, ", %.1f MB/s", (double)bytes / ((double)elapsed / 1e6) / 1048576.0);
+    }
+    fputc('\n', stderr);
+  }
+  bulk_buf_free(&line);
+  ftcore_parser_free(parser);
+  ftcapture_close(reader);
+  return status;
+}
+/** /replay */
+
+/** scaling benchmark */
+struct bulk_bench_doc {
+  size_t offset;
+  size_t length;
+};
+
+/** the fields to tokenize, shared read-only by the benchmark threads */
+static BULK_BUF bulk_corpus_text = { NULL, 0, 0 };
+static struct bulk_bench_doc *bulk_corpus = NULL;
+static size_t bulk_corpus_count = 0;
+
+/** ftcore_malloc() calls of the thread, where the plugin calls my_malloc() */
+static __thread unsigned long long bench_alloc_calls;
+
+static void* bench_malloc(size_t size){
+  bench_alloc_calls++;
+  return malloc(size);
+}
+
+static void* bench_realloc(void *ptr, size_t size){
+  bench_alloc_calls++;
+  return realloc(ptr, size);
+}
+
+static void bench_free(void *ptr){
+  free(ptr);
+}
+
+/**
+ * core hooks of the benchmark: libc, counted per thread. Setting them hands
+ * ICU the slab allocator, as the plugin does.
+ */
+static const FTCORE_HOOKS bulk_bench_hooks = {
+  bench_malloc, bench_realloc, bench_free, NULL, NULL
+};
+
+static unsigned long long bulk_now_ns(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+struct bulk_bench_worker {
+  pthread_t thread;
+  pthread_barrier_t *start;
+  unsigned int index;
+  unsigned int threads;
+  unsigned long long tokens;
+  unsigned long long alloc_calls;
+  int error;
+};
+
+static int bulk_bench_count(void *ctx, const char *word __attribute__((unused)), size_t length __attribute__((unused)),
+                            const FTCORE_BOOLEAN_INFO *info __attribute__((unused))){
+  (*(unsigned long long*)ctx)++;
+  return 0;
+}
+
+/** parses the whole corpus, starting at a different document in each thread. */
+static void* bulk_bench_main(void *arg){
+  struct bulk_bench_worker *worker = (struct bulk_bench_worker*)arg;
+  size_t first = bulk_corpus_count * worker->index / worker->threads;
+  size_t i;
+  pthread_barrier_wait(worker->start);
+  bench_alloc_calls = 0;
+  FTCORE_PARSER *parser = ftcore_parser_new();
+  if(!parser){
+    worker->error = FTCORE_MEMORY_ERROR;
+    return NULL;
+  }
+  for(i=0; i<bulk_corpus_count && !worker->error; i++){
+    const struct bulk_bench_doc *doc = &bulk_corpus[(first + i) % bulk_corpus_count];
+    worker->error = ftcore_parse(parser, &bulk_config, bulk_codec, bulk_corpus_text.data + doc->offset,
+                                 doc->length, FTCORE_MODE_NATURAL, bulk_bench_count, &worker->tokens);
+  }
+  ftcore_parser_free(parser);
+  worker->alloc_calls = bench_alloc_calls;
+  return NULL;
+}
+
+/** collects the fields to tokenize of the dump. */
+static int bulk_bench_load(char *pos, char *end){
+  BULK_BUF field = { NULL, 0, 0 };
+  size_t capacity = 0;
+  int status = 0;
+  if(pos && bulk_skip_header){
+    pos = bulk_row_end(pos, end);
+  }
+  while(pos && pos < end && !status){
+    unsigned int column = 0;
+    int last = 0, null;
+    while(!last){
+      column++;
+      pos = bulk_field(pos, end, &field, &last, &null);
+      if(!pos){
+        status = -1;
+        break;
+      }
+      if(null || field.length == 0
+          || !(bulk_all_columns ? column != bulk_key_column : (column < BULK_MAX_COLUMNS && bulk_columns[column]))){
+        continue;
+      }
+      if(bulk_corpus_count == capacity){
+        size_t sz = capacity ? capacity<<1 : 1024;
+        struct bulk_bench_doc *tmp = (struct bulk_bench_doc*)(bulk_corpus ? ftcore_realloc(bulk_corpus, sz * sizeof(struct bulk_bench_doc))
+                                                                          : ftcore_malloc(sz * sizeof(struct bulk_bench_doc)));
+        if(!tmp){
+          status = -1;
+          break;
+        }
+        bulk_corpus = tmp;
+        capacity = sz;
+      }
+      bulk_corpus[bulk_corpus_count].offset = bulk_corpus_text.length;
+      bulk_corpus[bulk_corpus_count].length = field.length;
+      if(bulk_buf_append(&bulk_corpus_text, field.data, field.length)){
+        status = -1;
+        break;
+      }
+      bulk_corpus_count++;
+    }
+  }
+  bulk_buf_free(&field);
+  return status;
+}
+
+/**
+ * Runs the corpus on 1, 2, 4 ... max_threads threads and prints a line per
+ * step. Every thread parses all of the corpus, so without contention the
+ * throughput grows with the threads up to the number of cores.
+ */
+static int bulk_bench(char *map, size_t length, unsigned int max_threads){
+  unsigned int threads, i;
+  double base = 0;
+  if(bulk_bench_load(map, map + length)){
+    fprintf(stderr, "%s: out of memory\n", progname);
+    return 1;
+  }
+  if(bulk_corpus_count == 0){
+    fprintf(stderr, "%s: nothing to tokenize\n", progname);
+    return 1;
+  }
+  printf("# %lu documents, %lu bytes, %ld online CPUs\n",
+         (unsigned long)bulk_corpus_count, (unsigned long)bulk_corpus_text.length, sysconf(_SC_NPROCESSORS_ONLN));
+  printf("# threads  seconds     MB/s  speedup  efficiency  mallocs/doc  slab/doc  visits/doc  cpu%%  csw/s\n");
+  for(threads = 1; ; threads = threads*2 < max_threads ? threads*2 : max_threads){
+    struct bulk_bench_worker *workers = (struct bulk_bench_worker*)ftcore_malloc(threads * sizeof(struct bulk_bench_worker));
+    pthread_barrier_t start;
+    struct rusage ru0, ru1;
+    unsigned long long alloc_calls = 0, started, wall;
+    unsigned long allocs, visits;
+    int error = 0;
+    if(!workers){
+      return 1;
+    }
+    memset(workers, 0, threads * sizeof(struct bulk_bench_worker));
+    pthread_barrier_init(&start, NULL, threads + 1);
+    for(i=0; i<threads; i++){
+      workers[i].start = &start;
+      workers[i].index = i;
+      workers[i].threads = threads;
+      if(pthread_create(&workers[i].thread, NULL, bulk_bench_main, &workers[i])){
+        fprintf(stderr, "%s: can not start thread %u\n", progname, i + 1);
+        return 1;
+      }
+    }
+    getrusage(RUSAGE_SELF, &ru0);
+    allocs = ftslab_allocs + ftslab_large;
+    visits = ftslab_pool_visits;
+    pthread_barrier_wait(&start);
+    started = bulk_now_ns();
+    for(i=0; i<threads; i++){
+      pthread_join(workers[i].thread, NULL);
+      alloc_calls += workers[i].alloc_calls;
+      if(workers[i].error){ error = workers[i].error; }
+    }
+    wall = bulk_now_ns() - started;
+    getrusage(RUSAGE_SELF, &ru1);
+    // the threads have added their counts of the slab allocator on exit.
+    allocs = ftslab_allocs + ftslab_large - allocs;
+    visits = ftslab_pool_visits - visits;
+    pthread_barrier_destroy(&start);
+    ftcore_free(workers);
+    if(error){
+      fprintf(stderr, "%s: parse failed (%d)\n", progname, error);
+      return 1;
+    }
+
+    double secs = (double)wall / 1e9;
+    double mbps = (double)bulk_corpus_text.length * threads / secs / 1048576.0;
+    double cpu = (double)(ru1.ru_utime.tv_sec - ru0.ru_utime.tv_sec + ru1.ru_stime.tv_sec - ru0.ru_stime.tv_sec)
+               + (double)(ru1.ru_utime.tv_usec - ru0.ru_utime.tv_usec + ru1.ru_stime.tv_usec - ru0.ru_stime.tv_usec) / 1e6;
+    long csw = (ru1.ru_nvcsw - ru0.ru_nvcsw) + (ru1.ru_nivcsw - ru0.ru_nivcsw);
+    if(threads == 1){
+      base = mbps;
+    }
+    printf("%9u %8.3f %8.1f %8.2f %11.2f %12.1f %9.1f %11.3f %5.0f %6.0f\n",
+           threads, secs, mbps, mbps / base, mbps / base / threads,
+           (double)alloc_calls / ((double)bulk_corpus_count * threads),
+           (double)allocs / ((double)bulk_corpus_count * threads),
+           (double)visits / ((double)bulk_corpus_count * threads),
+           100.0 * cpu / secs, (double)csw / secs);
+    fflush(stdout);
+    if(threads >= max_threads){
+      break;
+    }
+  }
+  return 0;
+}
+/** /scaling benchmark */
+
+static const char* bulk_normalizations[] = { "OFF", "C", "D", "KC", "KD", "FCD", "C_CF", "KC_CF", NULL };
+static const char* bulk_tokenizers[] = { "DEFAULT", "CJK_BIGRAM", "ICU", NULL };
+
+static const char* bulk_classes[] = { "NUMERIC", "HEX", "OVERLONG", NULL }; // FTCORE_CLASS_*
+static const char* bulk_emits[] = { "SURFACE", "EDGE", "TRIGRAM", NULL };   // FTCORE_EMIT_*
+
+/** flags of a comma separated list of names, the nth name being 1<<n */
+static int bulk_flag_list(const char *list, const char **names, int *flags){
+  *flags = 0;
+  while(*list){
+    size_t len = strcspn(list, ",");
+    int i;
+    for(i=0; names[i]; i++){
+      if(len == strlen(names[i]) && strncmp(list, names[i], len) == 0){
+        *flags |= 1<<i;
+        break;
+      }
+    }
+    if(!names[i]){
+      return -1;
+    }
+    list += len;
+    if(*list == ','){ list++; }
+  }
+  return 0;
+}
+
+static int bulk_freq_order(const void *a, const void *b){
+  const struct bulk_freq_slot *x = *(const struct bulk_freq_slot**)a;
+  const struct bulk_freq_slot *y = *(const struct bulk_freq_slot**)b;
+  if(x->count != y->count){
+    return x->count > y->count ? -1 : 1;
+  }
+  return x->offset < y->offset ? -1 : 1;
+}
+
+/** @return the slots of the frequency table, most frequent first */
+static struct bulk_freq_slot** bulk_freq_sorted(BULK_FREQ *freq, size_t *count){
+  struct bulk_freq_slot **order;
+  size_t i, n = 0;
+  order = (struct bulk_freq_slot**)ftcore_malloc((freq->used+1) * sizeof(struct bulk_freq_slot*));
+  if(!order){
+    return NULL;
+  }
+  for(i=0; i<freq->size; i++){
+    if(freq->slots[i].offset){
+      order[n++] = &freq->slots[i];
+    }
+  }
+  qsort(order, n, sizeof(struct bulk_freq_slot*), bulk_freq_order);
+  *count = n;
+  return order;
+}
+
+/** writes the frequencies, most frequent first. */
+static int bulk_write_freq(BULK_FREQ *freq, const char *path){
+  FILE *fp = fopen(path, "w");
+  struct bulk_freq_slot **order;
+  size_t i, n = 0;
+  if(!fp){
+    fprintf(stderr, "%s: %s: %s\n", progname, path, strerror(errno));
+    return -1;
+  }
+  order = bulk_freq_sorted(freq, &n);
+  if(!order){
+    fclose(fp);
+    return -1;
+  }
+  for(i=0; i<n; i++){
+    fwrite(freq->words.data + order[i]->offset, 1, order[i]->length, fp);
+    fprintf(fp, "\t%llu\n", order[i]->count);
+  }
+  ftcore_free(order);
+  return fclose(fp);
+}
+
+/**
+ * Writes the top words of freq with their stems, after the override entries
+ * of the file at overrides, for each of the comma separated algorithms.
+ */
+static int bulk_write_dict(BULK_FREQ *freq, size_t top, const char *overrides,
+                           const char *algorithms, const char *path){
+  FTDICT_BUILDER *builder = ftdict_builder_new();
+  FTCORE_PARSER *parser = ftcore_parser_new();
+  FTCORE_CONFIG config = bulk_config;
+  struct bulk_freq_slot **order = NULL;
+  char *list = NULL, *algorithm, *save = NULL;
+  size_t i, n = 0;
+  int ret = -1;
+
+  if(!builder || !parser || !(order = bulk_freq_sorted(freq, &n))
+      || !(list = (char*)ftcore_malloc(strlen(algorithms) + 1))){
+    goto end;
+  }
+  strcpy(list, algorithms);
+  config.surface = 0;
+  for(algorithm = strtok_r(list, ",", &save); algorithm; algorithm = strtok_r(NULL, ",", &save)){
+    config.algorithm = algorithm;
+    if(overrides){
+      FILE *fp = fopen(overrides, "r");
+      char line[1024];
+      if(!fp){
+        fprintf(stderr, "%s: %s: %s\n", progname, overrides, strerror(errno));
+        goto end;
+      }
+      while(fgets(line, sizeof(line), fp)){
+        char *tab = strchr(line, '\t');
+        size_t length = strcspn(line, "\r\n");
+        if(!tab || (size_t)(tab - line) >= length){
+          continue;
+        }
+        if(ftcore_dict_add(parser, builder, &config, bulk_codec, line, (size_t)(tab - line),
+                           tab + 1, length - (size_t)(tab + 1 - line))){
+          fprintf(stderr, "%s: no stemmer for %s\n", progname, algorithm);
+          fclose(fp);
+          goto end;
+        }
+      }
+      fclose(fp);
+    }
+    for(i=0; i<n && i<top; i++){
+      if(ftcore_dict_add(parser, builder, &config, bulk_codec, freq->words.data + order[i]->offset,
+                         order[i]->length, NULL, 0)){
+        fprintf(stderr, "%s: no stemmer for %s\n", progname, algorithm);
+        goto end;
+      }
+    }
+  }
+  ret = ftdict_builder_write(builder, path);
+  if(ret){
+    fprintf(stderr, "%s: %s: %s\n", progname, path, strerror(errno));
+  }
+end:
+  if(list){ ftcore_free(list); }
+  if(order){ ftcore_free(order); }
+  ftcore_parser_free(parser);
+  ftdict_builder_free(builder);
+  return ret;
+}
+
+static int bulk_parse_columns(const char *list){
+  const char *pos = list;
+  bulk_all_columns = 0;
+  while(*pos){
+    char *next;
+    unsigned long col = strtoul(pos, &next, 10);
+    if(next == pos || col == 0 || col >= BULK_MAX_COLUMNS){
+      return -1;
+    }
+    bulk_columns[col] = 1;
+    pos = *next == ',' ? next + 1 : next;
+    if(*next && *next != ','){
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static __attribute__((noreturn)) void usage(int status){
+  fprintf(status ? stderr : stdout,
+    "usage: %s [options] FILE\n"
+    "       %s [-t N] [-o FILE] [-v] -r CAPTURE\n"
+    "  -f tsv|csv    format of FILE (default tsv, as written by SELECT ... INTO OUTFILE)\n"
+    "  -c LIST       comma separated columns to tokenize, counted from 1 (default all)\n"
+    "  -k N          column written in front of each row (default the row number)\n"
+    "  -H            skip the first row\n"
+    "  -C CHARSET    charset of FILE, utf8 or latin1 (default utf8)\n"
+    "  -t N          threads (default the number of online CPUs)\n"
+    "  -o FILE       token output (default stdout)\n"
+    "  -s FILE       token frequency output\n"
+    "  -a ALGORITHM  stemming algorithm, as snowball_algorithm (default english)\n"
+    "  -n FORM       C, D, KC, KD, FCD, C_CF, KC_CF or OFF, as snowball_normalization (default OFF)\n"
+    "  -u            normalize by Unicode 3.2, as snowball_unicode_version=3.2\n"
+    "  -U            strip accents from the stems, as snowball_unaccent\n"
+    "  -T TOKENIZER  DEFAULT, CJK_BIGRAM or ICU, as snowball_tokenizer (default DEFAULT)\n"
+    "  -x LIST       NUMERIC, HEX and OVERLONG tokens to drop, as snowball_drop_tokens\n"
+    "  -E LIST       SURFACE, EDGE and TRIGRAM tokens to emit besides the stems, as snowball_emit\n"
+    "  -g MIN,MAX    characters of the edge n-grams, as snowball_edge_min and snowball_edge_max (default 2,15)\n"
+    "  -m N          bytes of the longest token (default 254, the MyISAM limit)\n"
+    "  -v            report throughput on stderr\n"
+    "  -D FILE       write a stem dictionary of the most frequent words instead of tokens\n"
+    "  -N N          words in the dictionary (default 65536)\n"
+    "  -O FILE       dictionary entries to add first, one SURFACE<tab>STEM per line\n"
+    "  -A LIST       comma separated algorithms of the dictionary (default -a)\n"
+    "  -r CAPTURE    replay the documents of a snowball_capture file instead\n"
+    "  -b N          benchmark 1, 2, 4 ... N concurrent parsers on FILE instead\n",
+    progname, progname);
+  exit(status);
+}
+
+int main(int argc, char **argv){
+  const char *out_path = NULL;
+  const char *freq_path = NULL;
+  const char *dict_path = NULL;
+  const char *dict_overrides = NULL;
+  const char *dict_algorithms = NULL;
+  const char *replay_path = NULL;
+  unsigned int bench_threads = 0;
+  size_t dict_top = 65536;
+  const char *csname = "utf8";
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  int verbose = 0;
+  int opt, i;
+
+  progname = argv[0];
+  memset(&bulk_config, 0, sizeof(bulk_config));
+  bulk_config.max_token_bytes = 254;
+
+  while((opt = getopt(argc, argv, "f:c:k:HC:t:o:s:a:n:uUT:x:E:g:m:D:N:O:A:r:b:vh")) != -1){
+    switch(opt){
+      case 'f':
+        if(strcmp(optarg, "tsv")==0){ bulk_format = BULK_TSV; }
+        else if(strcmp(optarg, "csv")==0){ bulk_format = BULK_CSV; }
+        else{ usage(1); }
+        break;
+      case 'c':
+        if(bulk_parse_columns(optarg)){ usage(1); }
+        break;
+      case 'k': bulk_key_column = (unsigned int)atoi(optarg); break;
+      case 'H': bulk_skip_header = 1; break;
+      case 'C': csname = optarg; break;
+      case 't': threads = atol(optarg); break;
+      case 'o': out_path = optarg; break;
+      case 's': freq_path = optarg; break;
+      case 'a': bulk_config.algorithm = optarg; break;
+      case 'n':
+        for(i=0; bulk_normalizations[i] && strcasecmp(bulk_normalizations[i], optarg); i++);
+        if(!bulk_normalizations[i]){ usage(1); }
+        bulk_config.normalization = (enum ftcore_normalization)i;
+        break;
+      case 'u': bulk_config.unicode_3_2 = 1; break;
+      case 'U': bulk_config.unaccent = 1; break;
+      case 'T':
+        for(i=0; bulk_tokenizers[i] && strcasecmp(bulk_tokenizers[i], optarg); i++);
+        if(!bulk_tokenizers[i]){ usage(1); }
+        bulk_config.tokenizer = (enum ftcore_tokenizer)i;
+        break;
+      case 'x':
+        if(bulk_flag_list(optarg, bulk_classes, &bulk_config.drop)){ usage(1); }
+        break;
+      case 'E':
+        if(bulk_flag_list(optarg, bulk_emits, &bulk_config.emit)){ usage(1); }
+        break;
+      case 'g':
+        if(sscanf(optarg, "%u,%u", &bulk_config.edge_min, &bulk_config.edge_max) != 2
+            || bulk_config.edge_min < 1 || bulk_config.edge_max < bulk_config.edge_min){ usage(1); }
+        break;
+      case 'm': bulk_config.max_token_bytes = (size_t)strtoul(optarg, NULL, 10); break;
+      case 'D': dict_path = optarg; break;
+      case 'N': dict_top = (size_t)strtoul(optarg, NULL, 10); break;
+      case 'O': dict_overrides = optarg; break;
+      case 'A': dict_algorithms = optarg; break;
+      case 'r': replay_path = optarg; break;
+      case 'b':
+        bench_threads = (unsigned int)strtoul(optarg, NULL, 10);
+        if(bench_threads < 1 || bench_threads > 256){ usage(1); }
+        break;
+      case 'v': verbose = 1; break;
+      case 'h': usage(0);
+      default: usage(1);
+    }
+  }
+  if(optind + (replay_path ? 0 : 1) != argc){
+    usage(1);
+  }
+  if(dict_path){
+    bulk_config.surface = 1; // words are counted as they are and stemmed once.
+    bulk_config.unaccent = 0; // and looked up before their accents go.
+    bulk_config.emit = 0;
+  }
+  bulk_codec = ftcore_codec_get(csname);
+  if(!bulk_codec){
+    fprintf(stderr, "%s: unknown charset %s\n", progname, csname);
+    return 1;
+  }
+
+  // the core's pool runs the shards; this thread is one of the workers.
+  if(threads < 1){ threads = 1; }
+  if(threads > 65){ threads = 65; }
+  if(ftcore_init(bench_threads ? &bulk_bench_hooks : NULL, bench_threads ? 0 : (unsigned int)threads - 1)){
+    fprintf(stderr, "%s: init failed\n", progname);
+    return 1;
+  }
+
+  if(replay_path){
+    FILE *out = out_path ? fopen(out_path, "w") : stdout;
+    int status;
+    if(!out){
+      fprintf(stderr, "%s: %s: %s\n", progname, out_path, strerror(errno));
+      return 1;
+    }
+    status = bulk_replay(replay_path, out, verbose);
+    if(out_path ? fclose(out) : fflush(out)){
+      status = 1;
+    }
+    ftcore_deinit();
+    return status;
+  }
+
+  int fd = open(argv[optind], O_RDONLY);
+  struct stat st;
+  if(fd < 0 || fstat(fd, &st)){
+    fprintf(stderr, "%s: %s: %s\n", progname, argv[optind], strerror(errno));
+    return 1;
+  }
+  char *map = NULL;
+  if(st.st_size > 0){
+    map = (char*)mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(map == MAP_FAILED){
+      fprintf(stderr, "%s: %s: %s\n", progname, argv[optind], strerror(errno));
+      return 1;
+    }
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+  }
+  if(bench_threads){
+    int status = bulk_bench(map, (size_t)st.st_size, bench_threads);
+    bulk_buf_free(&bulk_corpus_text);
+    if(bulk_corpus){ ftcore_free(bulk_corpus); }
+    if(map){ munmap(map, (size_t)st.st_size); }
+    close(fd);
+    ftcore_deinit();
+    return status;
+  }
+  FILE *out = out_path ? fopen(out_path, "w") : stdout;
+  if(!out){
+    fprintf(stderr, "%s: %s: %s\n", progname, out_path, strerror(errno));
+    return 1;
+  }
+
+  unsigned int max_shards = (unsigned int)threads * 4;
+  struct bulk_shard *shards = (struct bulk_shard*)ftcore_malloc(max_shards * sizeof(struct bulk_shard));
+  FTPOOL_TASK *tasks = (FTPOOL_TASK*)ftcore_malloc(max_shards * sizeof(FTPOOL_TASK));
+  BULK_FREQ freq = { NULL, 0, 0, { NULL, 0, 0 } };
+  unsigned long long rows = 0, tokens = 0;
+  int status = 0;
+  time_t started = time(NULL);
+  if(!shards || !tasks){
+    return 1;
+  }
+
+  char *pos = map;
+  char *end = map + st.st_size;
+  if(pos && bulk_skip_header){
+    pos = bulk_row_end(pos, end);
+  }
+  while(pos && pos < end && !status){
+    unsigned int count = 0, i;
+    // cut a batch of shards at row boundaries.
+    while(count < max_shards && pos < end){
+      struct bulk_shard *shard = &shards[count];
+      memset(shard, 0, sizeof(struct bulk_shard));
+      shard->start = pos;
+      shard->first_row = rows + 1;
+      shard->use_freq = freq_path != NULL || dict_path != NULL;
+      while(pos < end && (size_t)(pos - shard->start) < BULK_SHARD_BYTES){
+        pos = bulk_row_end(pos, end);
+        rows++;
+      }
+      shard->end = pos;
+      tasks[count].func = bulk_shard_parse;
+      tasks[count].arg  = shard;
+      count++;
+    }
+    ftpool_run(tasks, count);
+
+    for(i=0; i<count; i++){
+      struct bulk_shard *shard = &shards[i];
+      if(shard->error){
+        fprintf(stderr, "%s: failed to parse rows from %llu (%d)\n", progname, shard->first_row, shard->error);
+        status = 1;
+      }
+      if(!status && !dict_path && fwrite(shard->out.data, 1, shard->out.length, out) != shard->out.length){
+        fprintf(stderr, "%s: %s\n", progname, strerror(errno));
+        status = 1;
+      }
+      if(!status && shard->use_freq && bulk_freq_merge(&freq, &shard->freq)){
+        status = 1;
+      }
+      tokens += shard->tokens;
+      bulk_buf_free(&shard->out);
+      bulk_freq_free(&shard->freq);
+    }
+  }
+  if(out_path ? fclose(out) : fflush(out)){
+    status = 1;
+  }
+  if(!status && freq_path && bulk_write_freq(&freq, freq_path)){
+    status = 1;
+  }
+  if(!status && dict_path && bulk_write_dict(&freq, dict_top, dict_overrides,
+                                             dict_algorithms ? dict_algorithms : (bulk_config.algorithm ? bulk_config.algorithm : "english"),
+                                             dict_path)){
+    status = 1;
+  }
+
+  if(verbose){
+    double secs = difftime(time(NULL), started);
+    fprintf(stderr, "%llu rows, %llu tokens, %lu distinct, %ld threads, %.0f s",
+            rows, tokens, (unsigned long)freq.used, threads, secs);
+    if(secs > 0){
+      fprintf(stderr, ", %.1f MB/s", (double)st.st_size / secs / 1048576.0);
+    }
+    fputc('\n', stderr);
+  }
+
+  bulk_freq_free(&freq);
+  ftcore_free(tasks);
+  ftcore_free(shards);
+  if(map){ munmap(map, (size_t)st.st_size); }
+  close(fd);
+  ftcore_deinit();
+  return status;
+}
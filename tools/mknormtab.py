@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Generates ftnormtab.h, the normalization tables of ftnorm.c.
+
+    python3 tools/mknormtab.py > ftnormtab.h
+
+The tables come from the unicodedata module of the python running this;
+use one with the Unicode version of the ICU the plugin is built with.
+"""
+import sys
+import unicodedata
+
+# blocks the tables normalize. a code point whose mappings leave these is
+# dropped, so that everything the tables write is in them too.
+BLOCKS = [
+    (0x0000, 0x052F),  # Latin, IPA, combining marks, Greek, Cyrillic
+    (0x1100, 0x11FF),  # Hangul Jamo
+    (0x1AB0, 0x1AFF),  # Combining Diacritical Marks Extended
+    (0x1C80, 0x1C8F),  # Cyrillic Extended-C
+    (0x1D00, 0x1FFF),  # Phonetic Extensions, Latin Extended Additional, Greek Extended
+    (0x2000, 0x24FF),  # punctuation, letterlike, number forms, enclosed alphanumerics
+    (0x2C60, 0x2C7F),  # Latin Extended-C
+    (0x2DE0, 0x2DFF),  # Cyrillic Extended-A
+    (0x3000, 0x30FF),  # CJK Symbols and Punctuation, Hiragana, Katakana
+    (0x3130, 0x318F),  # Hangul Compatibility Jamo
+    (0x31F0, 0x31FF),  # Katakana Phonetic Extensions
+    (0x3200, 0x33FF),  # Enclosed CJK Letters and Months, CJK Compatibility
+    (0x3400, 0x4DBF),  # CJK Unified Ideographs Extension A
+    (0x4E00, 0x9FFF),  # CJK Unified Ideographs
+    (0xA640, 0xA69F),  # Cyrillic Extended-B
+    (0xA720, 0xA7FF),  # Latin Extended-D
+    (0xAB30, 0xAB6F),  # Latin Extended-E
+    (0xAC00, 0xD7A3),  # Hangul Syllables
+    (0xF900, 0xFAFF),  # CJK Compatibility Ideographs
+    (0xFB00, 0xFB06),  # Latin ligatures
+    (0xFE30, 0xFE4F),  # CJK Compatibility Forms
+    (0xFF00, 0xFFEF),  # Halfwidth and Fullwidth Forms
+]
+HANGUL_FIRST, HANGUL_LAST = 0xAC00, 0xD7A3
+LV_FIRST, LV_LAST = 0x1161, 0x1175  # vowel jamo
+T_FIRST, T_LAST = 0x11A8, 0x11C2    # trailing jamo
+MARKS_LAST = 0x2FFF  # accents end here; the kana voicing marks are kept
+
+
+def cps(s):
+    return [ord(c) for c in s]
+
+
+def mappings(cp):
+    """canonical and compatibility decompositions, and the decompositions of
+    the case folding, which is applied to decomposed text"""
+    c = chr(cp)
+    fold = c.casefold()
+    return (cps(unicodedata.normalize('NFD', c)), cps(unicodedata.normalize('NFKD', c)),
+            cps(unicodedata.normalize('NFD', fold)), cps(unicodedata.normalize('NFKD', fold)))
+
+
+def main():
+    covered = set()
+    for first, last in BLOCKS:
+        covered.update(cp for cp in range(first, last + 1) if not 0xD800 <= cp <= 0xDFFF)
+
+    # primary composites, and the code points composing with the one before
+    pairs = {}
+    back = set(range(LV_FIRST, LV_LAST + 1)) | set(range(T_FIRST, T_LAST + 1))
+    for cp in range(0x110000):
+        if HANGUL_FIRST <= cp <= HANGUL_LAST or 0xD800 <= cp <= 0xDFFF:
+            continue
+        d = unicodedata.decomposition(chr(cp))
+        if not d or d.startswith('<'):
+            continue
+        parts = [int(x, 16) for x in d.split()]
+        if len(parts) != 2 or unicodedata.normalize('NFC', chr(parts[0]) + chr(parts[1])) != chr(cp):
+            continue
+        back.add(parts[1])
+        if max(parts[0], parts[1], cp) <= 0xFFFF:
+            pairs[(parts[0], parts[1])] = cp
+
+    maps = {cp: mappings(cp) for cp in covered}
+    while True:
+        drop = set(cp for cp in covered
+                   if any(m not in covered for v in maps[cp] for m in v))
+        if not drop:
+            break
+        covered -= drop
+
+    # folding a character that starts a segment has to start one too
+    for cp in covered:
+        c = chr(cp)
+        if unicodedata.combining(c) == 0 and cp not in back and c.casefold() != c:
+            for v in maps[cp][2:]:
+                if unicodedata.combining(chr(v[0])) != 0 or v[0] in back:
+                    sys.exit('U+%04X folds into a combining sequence' % cp)
+
+    # records: ccc, flags, four mappings
+    pool = [0]
+    pool_index = {}
+
+    def intern(seq, cp):
+        if seq == [cp]:
+            return 0
+        key = tuple(seq)
+        if key not in pool_index:
+            pool_index[key] = len(pool)
+            pool.append(len(seq))
+            pool.extend(seq)
+        return pool_index[key]
+
+    records = [(0, 0, 0, 0, 0, 0)]
+    record_index = {records[0]: 0}
+    cp_record = [0] * 0x10000
+    for cp in range(0x10000):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        flags = 0
+        m = (0, 0, 0, 0)
+        if cp in covered:
+            flags |= 1
+            if not HANGUL_FIRST <= cp <= HANGUL_LAST:
+                m = tuple(intern(v, cp) for v in maps[cp])
+        if cp in back:
+            flags |= 2
+        if HANGUL_FIRST <= cp <= HANGUL_LAST:
+            flags |= 4
+        if cp in covered and cp <= MARKS_LAST and unicodedata.category(chr(cp)) in ('Mn', 'Me'):
+            flags |= 8
+        rec = (unicodedata.combining(chr(cp)), flags) + m
+        if rec not in record_index:
+            record_index[rec] = len(records)
+            records.append(rec)
+        cp_record[cp] = record_index[rec]
+    if len(records) > 0xFFFF or len(pool) > 0xFFFF:
+        sys.exit('tables too large')
+
+    stage1 = []
+    blocks = []
+    block_index = {}
+    for b in range(0x10000 // 64):
+        block = tuple(cp_record[b * 64:(b + 1) * 64])
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_index[block])
+
+    out = sys.stdout
+    out.write('/* generated by tools/mknormtab.py from Unicode %s. do not edit. */\n'
+              % unicodedata.unidata_version)
+    out.write('#ifndef FTNORMTAB_H\n#define FTNORMTAB_H\n\n')
+    out.write('#define FTNORMTAB_UNICODE "%s"\n\n' % unicodedata.unidata_version)
+    out.write('#define FTNORMTAB_COVERED 1 // normalized by the tables\n')
+    out.write('#define FTNORMTAB_BACK    2 // composes with the character before\n')
+    out.write('#define FTNORMTAB_HANGUL  4 // a Hangul syllable, decomposed by arithmetic\n')
+    out.write('#define FTNORMTAB_MARK    8 // an accent, stripped by uni_unaccent()\n\n')
+    out.write('/** the mappings of a record */\n')
+    out.write('#define FTNORMTAB_CANON       0\n#define FTNORMTAB_COMPAT      1\n')
+    out.write('#define FTNORMTAB_CANON_FOLD  2 // of decomposed text\n#define FTNORMTAB_COMPAT_FOLD 3\n\n')
+    out.write('struct ftnormtab_record {\n'
+              '  unsigned char ccc;\n'
+              '  unsigned char flags;\n'
+              '  unsigned short map[4]; // 0 for the code point itself, or where its length is in ftnormtab_maps\n'
+              '};\n\n')
+    out.write('struct ftnormtab_pair {\n'
+              '  unsigned short first, second, composite;\n'
+              '};\n\n')
+
+    def table(decl, values, per_line, fmt):
+        out.write('%s = {\n' % decl)
+        for i in range(0, len(values), per_line):
+            line = ', '.join(fmt(v) for v in values[i:i + per_line])
+            out.write('  %s%s\n' % (line, ',' if i + per_line < len(values) else ''))
+        out.write('};\n\n')
+
+    table('static const unsigned short ftnormtab_stage1[%d]' % len(stage1), stage1, 16, str)
+    flat = [r for b in blocks for r in b]
+    table('static const unsigned short ftnormtab_stage2[%d]' % len(flat), flat, 16, str)
+    table('static const struct ftnormtab_record ftnormtab_records[%d]' % len(records), records, 4,
+          lambda r: '{%d,%d,{%d,%d,%d,%d}}' % r)
+    table('static const unsigned short ftnormtab_maps[%d]' % len(pool), pool, 12, lambda v: '0x%04X' % v)
+    plist = sorted(pairs.items())
+    table('static const struct ftnormtab_pair ftnormtab_pairs[%d]' % len(plist), plist, 4,
+          lambda p: '{0x%04X,0x%04X,0x%04X}' % (p[0][0], p[0][1], p[1]))
+    out.write('#endif\n')
+
+
+if __name__ == '__main__':
+    main()